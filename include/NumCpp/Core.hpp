@@ -27,11 +27,14 @@
 ///
 #pragma once
 
+#include "NumCpp/Core/ChunkReader.hpp"
+#include "NumCpp/Core/ChunkWriter.hpp"
 #include "NumCpp/Core/Constants.hpp"
 #include "NumCpp/Core/DataCube.hpp"
 #include "NumCpp/Core/DtypeInfo.hpp"
 #include "NumCpp/Core/Enums.hpp"
 #include "NumCpp/Core/Internal/Version.hpp"
+#include "NumCpp/Core/MemMap.hpp"
 #include "NumCpp/Core/Shape.hpp"
 #include "NumCpp/Core/Slice.hpp"
 #include "NumCpp/Core/Timer.hpp"
@@ -0,0 +1,374 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Streaming reader of binary NdArray files in fixed row chunks
+///
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/Endian.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/NpyFormat.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Shape.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc
+{
+    //================================================================================
+    /// Reads a binary file that is too large to load at once as a sequence of
+    /// NdArray chunks of a fixed number of rows, the last chunk holding whatever
+    /// rows remain. A background thread reads the next chunk into a second buffer
+    /// while the current one is being processed.
+    ///
+    /// Files written by save() or ChunkWriter take their shape and byte order from
+    /// the .npy header, with the first dimension as the rows and any remaining
+    /// dimensions flattened into the columns. Raw files written by tofile(), dump()
+    /// or ChunkWriter are read with a user supplied number of columns and byte order.
+    template<typename dtype>
+    class ChunkReader
+    {
+    public:
+        STATIC_ASSERT_ARITHMETIC_OR_COMPLEX(dtype);
+
+        //============================================================================
+        // Method Description:
+        /// Constructor for .npy files
+        ///
+        /// @param inFilename
+        /// @param inChunkRows: the number of rows in each chunk
+        ///
+        ChunkReader(const std::string& inFilename, uint32 inChunkRows)
+        {
+            open(inFilename);
+
+            const auto header = npy::readHeader(file_);
+            byteSwap_         = npy::byteSwapRequired<dtype>(header);
+
+            uint64 numCols = 1;
+            for (std::size_t dim = 1; dim < header.shape.size(); ++dim)
+            {
+                numCols *= header.shape[dim];
+            }
+
+            if (header.fortranOrder && header.shape.size() > 1 && numCols > 1 && header.shape.front() > 1)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("fortran ordered files can not be read in row chunks");
+            }
+
+            if (numCols == 0 || numCols > std::numeric_limits<uint32>::max())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("npy file has an unsupported number of columns");
+            }
+
+            numRows_ = header.shape.empty() ? 1 : header.shape.front();
+            numCols_ = static_cast<uint32>(numCols);
+            start(inChunkRows);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Constructor for raw binary files
+        ///
+        /// @param inFilename
+        /// @param inNumCols: the number of columns of each row in the file
+        /// @param inChunkRows: the number of rows in each chunk
+        /// @param inEndianess: the byte order of the file. default NATIVE
+        ///
+        ChunkReader(const std::string& inFilename,
+                    uint32             inNumCols,
+                    uint32             inChunkRows,
+                    Endian             inEndianess = Endian::NATIVE)
+        {
+            if (inNumCols == 0)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("number of columns must be greater than zero.");
+            }
+
+            open(inFilename);
+
+            file_.seekg(0, std::ifstream::end);
+            const auto fileSize = static_cast<uint64>(file_.tellg());
+            file_.seekg(0, std::ifstream::beg);
+
+            const auto rowBytes = static_cast<uint64>(inNumCols) * sizeof(dtype);
+            if (fileSize % rowBytes != 0)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("file size is not a whole number of rows\n\t" + inFilename);
+            }
+
+            numRows_  = fileSize / rowBytes;
+            numCols_  = inNumCols;
+            byteSwap_ = sizeof(dtype) > 1 && inEndianess != Endian::NATIVE &&
+                        (inEndianess == Endian::LITTLE) != endian::isLittleEndian();
+            start(inChunkRows);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Copy Constructor, not allowed
+        ///
+        ChunkReader(const ChunkReader&) = delete;
+
+        //============================================================================
+        // Method Description:
+        /// Move Constructor, not allowed
+        ///
+        ChunkReader(ChunkReader&&) = delete;
+
+        //============================================================================
+        // Method Description:
+        /// Destructor, stops the read ahead thread
+        ///
+        ~ChunkReader() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            condition_.notify_all();
+
+            if (worker_.joinable())
+            {
+                worker_.join();
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Copy Assignment, not allowed
+        ///
+        ChunkReader& operator=(const ChunkReader&) = delete;
+
+        //============================================================================
+        // Method Description:
+        /// Move Assignment, not allowed
+        ///
+        ChunkReader& operator=(ChunkReader&&) = delete;
+
+        //============================================================================
+        // Method Description:
+        /// Returns the next chunk of rows. The chunk is swapped with the array
+        /// passed in, whose memory is reused for a later read, so passing the
+        /// previous chunk back in avoids any allocation once the reader is running.
+        ///
+        /// @param outChunk: overwritten with the next chunk
+        /// @return false once all of the rows have been read
+        ///
+        bool next(NdArray<dtype>& outChunk)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this] { return ready_[readSlot_] || done_; });
+            if (!ready_[readSlot_])
+            {
+                if (error_)
+                {
+                    std::rethrow_exception(error_);
+                }
+
+                return false;
+            }
+
+            std::swap(outChunk, buffers_[readSlot_]);
+            ready_[readSlot_] = false;
+            readSlot_ ^= 1;
+            lock.unlock();
+
+            condition_.notify_all();
+            return true;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the number of rows in the file
+        ///
+        /// @return number of rows
+        ///
+        [[nodiscard]] uint64 numRows() const noexcept
+        {
+            return numRows_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the number of columns of each chunk
+        ///
+        /// @return number of columns
+        ///
+        [[nodiscard]] uint32 numCols() const noexcept
+        {
+            return numCols_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the number of rows of each chunk
+        ///
+        /// @return number of rows
+        ///
+        [[nodiscard]] uint32 chunkRows() const noexcept
+        {
+            return chunkRows_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the number of chunks in the file
+        ///
+        /// @return number of chunks
+        ///
+        [[nodiscard]] uint64 numChunks() const noexcept
+        {
+            return (numRows_ + chunkRows_ - 1) / chunkRows_;
+        }
+
+    private:
+        //==============================Attributes====================================
+        std::ifstream                 file_{};
+        uint64                        numRows_{ 0 };
+        uint32                        numCols_{ 0 };
+        uint32                        chunkRows_{ 0 };
+        bool                          byteSwap_{ false };
+        std::array<NdArray<dtype>, 2> buffers_{};
+        std::array<bool, 2>           ready_{ false, false };
+        uint32                        readSlot_{ 0 };
+        bool                          done_{ false };
+        bool                          stop_{ false };
+        std::exception_ptr            error_{};
+        std::mutex                    mutex_{};
+        std::condition_variable       condition_{};
+        std::thread                   worker_{};
+
+        //============================================================================
+        // Method Description:
+        /// Opens the file
+        ///
+        /// @param inFilename
+        ///
+        void open(const std::string& inFilename)
+        {
+            file_.open(inFilename.c_str(), std::ios::in | std::ios::binary);
+            if (!file_.is_open())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("unable to open file\n\t" + inFilename);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Starts the read ahead thread
+        ///
+        /// @param inChunkRows
+        ///
+        void start(uint32 inChunkRows)
+        {
+            if (inChunkRows == 0)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("chunk rows must be greater than zero.");
+            }
+
+            chunkRows_ = inChunkRows;
+            worker_    = std::thread(&ChunkReader::readAhead, this);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Body of the read ahead thread, fills the two buffers in turn as the
+        /// consumer releases them
+        ///
+        void readAhead()
+        {
+            uint32 slot = 0;
+            for (uint64 row = 0; row < numRows_; row += chunkRows_)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    condition_.wait(lock, [this, slot] { return stop_ || !ready_[slot]; });
+                    if (stop_)
+                    {
+                        return;
+                    }
+                }
+
+                try
+                {
+                    const auto rows   = static_cast<uint32>(std::min<uint64>(chunkRows_, numRows_ - row));
+                    auto&      buffer = buffers_[slot];
+                    if (!buffer.ownsInternalData() || buffer.shape() != Shape(rows, numCols_))
+                    {
+                        buffer = NdArray<dtype>(rows, numCols_);
+                    }
+
+                    file_.read(reinterpret_cast<char*>(buffer.data()),
+                               static_cast<std::streamsize>(buffer.size() * sizeof(dtype)));
+                    if (file_.fail())
+                    {
+                        THROW_RUNTIME_ERROR("error occured while reading the file");
+                    }
+
+                    if (byteSwap_)
+                    {
+                        npy::byteSwap(buffer.data(), buffer.size());
+                    }
+                }
+                catch (...)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        error_ = std::current_exception();
+                        done_  = true;
+                    }
+                    condition_.notify_all();
+                    return;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    ready_[slot] = true;
+                }
+                condition_.notify_all();
+                slot ^= 1;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_ = true;
+            }
+            condition_.notify_all();
+        }
+    };
+} // namespace nc
@@ -0,0 +1,225 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Appending writer of binary NdArray files in row chunks
+///
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/Endian.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/NpyFormat.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc
+{
+    //================================================================================
+    /// Writes an array that is too large to hold in memory one chunk of rows at a
+    /// time, to be read back with ChunkReader, load() or memmap().
+    ///
+    /// Filenames ending in ".npy" are written in .npy format. Every chunk must have
+    /// the same number of columns, and the header is rewritten with the final number
+    /// of rows when the writer is closed. Any other file is appended to as raw values
+    /// in the tofile()/dump() layout, in the requested byte order.
+    template<typename dtype>
+    class ChunkWriter
+    {
+    public:
+        STATIC_ASSERT_ARITHMETIC_OR_COMPLEX(dtype);
+
+        //============================================================================
+        // Method Description:
+        /// Constructor
+        ///
+        /// @param inFilename
+        /// @param inEndianess: the byte order of raw files, .npy files are always
+        ///                     written in the native byte order. default NATIVE
+        ///
+        explicit ChunkWriter(const std::string& inFilename, Endian inEndianess = Endian::NATIVE) :
+            npy_(std::filesystem::path(inFilename).extension() == ".npy"),
+            byteSwap_(!npy_ && sizeof(dtype) > 1 && inEndianess != Endian::NATIVE &&
+                      (inEndianess == Endian::LITTLE) != endian::isLittleEndian())
+        {
+            const auto mode = npy_ ? std::ios::out | std::ios::binary | std::ios::trunc
+                                   : std::ios::out | std::ios::binary | std::ios::app;
+            file_.open(inFilename.c_str(), mode);
+            if (!file_.is_open())
+            {
+                THROW_RUNTIME_ERROR("Unable to open the input file:\n\t" + inFilename);
+            }
+
+            if (npy_)
+            {
+                // reserve room for the largest header, the final one is padded to the same size
+                const auto header = npy::makeHeader<dtype>(
+                    std::vector<uint64>{ std::numeric_limits<uint64>::max(), std::numeric_limits<uint32>::max() });
+                headerSize_ = header.size();
+                file_.write(header.data(), static_cast<std::streamsize>(header.size()));
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Copy Constructor, not allowed
+        ///
+        ChunkWriter(const ChunkWriter&) = delete;
+
+        //============================================================================
+        // Method Description:
+        /// Move Constructor, not allowed
+        ///
+        ChunkWriter(ChunkWriter&&) = delete;
+
+        //============================================================================
+        // Method Description:
+        /// Destructor, closes the file
+        ///
+        ~ChunkWriter() noexcept
+        {
+            try
+            {
+                close();
+            }
+            catch (...)
+            {
+                // destructors can not throw, call close() to be notified of errors
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Copy Assignment, not allowed
+        ///
+        ChunkWriter& operator=(const ChunkWriter&) = delete;
+
+        //============================================================================
+        // Method Description:
+        /// Move Assignment, not allowed
+        ///
+        ChunkWriter& operator=(ChunkWriter&&) = delete;
+
+        //============================================================================
+        // Method Description:
+        /// Appends the rows of the chunk to the file
+        ///
+        /// @param inChunk
+        ///
+        void write(const NdArray<dtype>& inChunk)
+        {
+            if (!file_.is_open())
+            {
+                THROW_RUNTIME_ERROR("the writer has been closed.");
+            }
+
+            if (inChunk.isempty())
+            {
+                return;
+            }
+
+            if (npy_)
+            {
+                if (numCols_ == 0)
+                {
+                    numCols_ = inChunk.numCols();
+                }
+                else if (inChunk.numCols() != numCols_)
+                {
+                    THROW_INVALID_ARGUMENT_ERROR("all chunks of an npy file must have the same number of columns.");
+                }
+            }
+
+            const auto* data = inChunk.data();
+            if (byteSwap_)
+            {
+                scratch_.assign(inChunk.cbegin(), inChunk.cend());
+                npy::byteSwap(scratch_.data(), scratch_.size());
+                data = scratch_.data();
+            }
+
+            file_.write(reinterpret_cast<const char*>(data),
+                        static_cast<std::streamsize>(inChunk.size() * sizeof(dtype)));
+            if (!file_.good())
+            {
+                THROW_RUNTIME_ERROR("error occured while writing the file");
+            }
+
+            numRows_ += inChunk.numRows();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Writes the final .npy header and closes the file. Called by the destructor.
+        ///
+        void close()
+        {
+            if (!file_.is_open())
+            {
+                return;
+            }
+
+            if (npy_)
+            {
+                const auto header = npy::makeHeader<dtype>(std::vector<uint64>{ numRows_, numCols_ }, headerSize_);
+                file_.seekp(0, std::ios::beg);
+                file_.write(header.data(), static_cast<std::streamsize>(header.size()));
+            }
+
+            file_.close();
+            if (file_.fail())
+            {
+                THROW_RUNTIME_ERROR("error occured while closing the file");
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the number of rows written by this writer
+        ///
+        /// @return number of rows
+        ///
+        [[nodiscard]] uint64 numRows() const noexcept
+        {
+            return numRows_;
+        }
+
+    private:
+        //==============================Attributes====================================
+        std::ofstream      file_{};
+        bool               npy_{ false };
+        bool               byteSwap_{ false };
+        uint64             headerSize_{ 0 };
+        uint64             numRows_{ 0 };
+        uint32             numCols_{ 0 };
+        std::vector<dtype> scratch_{};
+    };
+} // namespace nc
@@ -27,12 +27,20 @@
 ///
 #pragma once
 
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <limits>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "NumCpp/Core/Enums.hpp"
 #include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/FileMapping.hpp"
+#include "NumCpp/Core/Internal/NpyFormat.hpp"
+#include "NumCpp/Core/Internal/ParallelFor.hpp"
 #include "NumCpp/Core/Shape.hpp"
 #include "NumCpp/Core/Slice.hpp"
 #include "NumCpp/Core/Types.hpp"
@@ -42,13 +50,25 @@ namespace nc
 {
     //================================================================================
     /// Convenience container for holding a uniform array of NdArrays
+    ///
+    /// By default every frame is a separate NdArray and the cube grows with push_back.
+    /// A cube constructed with a frame shape and depth instead stores all of its
+    /// values in one contiguous buffer, either frame by frame (FRAME_MAJOR) or with
+    /// the time series of each pixel adjacent (PIXEL_MAJOR), and a cube constructed
+    /// from a file maps that buffer straight from disk. Contiguous cubes have a
+    /// fixed size and hand out O(1) strided views of frames and pixel time series
+    /// with frameView() and pixelView(). Frames of a PIXEL_MAJOR cube are not stored
+    /// as NdArrays, so the NdArray returning accessors and iterators throw for a
+    /// PIXEL_MAJOR cube. Assigning a whole NdArray to a frame of a contiguous cube
+    /// gives that frame its own storage, write frames with frameView(index).assign()
+    /// instead.
     template<typename dtype>
     class DataCube
     {
     public:
         //================================Typedefs==================================
-        using iterator       = typename std::deque<NdArray<dtype>>::iterator;
-        using const_iterator = typename std::deque<NdArray<dtype>>::const_iterator;
+        using iterator       = typename std::vector<NdArray<dtype>>::iterator;
+        using const_iterator = typename std::vector<NdArray<dtype>>::const_iterator;
 
         //============================================================================
         /// Default Constructor
@@ -65,6 +85,178 @@ namespace nc
             cube_.reserve(inSize);
         }
 
+        //============================================================================
+        /// Constructor, a fixed size cube of zeros in a single contiguous buffer
+        ///
+        /// @param inFrameShape: the x/y shape of each frame
+        /// @param inSizeZ: the number of frames
+        /// @param inLayout: the memory order of the buffer. default FRAME_MAJOR
+        ///
+        DataCube(const Shape& inFrameShape, uint32 inSizeZ, CubeLayout inLayout = CubeLayout::FRAME_MAJOR) :
+            elementShape_(inFrameShape),
+            layout_(inLayout),
+            sizeZ_(inSizeZ)
+        {
+            checkFrameShape(inFrameShape.rows, inFrameShape.cols);
+            storage_ = std::make_unique<dtype[]>(numElements());
+            attach(storage_.get());
+        }
+
+        //============================================================================
+        /// Constructor, memory maps a 3d .npy file, as written by save(). Pages are
+        /// only read from disk when they are touched, so cubes much larger than the
+        /// available memory can be opened and sliced.
+        ///
+        /// @param inFilename
+        /// @param inLayout: FRAME_MAJOR reads the file shape as (z, rows, cols),
+        ///                  PIXEL_MAJOR as (rows, cols, z). default FRAME_MAJOR
+        /// @param inMode: COPY_ON_WRITE keeps modifications private to the process,
+        ///                READ_WRITE writes them back to the file. default COPY_ON_WRITE
+        ///
+        explicit DataCube(const std::string& inFilename,
+                          CubeLayout         inLayout = CubeLayout::FRAME_MAJOR,
+                          MapMode            inMode   = MapMode::COPY_ON_WRITE) :
+            layout_(inLayout),
+            mapping_(inFilename, inMode)
+        {
+            if (!npy::isNpy(mapping_.data(), mapping_.size()))
+            {
+                THROW_INVALID_ARGUMENT_ERROR("a frame shape is required to map a file that is not .npy");
+            }
+
+            const auto header = npy::parseHeader(mapping_.data(), mapping_.size());
+            if (npy::byteSwapRequired<dtype>(header))
+            {
+                THROW_INVALID_ARGUMENT_ERROR("only files in the native byte order can be memory mapped");
+            }
+
+            if (header.shape.size() != 3 || header.fortranOrder)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("only 3d C ordered .npy files can be mapped to a DataCube");
+            }
+
+            const bool frameMajor = layout_ == CubeLayout::FRAME_MAJOR;
+            const auto numRows    = header.shape[frameMajor ? 1 : 0];
+            const auto numCols    = header.shape[frameMajor ? 2 : 1];
+            const auto numFrames  = header.shape[frameMajor ? 0 : 2];
+            checkFrameShape(numRows, numCols);
+            if (numFrames > std::numeric_limits<uint32>::max())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("cube depth exceeds the maximum number of frames");
+            }
+
+            elementShape_ = Shape(static_cast<uint32>(numRows), static_cast<uint32>(numCols));
+            sizeZ_        = static_cast<uint32>(numFrames);
+            mapData(header.dataOffset);
+        }
+
+        //============================================================================
+        /// Constructor, memory maps a raw binary file, as written by dump(). The
+        /// depth of the cube is the number of whole frames in the file.
+        ///
+        /// @param inFilename
+        /// @param inFrameShape: the x/y shape of each frame
+        /// @param inLayout: the memory order of the file. default FRAME_MAJOR
+        /// @param inMode: COPY_ON_WRITE keeps modifications private to the process,
+        ///                READ_WRITE writes them back to the file. default COPY_ON_WRITE
+        ///
+        DataCube(const std::string& inFilename,
+                 const Shape&       inFrameShape,
+                 CubeLayout         inLayout = CubeLayout::FRAME_MAJOR,
+                 MapMode            inMode   = MapMode::COPY_ON_WRITE) :
+            elementShape_(inFrameShape),
+            layout_(inLayout),
+            mapping_(inFilename, inMode)
+        {
+            checkFrameShape(inFrameShape.rows, inFrameShape.cols);
+            const auto numFrames = mapping_.size() / (sizeof(dtype) * inFrameShape.size());
+            if (numFrames > std::numeric_limits<uint32>::max())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("cube depth exceeds the maximum number of frames");
+            }
+
+            sizeZ_ = static_cast<uint32>(numFrames);
+            mapData(0);
+        }
+
+        //============================================================================
+        /// Copy Constructor, the copy of a contiguous cube always lives in memory
+        ///
+        /// @param inOtherCube
+        ///
+        DataCube(const DataCube<dtype>& inOtherCube) :
+            cube_(inOtherCube.iscontiguous() ? std::vector<NdArray<dtype>>{} : inOtherCube.cube_),
+            elementShape_(inOtherCube.elementShape_),
+            layout_(inOtherCube.layout_),
+            sizeZ_(inOtherCube.sizeZ_)
+        {
+            if (inOtherCube.iscontiguous())
+            {
+                storage_.reset(new dtype[numElements()]);
+                std::copy(inOtherCube.data_, inOtherCube.data_ + numElements(), storage_.get());
+                attach(storage_.get());
+            }
+        }
+
+        //============================================================================
+        /// Move Constructor
+        ///
+        /// @param inOtherCube
+        ///
+        DataCube(DataCube<dtype>&& inOtherCube) noexcept :
+            cube_(std::move(inOtherCube.cube_)),
+            elementShape_(std::exchange(inOtherCube.elementShape_, Shape(0, 0))),
+            layout_(inOtherCube.layout_),
+            storage_(std::move(inOtherCube.storage_)),
+            mapping_(std::move(inOtherCube.mapping_)),
+            data_(std::exchange(inOtherCube.data_, nullptr)),
+            sizeZ_(std::exchange(inOtherCube.sizeZ_, 0))
+        {
+        }
+
+        //============================================================================
+        /// Destructor
+        ///
+        ~DataCube() = default;
+
+        //============================================================================
+        /// Copy Assignment
+        ///
+        /// @param rhs
+        /// @return DataCube
+        ///
+        DataCube<dtype>& operator=(const DataCube<dtype>& rhs)
+        {
+            if (&rhs != this)
+            {
+                *this = DataCube<dtype>(rhs);
+            }
+
+            return *this;
+        }
+
+        //============================================================================
+        /// Move Assignment
+        ///
+        /// @param rhs
+        /// @return DataCube
+        ///
+        DataCube<dtype>& operator=(DataCube<dtype>&& rhs) noexcept
+        {
+            if (&rhs != this)
+            {
+                cube_         = std::move(rhs.cube_);
+                elementShape_ = std::exchange(rhs.elementShape_, Shape(0, 0));
+                layout_       = rhs.layout_;
+                storage_      = std::move(rhs.storage_);
+                mapping_      = std::move(rhs.mapping_);
+                data_         = std::exchange(rhs.data_, nullptr);
+                sizeZ_        = std::exchange(rhs.sizeZ_, 0);
+            }
+
+            return *this;
+        }
+
         //============================================================================
         /// Access method, with bounds checking. Returns the 2d z "slice" element of the cube.
         ///
@@ -74,6 +266,7 @@ namespace nc
         ///
         NdArray<dtype>& at(uint32 inIndex)
         {
+            checkFrameArrays();
             return cube_.at(inIndex);
         }
 
@@ -86,6 +279,7 @@ namespace nc
         ///
         [[nodiscard]] const NdArray<dtype>& at(uint32 inIndex) const
         {
+            checkFrameArrays();
             return cube_.at(inIndex);
         }
 
@@ -94,8 +288,9 @@ namespace nc
         ///
         /// @return NdArray&
         ///
-        NdArray<dtype>& back() noexcept
+        NdArray<dtype>& back()
         {
+            checkFrameArrays();
             return cube_.back();
         }
 
@@ -104,8 +299,9 @@ namespace nc
         ///
         /// @return iterator
         ///
-        [[nodiscard]] iterator begin() noexcept
+        [[nodiscard]] iterator begin()
         {
+            checkFrameArrays();
             return cube_.begin();
         }
 
@@ -114,8 +310,9 @@ namespace nc
         ///
         /// @return const_iterator
         ///
-        [[nodiscard]] const_iterator begin() const noexcept
+        [[nodiscard]] const_iterator begin() const
         {
+            checkFrameArrays();
             return cube_.cbegin();
         }
 
@@ -124,8 +321,9 @@ namespace nc
         ///
         /// @return const_iterator
         ///
-        [[nodiscard]] const_iterator cbegin() const noexcept
+        [[nodiscard]] const_iterator cbegin() const
         {
+            checkFrameArrays();
             return cube_.cbegin();
         }
 
@@ -148,14 +346,100 @@ namespace nc
                 THROW_RUNTIME_ERROR("Could not open the input file:\n\t" + inFilename);
             }
 
-            for (auto& ndarray : cube_)
+            if (iscontiguous() && layout_ == CubeLayout::FRAME_MAJOR)
+            {
+                ofile.write(reinterpret_cast<const char*>(data_),
+                            static_cast<std::streamsize>(numElements() * sizeof(dtype)));
+            }
+            else if (iscontiguous())
+            {
+                for (uint32 i = 0; i < sizeZ_; ++i)
+                {
+                    const auto frame = frameView(i).copy();
+                    ofile.write(reinterpret_cast<const char*>(frame.data()), frame.size() * sizeof(dtype));
+                }
+            }
+            else
             {
-                ofile.write(reinterpret_cast<const char*>(ndarray.data()), ndarray.size() * sizeof(dtype));
+                for (auto& ndarray : cube_)
+                {
+                    ofile.write(reinterpret_cast<const char*>(ndarray.data()), ndarray.size() * sizeof(dtype));
+                }
             }
 
             ofile.close();
         }
 
+        //============================================================================
+        /// Returns a pointer to the contiguous buffer of the cube, nullptr if the
+        /// frames are stored separately
+        ///
+        /// @return pointer
+        ///
+        [[nodiscard]] dtype* data() noexcept
+        {
+            return data_;
+        }
+
+        //============================================================================
+        /// Returns a pointer to the contiguous buffer of the cube, nullptr if the
+        /// frames are stored separately
+        ///
+        /// @return pointer
+        ///
+        [[nodiscard]] const dtype* data() const noexcept
+        {
+            return data_;
+        }
+
+        //============================================================================
+        /// Writes any modifications of a READ_WRITE memory mapped cube back to its
+        /// file. Does nothing for any other cube.
+        ///
+        void flush() const
+        {
+            mapping_.flush();
+        }
+
+        //============================================================================
+        /// Returns an O(1) view of a 2d z "slice" of the cube, with bounds checking.
+        /// The view reads and writes the cube.
+        ///
+        /// @param inIndex
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<dtype> frameView(uint32 inIndex)
+        {
+            checkFrameIndex(inIndex);
+            if (!iscontiguous())
+            {
+                return cube_[inIndex].view();
+            }
+
+            return NdArrayView<dtype>(data_ + frameOffset(inIndex), elementShape_, frameRowStride(), frameColStride());
+        }
+
+        //============================================================================
+        /// Returns an O(1) read only view of a 2d z "slice" of the cube, with bounds
+        /// checking
+        ///
+        /// @param inIndex
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<const dtype> frameView(uint32 inIndex) const
+        {
+            checkFrameIndex(inIndex);
+            if (!iscontiguous())
+            {
+                return cube_[inIndex].view();
+            }
+
+            return NdArrayView<const dtype>(data_ + frameOffset(inIndex),
+                                            elementShape_,
+                                            frameRowStride(),
+                                            frameColStride());
+        }
+
         //============================================================================
         /// Tests whether or not the container is empty
         ///
@@ -163,7 +447,17 @@ namespace nc
         ///
         bool isempty() noexcept
         {
-            return cube_.empty();
+            return sizeZ() == 0;
+        }
+
+        //============================================================================
+        /// Tests whether the cube stores its values in a single contiguous buffer
+        ///
+        /// @return bool
+        ///
+        [[nodiscard]] bool iscontiguous() const noexcept
+        {
+            return data_ != nullptr;
         }
 
         //============================================================================
@@ -171,8 +465,9 @@ namespace nc
         ///
         /// @return iterator
         ///
-        [[nodiscard]] iterator end() noexcept
+        [[nodiscard]] iterator end()
         {
+            checkFrameArrays();
             return cube_.end();
         }
 
@@ -181,8 +476,9 @@ namespace nc
         ///
         /// @return const_iterator
         ///
-        [[nodiscard]] const_iterator end() const noexcept
+        [[nodiscard]] const_iterator end() const
         {
+            checkFrameArrays();
             return cube_.cend();
         }
 
@@ -191,8 +487,9 @@ namespace nc
         ///
         /// @return const_iterator
         ///
-        [[nodiscard]] const_iterator cend() const noexcept
+        [[nodiscard]] const_iterator cend() const
         {
+            checkFrameArrays();
             return cube_.cend();
         }
 
@@ -201,11 +498,131 @@ namespace nc
         ///
         /// @return NdArray&
         ///
-        NdArray<dtype>& front() noexcept
+        NdArray<dtype>& front()
         {
+            checkFrameArrays();
             return cube_.front();
         }
 
+        //============================================================================
+        /// Returns the memory order of the cube. Cubes with separately stored frames
+        /// are FRAME_MAJOR.
+        ///
+        /// @return CubeLayout
+        ///
+        [[nodiscard]] CubeLayout layout() const noexcept
+        {
+            return layout_;
+        }
+
+        //============================================================================
+        /// Returns an O(1) 1 x sizeZ view of the time series of a pixel of a
+        /// contiguous cube, with bounds checking. The view reads and writes the cube.
+        ///
+        /// @param inIndex: the flattend 2d index (row, col) of the pixel
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<dtype> pixelView(int32 inIndex)
+        {
+            const auto index = pixelIndex(inIndex);
+            return NdArrayView<dtype>(data_ + pixelOffset(index), Shape(1, sizeZ_), pixelStride(), pixelStride());
+        }
+
+        //============================================================================
+        /// Returns an O(1) 1 x sizeZ read only view of the time series of a pixel of
+        /// a contiguous cube, with bounds checking
+        ///
+        /// @param inIndex: the flattend 2d index (row, col) of the pixel
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<const dtype> pixelView(int32 inIndex) const
+        {
+            const auto index = pixelIndex(inIndex);
+            return NdArrayView<const dtype>(data_ + pixelOffset(index),
+                                            Shape(1, sizeZ_),
+                                            pixelStride(),
+                                            pixelStride());
+        }
+
+        //============================================================================
+        /// Returns an O(1) 1 x sizeZ view of the time series of a pixel of a
+        /// contiguous cube, with bounds checking. The view reads and writes the cube.
+        ///
+        /// @param inRow
+        /// @param inCol
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<dtype> pixelView(int32 inRow, int32 inCol)
+        {
+            const auto index = pixelIndex(inRow, inCol);
+            return NdArrayView<dtype>(data_ + pixelOffset(index), Shape(1, sizeZ_), pixelStride(), pixelStride());
+        }
+
+        //============================================================================
+        /// Returns an O(1) 1 x sizeZ read only view of the time series of a pixel of
+        /// a contiguous cube, with bounds checking
+        ///
+        /// @param inRow
+        /// @param inCol
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<const dtype> pixelView(int32 inRow, int32 inCol) const
+        {
+            const auto index = pixelIndex(inRow, inCol);
+            return NdArrayView<const dtype>(data_ + pixelOffset(index),
+                                            Shape(1, sizeZ_),
+                                            pixelStride(),
+                                            pixelStride());
+        }
+
+        //============================================================================
+        /// Saves the cube as a 3d .npy file that can be memory mapped back into a
+        /// DataCube. FRAME_MAJOR cubes are written with shape (z, rows, cols) and
+        /// PIXEL_MAJOR cubes with shape (rows, cols, z). If the filename has no
+        /// extension ".npy" is appended.
+        ///
+        /// @param inFilename
+        ///
+        void save(const std::string& inFilename) const
+        {
+            std::filesystem::path f(inFilename);
+            if (!f.has_extension())
+            {
+                f.replace_extension("npy");
+            }
+
+            std::ofstream ofile(f.c_str(), std::ios::binary);
+            if (!ofile.good())
+            {
+                THROW_RUNTIME_ERROR("Unable to open the input file:\n\t" + inFilename);
+            }
+
+            const uint64 numRows   = elementShape_.rows;
+            const uint64 numCols   = elementShape_.cols;
+            const uint64 numFrames = sizeZ();
+            const auto   header    = npy::makeHeader<dtype>(layout_ == CubeLayout::FRAME_MAJOR
+                                                                ? std::vector<uint64>{ numFrames, numRows, numCols }
+                                                                : std::vector<uint64>{ numRows, numCols, numFrames });
+            ofile.write(header.data(), static_cast<std::streamsize>(header.size()));
+            if (iscontiguous())
+            {
+                ofile.write(reinterpret_cast<const char*>(data_),
+                            static_cast<std::streamsize>(numElements() * sizeof(dtype)));
+            }
+            else
+            {
+                for (auto& ndarray : cube_)
+                {
+                    ofile.write(reinterpret_cast<const char*>(ndarray.data()), ndarray.size() * sizeof(dtype));
+                }
+            }
+
+            if (!ofile.good())
+            {
+                THROW_RUNTIME_ERROR("error occured while writing the file\n\t" + inFilename);
+            }
+        }
+
         //============================================================================
         /// Returns the x/y shape of the cube
         ///
@@ -223,14 +640,69 @@ namespace nc
         ///
         [[nodiscard]] uint32 sizeZ() const noexcept
         {
-            return static_cast<uint32>(cube_.size());
+            return iscontiguous() ? sizeZ_ : static_cast<uint32>(cube_.size());
+        }
+
+        //============================================================================
+        /// Returns a contiguous copy of the cube in the input memory order. The
+        /// frames are transposed in cache sized blocks, across threads when
+        /// NUMCPP_USE_MULTITHREAD is defined.
+        ///
+        /// @param inLayout
+        /// @return DataCube
+        ///
+        [[nodiscard]] DataCube<dtype> toLayout(CubeLayout inLayout) const
+        {
+            DataCube<dtype> returnCube;
+            returnCube.elementShape_ = elementShape_;
+            returnCube.layout_       = inLayout;
+            returnCube.sizeZ_        = sizeZ();
+            returnCube.storage_.reset(new dtype[returnCube.numElements()]);
+
+            dtype*     outData   = returnCube.storage_.get();
+            const auto frameSize = static_cast<uint64>(elementShape_.size());
+            if (iscontiguous() && inLayout == layout_)
+            {
+                std::copy(data_, data_ + numElements(), outData);
+            }
+            else if (inLayout == CubeLayout::FRAME_MAJOR && !iscontiguous())
+            {
+                for (uint32 i = 0; i < sizeZ(); ++i)
+                {
+                    std::copy(cube_[i].begin(), cube_[i].end(), outData + i * frameSize);
+                }
+            }
+            else if (layout_ == CubeLayout::FRAME_MAJOR)
+            {
+                transposeBlocked([this, frameSize](uint64 inZ)
+                                 { return iscontiguous() ? data_ + inZ * frameSize : cube_[inZ].data(); },
+                                 sizeZ(),
+                                 frameSize,
+                                 outData);
+            }
+            else
+            {
+                const uint64 numFrames = sizeZ_;
+                transposeBlocked([this, numFrames](uint64 inPixel) { return data_ + inPixel * numFrames; },
+                                 frameSize,
+                                 numFrames,
+                                 outData);
+            }
+
+            returnCube.attach(outData);
+            return returnCube;
         }
 
         //============================================================================
         /// Removes the last z "slice" of the cube
         ///
-        void pop_back() noexcept
+        void pop_back()
         {
+            if (iscontiguous())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("contiguous cubes have a fixed size");
+            }
+
             cube_.pop_back();
         }
 
@@ -241,6 +713,11 @@ namespace nc
         ///
         void push_back(const NdArray<dtype>& inArray)
         {
+            if (iscontiguous())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("contiguous cubes have a fixed size");
+            }
+
             const Shape inputShape = inArray.shape();
 
             if (elementShape_.rows == 0 && elementShape_.cols == 0)
@@ -275,7 +752,7 @@ namespace nc
 
             for (uint32 i = 0; i < sizeZ(); ++i)
             {
-                returnArray[i] = cube_[i][inIndex];
+                returnArray[i] = value(i, static_cast<uint32>(inIndex));
             }
 
             return returnArray;
@@ -300,7 +777,7 @@ namespace nc
             uint32 idx = 0;
             for (int32 i = inSliceZ.start; i < inSliceZ.stop; i += inSliceZ.step)
             {
-                returnArray[idx++] = cube_[i][inIndex];
+                returnArray[idx++] = value(static_cast<uint32>(i), static_cast<uint32>(inIndex));
             }
 
             return returnArray;
@@ -329,7 +806,7 @@ namespace nc
 
             for (uint32 i = 0; i < sizeZ(); ++i)
             {
-                returnArray[i] = cube_[i](inRow, inCol);
+                returnArray[i] = value(i, pixelIndexUnchecked(inRow, inCol));
             }
 
             return returnArray;
@@ -360,7 +837,7 @@ namespace nc
             uint32 idx = 0;
             for (int32 i = inSliceZ.start; i < inSliceZ.stop; i += inSliceZ.step)
             {
-                returnArray[idx++] = cube_[i](inRow, inCol);
+                returnArray[idx++] = value(static_cast<uint32>(i), pixelIndexUnchecked(inRow, inCol));
             }
 
             return returnArray;
@@ -383,7 +860,7 @@ namespace nc
             NdArray<dtype> returnArray(inRow.numElements(elementShape_.rows), sizeZ());
             for (uint32 i = 0; i < sizeZ(); ++i)
             {
-                returnArray.put(returnArray.rSlice(), i, cube_[i](inRow, inCol));
+                returnArray.put(returnArray.rSlice(), i, frameSlice(i, inRow, inCol));
             }
 
             return returnArray;
@@ -408,7 +885,7 @@ namespace nc
             uint32         idx = 0;
             for (int32 i = inSliceZ.start; i < inSliceZ.stop; i += inSliceZ.step)
             {
-                returnArray.put(returnArray.rSlice(), idx++, cube_[i](inRow, inCol));
+                returnArray.put(returnArray.rSlice(), idx++, frameSlice(static_cast<uint32>(i), inRow, inCol));
             }
 
             return returnArray;
@@ -431,7 +908,7 @@ namespace nc
             NdArray<dtype> returnArray(inCol.numElements(elementShape_.cols), sizeZ());
             for (uint32 i = 0; i < sizeZ(); ++i)
             {
-                returnArray.put(returnArray.rSlice(), i, cube_[i](inRow, inCol));
+                returnArray.put(returnArray.rSlice(), i, frameSlice(i, inRow, inCol));
             }
 
             return returnArray;
@@ -456,7 +933,7 @@ namespace nc
             uint32         idx = 0;
             for (int32 i = inSliceZ.start; i < inSliceZ.stop; i += inSliceZ.step)
             {
-                returnArray.put(returnArray.rSlice(), idx++, cube_[i](inRow, inCol));
+                returnArray.put(returnArray.rSlice(), idx++, frameSlice(static_cast<uint32>(i), inRow, inCol));
             }
 
             return returnArray;
@@ -474,7 +951,7 @@ namespace nc
             DataCube<dtype> returnCube(sizeZ());
             for (uint32 i = 0; i < sizeZ(); ++i)
             {
-                returnCube.push_back(cube_[i](inRow, inCol));
+                returnCube.push_back(frameSlice(i, inRow, inCol));
             }
 
             return returnCube;
@@ -493,7 +970,7 @@ namespace nc
             DataCube<dtype> returnCube(inSliceZ.numElements(sizeZ()));
             for (int32 i = inSliceZ.start; i < inSliceZ.stop; i += inSliceZ.step)
             {
-                returnCube.push_back(cube_[i](inRow, inCol));
+                returnCube.push_back(frameSlice(static_cast<uint32>(i), inRow, inCol));
             }
 
             return returnCube;
@@ -802,8 +1279,9 @@ namespace nc
         ///
         /// @return NdArray
         ///
-        NdArray<dtype>& operator[](uint32 inIndex) noexcept
+        NdArray<dtype>& operator[](uint32 inIndex)
         {
+            checkFrameArrays();
             return cube_[inIndex];
         }
 
@@ -814,8 +1292,9 @@ namespace nc
         ///
         /// @return NdArray
         ///
-        const NdArray<dtype>& operator[](uint32 inIndex) const noexcept
+        const NdArray<dtype>& operator[](uint32 inIndex) const
         {
+            checkFrameArrays();
             return cube_[inIndex];
         }
 
@@ -823,5 +1302,329 @@ namespace nc
         //================================Attributes==================================
         std::vector<NdArray<dtype>> cube_{};
         Shape                       elementShape_{ 0, 0 };
+        CubeLayout                  layout_{ CubeLayout::FRAME_MAJOR };
+        std::unique_ptr<dtype[]>    storage_{};
+        mapping::FileMapping        mapping_{};
+        dtype*                      data_{ nullptr };
+        uint32                      sizeZ_{ 0 };
+
+        //============================================================================
+        /// Validates the frame shape of a contiguous cube
+        ///
+        /// @param inNumRows
+        /// @param inNumCols
+        ///
+        static void checkFrameShape(uint64 inNumRows, uint64 inNumCols)
+        {
+            if (inNumRows == 0 || inNumCols == 0)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("frame shape must not be empty");
+            }
+
+            if (inNumRows * inNumCols > std::numeric_limits<uint32>::max())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("frame shape exceeds the maximum size of an NdArray");
+            }
+        }
+
+        //============================================================================
+        /// Points the cube at the data of the mapped file
+        ///
+        /// @param inDataOffset: byte offset of the first value in the file
+        ///
+        void mapData(uint64 inDataOffset)
+        {
+            if (inDataOffset % alignof(dtype) != 0 ||
+                inDataOffset + numElements() * sizeof(dtype) > mapping_.size() || sizeZ_ == 0)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("file data is misaligned, truncated, or empty");
+            }
+
+            attach(reinterpret_cast<dtype*>(mapping_.data() + inDataOffset));
+        }
+
+        //============================================================================
+        /// Points the cube at its contiguous buffer. FRAME_MAJOR cubes also get a
+        /// non-owning NdArray for each frame.
+        ///
+        /// @param inData
+        ///
+        void attach(dtype* inData)
+        {
+            data_ = inData;
+            cube_.clear();
+            if (layout_ == CubeLayout::FRAME_MAJOR)
+            {
+                cube_.reserve(sizeZ_);
+                for (uint32 i = 0; i < sizeZ_; ++i)
+                {
+                    cube_.emplace_back(data_ + frameOffset(i),
+                                       elementShape_.rows,
+                                       elementShape_.cols,
+                                       PointerPolicy::SHELL);
+                }
+            }
+        }
+
+        //============================================================================
+        /// Throws if the frames are not stored as NdArrays
+        ///
+        void checkFrameArrays() const
+        {
+            if (iscontiguous() && layout_ == CubeLayout::PIXEL_MAJOR)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("frames of a PIXEL_MAJOR cube are only available with frameView()");
+            }
+        }
+
+        //============================================================================
+        /// Throws if the frame index is out of bounds
+        ///
+        /// @param inIndex
+        ///
+        void checkFrameIndex(uint32 inIndex) const
+        {
+            if (inIndex >= sizeZ())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("frame index exceeds the cube dimensions.");
+            }
+        }
+
+        //============================================================================
+        /// The number of values in the cube
+        ///
+        /// @return uint64
+        ///
+        [[nodiscard]] uint64 numElements() const noexcept
+        {
+            return static_cast<uint64>(elementShape_.size()) * sizeZ_;
+        }
+
+        //============================================================================
+        /// Offset of the first value of a frame in the contiguous buffer
+        ///
+        /// @param inIndex
+        /// @return uint64
+        ///
+        [[nodiscard]] uint64 frameOffset(uint32 inIndex) const noexcept
+        {
+            return layout_ == CubeLayout::FRAME_MAJOR ? static_cast<uint64>(inIndex) * elementShape_.size() : inIndex;
+        }
+
+        //============================================================================
+        /// Elements between the rows of a frame in the contiguous buffer
+        ///
+        /// @return uint32
+        ///
+        [[nodiscard]] uint32 frameRowStride() const
+        {
+            if (layout_ == CubeLayout::FRAME_MAJOR)
+            {
+                return elementShape_.cols;
+            }
+
+            const auto rowStride = static_cast<uint64>(elementShape_.cols) * sizeZ_;
+            if (rowStride > std::numeric_limits<uint32>::max())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("frame rows are too far apart for a view, use toLayout(FRAME_MAJOR)");
+            }
+
+            return static_cast<uint32>(rowStride);
+        }
+
+        //============================================================================
+        /// Elements between the columns of a frame in the contiguous buffer
+        ///
+        /// @return uint32
+        ///
+        [[nodiscard]] uint32 frameColStride() const noexcept
+        {
+            return layout_ == CubeLayout::FRAME_MAJOR ? 1 : sizeZ_;
+        }
+
+        //============================================================================
+        /// Offset of the first value of a pixel time series in the contiguous buffer
+        ///
+        /// @param inIndex: the flattend 2d index (row, col) of the pixel
+        /// @return uint64
+        ///
+        [[nodiscard]] uint64 pixelOffset(uint32 inIndex) const noexcept
+        {
+            return layout_ == CubeLayout::FRAME_MAJOR ? inIndex : static_cast<uint64>(inIndex) * sizeZ_;
+        }
+
+        //============================================================================
+        /// Elements between consecutive values of a pixel time series in the
+        /// contiguous buffer
+        ///
+        /// @return uint32
+        ///
+        [[nodiscard]] uint32 pixelStride() const noexcept
+        {
+            return layout_ == CubeLayout::FRAME_MAJOR ? elementShape_.size() : 1;
+        }
+
+        //============================================================================
+        /// Validates a flattened pixel index for pixelView
+        ///
+        /// @param inIndex
+        /// @return uint32
+        ///
+        [[nodiscard]] uint32 pixelIndex(int32 inIndex) const
+        {
+            if (!iscontiguous())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("pixel views require a contiguous cube");
+            }
+
+            const auto index = inIndex < 0 ? static_cast<int64>(inIndex) + elementShape_.size() : inIndex;
+            if (index < 0 || index >= static_cast<int64>(elementShape_.size()))
+            {
+                THROW_INVALID_ARGUMENT_ERROR("inIndex exceeds matrix dimensions.");
+            }
+
+            return static_cast<uint32>(index);
+        }
+
+        //============================================================================
+        /// Validates a (row, col) pixel index for pixelView
+        ///
+        /// @param inRow
+        /// @param inCol
+        /// @return uint32
+        ///
+        [[nodiscard]] uint32 pixelIndex(int32 inRow, int32 inCol) const
+        {
+            if (!iscontiguous())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("pixel views require a contiguous cube");
+            }
+
+            const auto row = inRow < 0 ? static_cast<int64>(inRow) + elementShape_.rows : inRow;
+            const auto col = inCol < 0 ? static_cast<int64>(inCol) + elementShape_.cols : inCol;
+            if (row < 0 || row >= static_cast<int64>(elementShape_.rows))
+            {
+                THROW_INVALID_ARGUMENT_ERROR("inRow exceeds matrix dimensions.");
+            }
+
+            if (col < 0 || col >= static_cast<int64>(elementShape_.cols))
+            {
+                THROW_INVALID_ARGUMENT_ERROR("inCol exceeds matrix dimensions.");
+            }
+
+            return static_cast<uint32>(row) * elementShape_.cols + static_cast<uint32>(col);
+        }
+
+        //============================================================================
+        /// Flattened pixel index with NO bounds checking
+        ///
+        /// @param inRow
+        /// @param inCol
+        /// @return uint32
+        ///
+        [[nodiscard]] uint32 pixelIndexUnchecked(int32 inRow, int32 inCol) const noexcept
+        {
+            return static_cast<uint32>(inRow) * elementShape_.cols + static_cast<uint32>(inCol);
+        }
+
+        //============================================================================
+        /// A single value of the cube with NO bounds checking
+        ///
+        /// @param inZ
+        /// @param inIndex: the flattend 2d index (row, col) of the pixel
+        /// @return value
+        ///
+        [[nodiscard]] const dtype& value(uint32 inZ, uint32 inIndex) const noexcept
+        {
+            if (!iscontiguous())
+            {
+                return cube_[inZ][inIndex];
+            }
+
+            return data_[frameOffset(inZ) + pixelOffset(inIndex)];
+        }
+
+        //============================================================================
+        /// A 2d slice of a frame
+        ///
+        /// @param inZ
+        /// @param inRow
+        /// @param inCol
+        /// @return NdArray
+        ///
+        template<typename RowIndex, typename ColIndex>
+        [[nodiscard]] NdArray<dtype> frameSlice(uint32 inZ, RowIndex inRow, ColIndex inCol) const
+        {
+            if (!cube_.empty())
+            {
+                return cube_[inZ](inRow, inCol);
+            }
+
+            return frameView(inZ).view(toSlice(inRow), toSlice(inCol)).copy();
+        }
+
+        //============================================================================
+        /// Slice of a single index
+        ///
+        /// @param inIndex
+        /// @return Slice
+        ///
+        static Slice toSlice(int32 inIndex) noexcept
+        {
+            return Slice(inIndex, inIndex + 1);
+        }
+
+        //============================================================================
+        /// Slice passthrough
+        ///
+        /// @param inSlice
+        /// @return Slice
+        ///
+        static Slice toSlice(Slice inSlice) noexcept
+        {
+            return inSlice;
+        }
+
+        //============================================================================
+        /// Transposes a row major matrix into outData in cache sized blocks,
+        /// outData[c * inNumRows + r] = inRowPointer(r)[c]
+        ///
+        /// @param inRowPointer: returns a pointer to the first value of a row
+        /// @param inNumRows
+        /// @param inNumCols
+        /// @param outData
+        ///
+        template<typename RowPointer>
+        static void transposeBlocked(RowPointer inRowPointer, uint64 inNumRows, uint64 inNumCols, dtype* outData)
+        {
+            constexpr uint64 BLOCK_SIZE   = 64;
+            const auto       numColBlocks = static_cast<uint32>((inNumCols + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+            parallel::parallelFor(numColBlocks,
+                                  [&](uint32 colBlock)
+                                  {
+                                      const uint64 colStart = colBlock * BLOCK_SIZE;
+                                      const uint64 colEnd   = std::min(colStart + BLOCK_SIZE, inNumCols);
+                                      const dtype* rowData[BLOCK_SIZE];
+                                      for (uint64 rowStart = 0; rowStart < inNumRows; rowStart += BLOCK_SIZE)
+                                      {
+                                          const uint64 numRows = std::min(BLOCK_SIZE, inNumRows - rowStart);
+                                          for (uint64 row = 0; row < numRows; ++row)
+                                          {
+                                              rowData[row] = inRowPointer(rowStart + row);
+                                          }
+
+                                          // write each output row of the block contiguously
+                                          for (uint64 col = colStart; col < colEnd; ++col)
+                                          {
+                                              dtype* outRow = outData + col * inNumRows + rowStart;
+                                              for (uint64 row = 0; row < numRows; ++row)
+                                              {
+                                                  outRow[row] = rowData[row][col];
+                                              }
+                                          }
+                                      }
+                                  });
+        }
     };
 } // namespace nc
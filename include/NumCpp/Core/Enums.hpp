@@ -58,6 +58,43 @@ namespace nc
         SHELL
     };
 
+    //================================================================================
+    // Class Description:
+    /// Access mode of a memory mapped file
+    enum class MapMode
+    {
+        COPY_ON_WRITE,
+        READ_WRITE
+    };
+
+    //================================================================================
+    // Class Description:
+    /// Memory order of a contiguous DataCube
+    enum class CubeLayout
+    {
+        FRAME_MAJOR,
+        PIXEL_MAJOR
+    };
+
+    //================================================================================
+    // Class Description:
+    /// Singular vectors computed by linalg::SVD
+    enum class SVDMode
+    {
+        FULL,
+        THIN,
+        VALUES
+    };
+
+    //================================================================================
+    // Class Description:
+    /// Step of linalg::gaussNewtonNlls
+    enum class NllsMethod
+    {
+        GAUSS_NEWTON,
+        LEVENBERG_MARQUARDT
+    };
+
     //================================================================================
     // Class Description:
     /// Bias boolean
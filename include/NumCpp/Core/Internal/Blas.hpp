@@ -0,0 +1,149 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Optional CBLAS backend for matrix products, enabled with NUMCPP_USE_BLAS
+///
+#pragma once
+
+#ifdef NUMCPP_USE_BLAS
+
+#include <algorithm>
+#include <complex>
+#include <type_traits>
+
+#include <cblas.h>
+
+#include "NumCpp/Core/Types.hpp"
+
+namespace nc::blas
+{
+    //============================================================================
+    // Method Description:
+    /// Whether a dtype has a CBLAS gemm routine
+    ///
+    template<typename dtype>
+    constexpr bool is_supported_v = std::is_same_v<dtype, float> || std::is_same_v<dtype, double> ||
+                                    std::is_same_v<dtype, std::complex<float>> ||
+                                    std::is_same_v<dtype, std::complex<double>>;
+
+    //============================================================================
+    // Method Description:
+    /// Row-major C += A * B through cblas_?gemm, where A is m x k, B is k x n and
+    /// C is m x n, all contiguous
+    ///
+    /// @param m: rows of A and C
+    /// @param n: columns of B and C
+    /// @param k: columns of A and rows of B
+    /// @param a
+    /// @param b
+    /// @param c: accumulated into
+    ///
+    template<typename dtype>
+    void gemm(uint32 m, uint32 n, uint32 k, const dtype* a, const dtype* b, dtype* c)
+    {
+        static_assert(is_supported_v<dtype>, "cblas gemm is only available for float, double and their complex types");
+
+        const auto rowsA   = static_cast<int>(m);
+        const auto colsB   = static_cast<int>(n);
+        const auto colsA   = static_cast<int>(k);
+        const auto strideA = std::max(colsA, 1);
+        const auto strideB = std::max(colsB, 1);
+
+        if constexpr (std::is_same_v<dtype, float>)
+        {
+            cblas_sgemm(CblasRowMajor,
+                        CblasNoTrans,
+                        CblasNoTrans,
+                        rowsA,
+                        colsB,
+                        colsA,
+                        1.F,
+                        a,
+                        strideA,
+                        b,
+                        strideB,
+                        1.F,
+                        c,
+                        strideB);
+        }
+        else if constexpr (std::is_same_v<dtype, double>)
+        {
+            cblas_dgemm(CblasRowMajor,
+                        CblasNoTrans,
+                        CblasNoTrans,
+                        rowsA,
+                        colsB,
+                        colsA,
+                        1.,
+                        a,
+                        strideA,
+                        b,
+                        strideB,
+                        1.,
+                        c,
+                        strideB);
+        }
+        else
+        {
+            const dtype one{ 1 };
+            if constexpr (std::is_same_v<dtype, std::complex<float>>)
+            {
+                cblas_cgemm(CblasRowMajor,
+                            CblasNoTrans,
+                            CblasNoTrans,
+                            rowsA,
+                            colsB,
+                            colsA,
+                            &one,
+                            a,
+                            strideA,
+                            b,
+                            strideB,
+                            &one,
+                            c,
+                            strideB);
+            }
+            else
+            {
+                cblas_zgemm(CblasRowMajor,
+                            CblasNoTrans,
+                            CblasNoTrans,
+                            rowsA,
+                            colsB,
+                            colsA,
+                            &one,
+                            a,
+                            strideA,
+                            b,
+                            strideB,
+                            &one,
+                            c,
+                            strideB);
+            }
+        }
+    }
+} // namespace nc::blas
+
+#endif // #ifdef NUMCPP_USE_BLAS
@@ -0,0 +1,128 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Locale independent conversions between numbers and text
+///
+#pragma once
+
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+
+namespace nc::charconv
+{
+    /// enough characters for any arithmetic value in its shortest round trip form
+    constexpr int MAX_CHARS = 64;
+
+    //============================================================================
+    // Function Description:
+    /// Writes the shortest text that parses back to the same value
+    ///
+    /// @param first: beginning of the output buffer
+    /// @param last: end of the output buffer, at least MAX_CHARS after first
+    /// @param value
+    /// @return one past the last character written
+    ///
+    template<typename dtype>
+    char* toChars(char* first, char* last, dtype value) noexcept
+    {
+        STATIC_ASSERT_ARITHMETIC(dtype);
+
+        if constexpr (std::is_same_v<dtype, bool>)
+        {
+            *first = value ? '1' : '0';
+            return first + 1;
+        }
+        else if constexpr (std::is_integral_v<dtype>)
+        {
+            return std::to_chars(first, last, value).ptr;
+        }
+        else
+        {
+#ifdef __cpp_lib_to_chars
+            return std::to_chars(first, last, value).ptr;
+#else
+            const auto written = std::snprintf(first,
+                                               static_cast<std::size_t>(last - first),
+                                               "%.*Lg",
+                                               std::numeric_limits<dtype>::max_digits10,
+                                               static_cast<long double>(value));
+            return first + written;
+#endif
+        }
+    }
+
+    //============================================================================
+    // Function Description:
+    /// Parses a value from the beginning of the text. A leading '+' is accepted.
+    ///
+    /// @param first: beginning of the text
+    /// @param last: end of the text
+    /// @param value: the parsed value
+    /// @return one past the last character parsed, or nullptr if no value could be parsed
+    ///
+    template<typename dtype>
+    const char* fromChars(const char* first, const char* last, dtype& value) noexcept
+    {
+        STATIC_ASSERT_ARITHMETIC(dtype);
+
+        if (first != last && *first == '+')
+        {
+            ++first;
+        }
+
+        if constexpr (std::is_same_v<dtype, bool>)
+        {
+            long long integer = 0;
+
+            const auto [ptr, errc] = std::from_chars(first, last, integer);
+            value                  = integer != 0;
+            return errc == std::errc() ? ptr : nullptr;
+        }
+        else if constexpr (std::is_integral_v<dtype>)
+        {
+            const auto [ptr, errc] = std::from_chars(first, last, value);
+            return errc == std::errc() ? ptr : nullptr;
+        }
+        else
+        {
+#ifdef __cpp_lib_to_chars
+            const auto [ptr, errc] = std::from_chars(first, last, value);
+            return errc == std::errc() ? ptr : nullptr;
+#else
+            const std::string token(first, last);
+            char*             end = nullptr;
+            value                 = static_cast<dtype>(std::strtold(token.c_str(), &end));
+            return end == token.c_str() ? nullptr : first + (end - token.c_str());
+#endif
+        }
+    }
+} // namespace nc::charconv
@@ -0,0 +1,278 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Read only or read/write mapping of a whole file into memory
+///
+#pragma once
+
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Types.hpp"
+
+namespace nc::mapping
+{
+    //================================================================================
+    /// Owns the memory mapping of a whole file. The file handles are closed once the
+    /// view is created, the mapping keeps the file open until it is destroyed.
+    class FileMapping
+    {
+    public:
+        //============================================================================
+        // Method Description:
+        /// Default Constructor, no mapping
+        ///
+        FileMapping() = default;
+
+        //============================================================================
+        // Method Description:
+        /// Constructor
+        ///
+        /// @param inFilename
+        /// @param inMode: COPY_ON_WRITE keeps modifications private to the process,
+        ///                READ_WRITE writes them back to the file
+        ///
+        FileMapping(const std::string& inFilename, MapMode inMode) :
+            mode_(inMode)
+        {
+            const bool readWrite = mode_ == MapMode::READ_WRITE;
+
+#ifdef _WIN32
+            HANDLE file = CreateFileA(inFilename.c_str(),
+                                      readWrite ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+                                      FILE_SHARE_READ,
+                                      nullptr,
+                                      OPEN_EXISTING,
+                                      FILE_ATTRIBUTE_NORMAL,
+                                      nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("unable to open file\n\t" + inFilename);
+            }
+
+            LARGE_INTEGER fileSize;
+            if (GetFileSizeEx(file, &fileSize) == 0 || fileSize.QuadPart == 0)
+            {
+                CloseHandle(file);
+                THROW_INVALID_ARGUMENT_ERROR("unable to map an empty file\n\t" + inFilename);
+            }
+
+            HANDLE mapping =
+                CreateFileMappingA(file, nullptr, readWrite ? PAGE_READWRITE : PAGE_WRITECOPY, 0, 0, nullptr);
+            CloseHandle(file);
+            if (mapping == nullptr)
+            {
+                THROW_RUNTIME_ERROR("unable to memory map file\n\t" + inFilename);
+            }
+
+            data_ = MapViewOfFile(mapping, readWrite ? FILE_MAP_WRITE : FILE_MAP_COPY, 0, 0, 0);
+            CloseHandle(mapping);
+            if (data_ == nullptr)
+            {
+                THROW_RUNTIME_ERROR("unable to memory map file\n\t" + inFilename);
+            }
+
+            size_ = static_cast<uint64>(fileSize.QuadPart);
+#else
+            const int file = open(inFilename.c_str(), readWrite ? O_RDWR : O_RDONLY);
+            if (file < 0)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("unable to open file\n\t" + inFilename);
+            }
+
+            struct stat fileStat = {};
+            if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0)
+            {
+                close(file);
+                THROW_INVALID_ARGUMENT_ERROR("unable to map an empty file\n\t" + inFilename);
+            }
+
+            const auto fileSize = static_cast<uint64>(fileStat.st_size);
+            const int  flags    = readWrite ? MAP_SHARED : MAP_PRIVATE;
+            void*      mapping  = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, flags, file, 0);
+            close(file);
+            if (mapping == MAP_FAILED)
+            {
+                THROW_RUNTIME_ERROR("unable to memory map file\n\t" + inFilename);
+            }
+
+            data_ = mapping;
+            size_ = fileSize;
+#endif
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Copy Constructor, not allowed
+        ///
+        FileMapping(const FileMapping&) = delete;
+
+        //============================================================================
+        // Method Description:
+        /// Move Constructor
+        ///
+        /// @param other
+        ///
+        FileMapping(FileMapping&& other) noexcept :
+            mode_(other.mode_),
+            data_(std::exchange(other.data_, nullptr)),
+            size_(std::exchange(other.size_, 0))
+        {
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Destructor, unmaps the file
+        ///
+        ~FileMapping() noexcept
+        {
+            unmap();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Copy Assignment, not allowed
+        ///
+        FileMapping& operator=(const FileMapping&) = delete;
+
+        //============================================================================
+        // Method Description:
+        /// Move Assignment
+        ///
+        /// @param rhs
+        /// @return FileMapping&
+        ///
+        FileMapping& operator=(FileMapping&& rhs) noexcept
+        {
+            if (&rhs != this)
+            {
+                unmap();
+                mode_ = rhs.mode_;
+                data_ = std::exchange(rhs.data_, nullptr);
+                size_ = std::exchange(rhs.size_, 0);
+            }
+
+            return *this;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the first byte of the mapping, nullptr when nothing is mapped
+        ///
+        /// @return char*
+        ///
+        [[nodiscard]] char* data() const noexcept
+        {
+            return static_cast<char*>(data_);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the number of mapped bytes
+        ///
+        /// @return uint64
+        ///
+        [[nodiscard]] uint64 size() const noexcept
+        {
+            return size_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the access mode of the mapping
+        ///
+        /// @return MapMode
+        ///
+        [[nodiscard]] MapMode mode() const noexcept
+        {
+            return mode_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Writes any modifications back to the file. Does nothing for COPY_ON_WRITE
+        /// mappings.
+        ///
+        void flush() const
+        {
+            if (data_ == nullptr || mode_ != MapMode::READ_WRITE)
+            {
+                return;
+            }
+
+#ifdef _WIN32
+            if (FlushViewOfFile(data_, 0) == 0)
+#else
+            if (msync(data_, size_, MS_SYNC) != 0)
+#endif
+            {
+                THROW_RUNTIME_ERROR("unable to flush the memory mapped file");
+            }
+        }
+
+    private:
+        //==============================Attributes====================================
+        MapMode mode_{ MapMode::COPY_ON_WRITE };
+        void*   data_{ nullptr };
+        uint64  size_{ 0 };
+
+        //============================================================================
+        // Method Description:
+        /// Releases the mapping
+        ///
+        void unmap() noexcept
+        {
+            if (data_ == nullptr)
+            {
+                return;
+            }
+
+#ifdef _WIN32
+            UnmapViewOfFile(data_);
+#else
+            munmap(data_, size_);
+#endif
+            data_ = nullptr;
+            size_ = 0;
+        }
+    };
+} // namespace nc::mapping
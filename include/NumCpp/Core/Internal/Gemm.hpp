@@ -0,0 +1,375 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Cache blocked general matrix multiplication
+///
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Blas.hpp"
+#include "NumCpp/Core/Internal/ParallelFor.hpp"
+#include "NumCpp/Core/Internal/StlAlgorithms.hpp"
+#include "NumCpp/Core/Types.hpp"
+
+namespace nc::gemm
+{
+    namespace detail
+    {
+        /// The widest SIMD register available at compile time in bytes. The register tile
+        /// of the micro kernel is sized to it so it fits in the register file of the target.
+#if defined(__AVX512F__)
+        constexpr uint32 SIMD_BYTES = 64;
+#elif defined(__AVX__)
+        constexpr uint32 SIMD_BYTES = 32;
+#elif defined(__SSE2__) || defined(_M_X64) || defined(__ARM_NEON) || defined(__aarch64__)
+        constexpr uint32 SIMD_BYTES = 16;
+#else
+        constexpr uint32 SIMD_BYTES = 8;
+#endif
+
+        /// Whether the float/double micro kernel is written with GCC/Clang vector
+        /// extensions, which lower to AVX-512, AVX2, SSE or NEON for the target,
+        /// rather than left to the auto-vectorizer
+#if defined(__GNUC__) || defined(__clang__)
+        constexpr bool VECTOR_EXTENSIONS = true;
+#else
+        constexpr bool VECTOR_EXTENSIONS = false;
+#endif
+
+        /// Products smaller than this many multiply-adds skip the packing entirely
+        constexpr std::size_t SMALL_PRODUCT_SIZE = 32 * 32 * 32;
+
+        //============================================================================
+        // Class Description:
+        /// Register tile (MR x NR) and cache block (MC x KC panels of A, KC x NC panels
+        /// of B) sizes for a dtype
+        ///
+        template<typename dtype>
+        struct BlockSizes
+        {
+            static constexpr bool   SIMD  = VECTOR_EXTENSIONS && (std::is_same_v<dtype, float> ||
+                                                                std::is_same_v<dtype, double>);
+            static constexpr uint32 LANES = SIMD ? SIMD_BYTES / static_cast<uint32>(sizeof(dtype)) : 1;
+            static constexpr uint32 NR    = SIMD ? 3 * LANES : 4;
+            static constexpr uint32 MR    = SIMD && SIMD_BYTES == 64 ? 8 : 4; // AVX-512 has 32 vector registers
+            static constexpr uint32 KC    = 256;
+            static constexpr uint32 MC    = MR * 8;
+            static constexpr uint32 NC    = NR * 64;
+        };
+
+        //============================================================================
+        // Method Description:
+        /// Plain row-major C += A * B for products too small to be worth packing
+        ///
+        template<typename dtype>
+        void multiplySmall(uint32 m, uint32 n, uint32 k, const dtype* a, const dtype* b, dtype* c)
+        {
+            for (uint32 i = 0; i < m; ++i)
+            {
+                auto* cRow = c + static_cast<std::size_t>(i) * n;
+                for (uint32 p = 0; p < k; ++p)
+                {
+                    const auto  aValue = a[static_cast<std::size_t>(i) * k + p];
+                    const auto* bRow   = b + static_cast<std::size_t>(p) * n;
+                    for (uint32 j = 0; j < n; ++j)
+                    {
+                        cRow[j] += aValue * bRow[j];
+                    }
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Packs an mc x kc block of row-major A into MR tall column-major slivers,
+        /// zero filling the last sliver
+        ///
+        template<typename dtype>
+        void packA(uint32 mc, uint32 kc, const dtype* a, uint32 lda, dtype* aPacked)
+        {
+            constexpr auto MR = BlockSizes<dtype>::MR;
+
+            for (uint32 ir = 0; ir < mc; ir += MR)
+            {
+                const auto mr = std::min(MR, mc - ir);
+                for (uint32 p = 0; p < kc; ++p)
+                {
+                    uint32 i = 0;
+                    for (; i < mr; ++i)
+                    {
+                        aPacked[i] = a[static_cast<std::size_t>(ir + i) * lda + p];
+                    }
+                    for (; i < MR; ++i)
+                    {
+                        aPacked[i] = dtype{ 0 };
+                    }
+                    aPacked += MR;
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Packs a kc x nc block of row-major B into NR wide row-major slivers,
+        /// zero filling the last sliver
+        ///
+        template<typename dtype>
+        void packB(uint32 kc, uint32 nc, const dtype* b, uint32 ldb, dtype* bPacked)
+        {
+            constexpr auto NR = BlockSizes<dtype>::NR;
+
+            for (uint32 jr = 0; jr < nc; jr += NR)
+            {
+                const auto nr = std::min(NR, nc - jr);
+                for (uint32 p = 0; p < kc; ++p)
+                {
+                    const auto* bRow = b + static_cast<std::size_t>(p) * ldb + jr;
+                    uint32      j    = 0;
+                    for (; j < nr; ++j)
+                    {
+                        bPacked[j] = bRow[j];
+                    }
+                    for (; j < NR; ++j)
+                    {
+                        bPacked[j] = dtype{ 0 };
+                    }
+                    bPacked += NR;
+                }
+            }
+        }
+
+#if defined(__GNUC__) || defined(__clang__)
+        //============================================================================
+        // Method Description:
+        /// Multiplies an MR sliver of packed A with an NR sliver of packed B and adds the
+        /// top left mr x nr corner of the result to C, for float and double with the
+        /// accumulator tile held in SIMD_BYTES wide vector registers
+        ///
+        template<typename dtype>
+        void microKernelSimd(uint32       kc,
+                             const dtype* aPacked,
+                             const dtype* bPacked,
+                             dtype*       c,
+                             uint32       ldc,
+                             uint32       mr,
+                             uint32       nr)
+        {
+            typedef dtype vector_type __attribute__((vector_size(SIMD_BYTES)));
+            typedef dtype unaligned_vector_type
+                __attribute__((vector_size(SIMD_BYTES), aligned(alignof(dtype)), may_alias));
+
+            constexpr auto MR          = BlockSizes<dtype>::MR;
+            constexpr auto NR          = BlockSizes<dtype>::NR;
+            constexpr auto LANES       = BlockSizes<dtype>::LANES;
+            constexpr auto NUM_VECTORS = NR / LANES;
+
+            vector_type accumulator[MR][NUM_VECTORS];
+            for (uint32 i = 0; i < MR; ++i)
+            {
+                for (uint32 v = 0; v < NUM_VECTORS; ++v)
+                {
+                    accumulator[i][v] = vector_type{};
+                }
+            }
+
+            for (uint32 p = 0; p < kc; ++p)
+            {
+                const auto* bVectors = reinterpret_cast<const unaligned_vector_type*>(bPacked);
+                for (uint32 i = 0; i < MR; ++i)
+                {
+                    const vector_type aVector = vector_type{} + aPacked[i];
+                    for (uint32 v = 0; v < NUM_VECTORS; ++v)
+                    {
+                        accumulator[i][v] += aVector * bVectors[v];
+                    }
+                }
+
+                aPacked += MR;
+                bPacked += NR;
+            }
+
+            // fixed trip counts so the accumulator is never indexed at runtime and stays in registers
+            dtype tile[MR][NR];
+            for (uint32 i = 0; i < MR; ++i)
+            {
+                for (uint32 v = 0; v < NUM_VECTORS; ++v)
+                {
+                    for (uint32 lane = 0; lane < LANES; ++lane)
+                    {
+                        tile[i][v * LANES + lane] = accumulator[i][v][lane];
+                    }
+                }
+            }
+
+            for (uint32 i = 0; i < mr; ++i)
+            {
+                auto* cRow = c + static_cast<std::size_t>(i) * ldc;
+                for (uint32 j = 0; j < nr; ++j)
+                {
+                    cRow[j] += tile[i][j];
+                }
+            }
+        }
+#endif
+
+        //============================================================================
+        // Method Description:
+        /// Multiplies an MR sliver of packed A with an NR sliver of packed B and adds the
+        /// top left mr x nr corner of the result to C
+        ///
+        template<typename dtype>
+        void microKernel(uint32       kc,
+                         const dtype* aPacked,
+                         const dtype* bPacked,
+                         dtype*       c,
+                         uint32       ldc,
+                         uint32       mr,
+                         uint32       nr)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            if constexpr (BlockSizes<dtype>::SIMD)
+            {
+                microKernelSimd(kc, aPacked, bPacked, c, ldc, mr, nr);
+                return;
+            }
+#endif
+
+            constexpr auto MR = BlockSizes<dtype>::MR;
+            constexpr auto NR = BlockSizes<dtype>::NR;
+
+            dtype accumulator[MR][NR]{};
+            for (uint32 p = 0; p < kc; ++p)
+            {
+                for (uint32 i = 0; i < MR; ++i)
+                {
+                    const auto aValue = aPacked[i];
+                    for (uint32 j = 0; j < NR; ++j)
+                    {
+                        accumulator[i][j] += aValue * bPacked[j];
+                    }
+                }
+
+                aPacked += MR;
+                bPacked += NR;
+            }
+
+            for (uint32 i = 0; i < mr; ++i)
+            {
+                auto* cRow = c + static_cast<std::size_t>(i) * ldc;
+                for (uint32 j = 0; j < nr; ++j)
+                {
+                    cRow[j] += accumulator[i][j];
+                }
+            }
+        }
+    } // namespace detail
+
+    //============================================================================
+    // Method Description:
+    /// Row-major C += A * B, where A is m x k, B is k x n and C is m x n, all
+    /// contiguous. B is packed into KC x NC panels and A into MC x KC blocks so the
+    /// micro kernel streams both from cache, and the MC row blocks of each panel are
+    /// shared out across threads when NUMCPP_USE_MULTITHREAD is defined. With
+    /// NUMCPP_USE_BLAS defined float, double and complex products go to cblas instead.
+    ///
+    /// @param m: rows of A and C
+    /// @param n: columns of B and C
+    /// @param k: columns of A and rows of B
+    /// @param a
+    /// @param b
+    /// @param c: accumulated into
+    ///
+    template<typename dtype>
+    void multiply(uint32 m, uint32 n, uint32 k, const dtype* a, const dtype* b, dtype* c)
+    {
+        using Sizes = detail::BlockSizes<dtype>;
+
+#ifdef NUMCPP_USE_BLAS
+        if constexpr (blas::is_supported_v<dtype>)
+        {
+            blas::gemm(m, n, k, a, b, c);
+            return;
+        }
+#endif
+
+        if (static_cast<std::size_t>(m) * n * k <= detail::SMALL_PRODUCT_SIZE)
+        {
+            detail::multiplySmall(m, n, k, a, b, c);
+            return;
+        }
+
+        const auto numRowBlocks = (m + Sizes::MC - 1) / Sizes::MC;
+
+        // the packed panel of B is kept per thread so repeated products do not allocate, and
+        // is referenced through the calling thread's buffer inside the parallel loop
+        thread_local std::vector<dtype> bPackedStorage;
+        bPackedStorage.resize(static_cast<std::size_t>(Sizes::KC) *
+                              ((std::min(n, Sizes::NC) + Sizes::NR - 1) / Sizes::NR * Sizes::NR));
+        auto& bPacked = bPackedStorage;
+
+        for (uint32 jc = 0; jc < n; jc += Sizes::NC)
+        {
+            const auto nc = std::min(Sizes::NC, n - jc);
+            for (uint32 pc = 0; pc < k; pc += Sizes::KC)
+            {
+                const auto kc = std::min(Sizes::KC, k - pc);
+                detail::packB(kc, nc, b + static_cast<std::size_t>(pc) * n + jc, n, bPacked.data());
+
+                parallel::parallelFor(
+                    numRowBlocks,
+                    [=, &bPacked](uint32 rowBlock)
+                    {
+                        const auto ic = rowBlock * Sizes::MC;
+                        const auto mc = std::min(Sizes::MC, m - ic);
+
+                        thread_local std::vector<dtype> aPacked;
+                        aPacked.resize(static_cast<std::size_t>(Sizes::MC) * Sizes::KC);
+                        detail::packA(mc, kc, a + static_cast<std::size_t>(ic) * k + pc, k, aPacked.data());
+
+                        for (uint32 jr = 0; jr < nc; jr += Sizes::NR)
+                        {
+                            const auto  nr      = std::min(Sizes::NR, nc - jr);
+                            const auto* bSliver = bPacked.data() + static_cast<std::size_t>(jr) * kc;
+                            for (uint32 ir = 0; ir < mc; ir += Sizes::MR)
+                            {
+                                const auto mr = std::min(Sizes::MR, mc - ir);
+                                detail::microKernel(kc,
+                                                    aPacked.data() + static_cast<std::size_t>(ir) * kc,
+                                                    bSliver,
+                                                    c + static_cast<std::size_t>(ic + ir) * n + jc + jr,
+                                                    n,
+                                                    mr,
+                                                    nr);
+                            }
+                        }
+                    });
+            }
+        }
+    }
+} // namespace nc::gemm
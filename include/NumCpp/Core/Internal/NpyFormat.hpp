@@ -0,0 +1,473 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Reading and writing of the NumPy .npy file header
+///
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <complex>
+#include <istream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Endian.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Internal/TypeTraits.hpp"
+#include "NumCpp/Core/Shape.hpp"
+#include "NumCpp/Core/Types.hpp"
+
+namespace nc::npy
+{
+    constexpr std::array<char, 6> MAGIC            = { '\x93', 'N', 'U', 'M', 'P', 'Y' };
+    constexpr uint32              HEADER_ALIGNMENT = 64;
+
+    //============================================================================
+    // Class Description:
+    /// The parsed contents of a .npy header
+    ///
+    struct Header
+    {
+        std::string         descr{};
+        bool                fortranOrder{ false };
+        std::vector<uint64> shape{};
+        uint64              dataOffset{ 0 };
+    };
+
+    namespace detail
+    {
+        //============================================================================
+        // Function Description:
+        /// Returns the value of a key in the header dictionary, not including any
+        /// leading whitespace
+        ///
+        /// @param dict: the header dictionary text
+        /// @param key
+        /// @return position of the value
+        ///
+        inline std::string::size_type findValue(const std::string& dict, const std::string& key)
+        {
+            auto position = dict.find("'" + key + "'");
+            if (position == std::string::npos)
+            {
+                THROW_RUNTIME_ERROR("npy header is missing the '" + key + "' key");
+            }
+
+            position = dict.find(':', position);
+            if (position == std::string::npos)
+            {
+                THROW_RUNTIME_ERROR("malformed npy header");
+            }
+
+            position = dict.find_first_not_of(" \t", position + 1);
+            if (position == std::string::npos)
+            {
+                THROW_RUNTIME_ERROR("malformed npy header");
+            }
+
+            return position;
+        }
+
+        //============================================================================
+        // Function Description:
+        /// Reads an unsigned little endian integer of numBytes
+        ///
+        /// @param bytes
+        /// @param numBytes
+        /// @return value
+        ///
+        inline uint32 readLittleEndian(const uint8* bytes, uint32 numBytes) noexcept
+        {
+            uint32 value = 0;
+            for (uint32 i = numBytes; i > 0; --i)
+            {
+                value = (value << 8) | bytes[i - 1];
+            }
+            return value;
+        }
+    } // namespace detail
+
+    //============================================================================
+    // Function Description:
+    /// Returns the NumPy array-protocol type string of the native dtype, ie '<f8'
+    ///
+    /// @return descr string
+    ///
+    template<typename dtype>
+    std::string descr()
+    {
+        STATIC_ASSERT_ARITHMETIC_OR_COMPLEX(dtype);
+
+        char kind = 'f';
+        if constexpr (std::is_same_v<dtype, bool>)
+        {
+            kind = 'b';
+        }
+        else if constexpr (is_complex_v<dtype>)
+        {
+            kind = 'c';
+        }
+        else if constexpr (std::is_integral_v<dtype>)
+        {
+            kind = std::is_signed_v<dtype> ? 'i' : 'u';
+        }
+
+        char byteOrder = endian::isLittleEndian() ? '<' : '>';
+        if constexpr (sizeof(dtype) == 1)
+        {
+            byteOrder = '|';
+        }
+
+        return std::string(1, byteOrder) + kind + std::to_string(sizeof(dtype));
+    }
+
+    //============================================================================
+    // Function Description:
+    /// Checks the header descr against the dtype
+    ///
+    /// @param header
+    /// @return true if the data is stored in the opposite of the native byte order
+    ///
+    template<typename dtype>
+    bool byteSwapRequired(const Header& header)
+    {
+        const auto nativeDescr = descr<dtype>();
+        if (header.descr.size() < 2 || header.descr.substr(1) != nativeDescr.substr(1))
+        {
+            THROW_INVALID_ARGUMENT_ERROR("npy file dtype '" + header.descr + "' does not match the requested dtype '" +
+                                         nativeDescr + "'");
+        }
+
+        switch (header.descr.front())
+        {
+            case '|':
+            case '=':
+            {
+                return false;
+            }
+            case '<':
+            {
+                return sizeof(dtype) > 1 && !endian::isLittleEndian();
+            }
+            case '>':
+            {
+                return sizeof(dtype) > 1 && endian::isLittleEndian();
+            }
+            default:
+            {
+                THROW_INVALID_ARGUMENT_ERROR("unknown npy byte order '" + header.descr + "'");
+            }
+        }
+
+        return false;
+    }
+
+    //============================================================================
+    // Function Description:
+    /// Swaps the bytes of each element in place. Complex values have their real
+    /// and imaginary parts swapped independently.
+    ///
+    /// @param data
+    /// @param size: number of elements
+    ///
+    template<typename dtype>
+    void byteSwap(dtype* data, uint64 size) noexcept
+    {
+        constexpr auto componentSize = is_complex_v<dtype> ? sizeof(dtype) / 2 : sizeof(dtype);
+
+        auto*      bytes    = reinterpret_cast<char*>(data);
+        const auto numBytes = size * sizeof(dtype);
+        for (uint64 i = 0; i < numBytes; i += componentSize)
+        {
+            std::reverse(bytes + i, bytes + i + componentSize);
+        }
+    }
+
+    //============================================================================
+    // Function Description:
+    /// Converts the header shape to an NdArray shape. 0d arrays are 1x1, 1d
+    /// arrays are a single row, and 2d arrays keep their shape.
+    ///
+    /// @param header
+    /// @return Shape
+    ///
+    inline Shape toShape(const Header& header)
+    {
+        uint64 rows = 1;
+        uint64 cols = 1;
+        switch (header.shape.size())
+        {
+            case 0:
+            {
+                break;
+            }
+            case 1:
+            {
+                cols = header.shape[0];
+                break;
+            }
+            case 2:
+            {
+                rows = header.shape[0];
+                cols = header.shape[1];
+                break;
+            }
+            default:
+            {
+                THROW_INVALID_ARGUMENT_ERROR("only 0, 1, and 2 dimensional npy arrays are supported");
+            }
+        }
+
+        if (rows > std::numeric_limits<uint32>::max() || cols > std::numeric_limits<uint32>::max())
+        {
+            THROW_INVALID_ARGUMENT_ERROR("npy array dimensions are too large");
+        }
+
+        return { static_cast<uint32>(rows), static_cast<uint32>(cols) };
+    }
+
+    //============================================================================
+    // Function Description:
+    /// Builds the full .npy preamble (magic string, version, header length and
+    /// header dictionary) for a C ordered array of the native dtype. The preamble
+    /// is padded so the data begins on a 64 byte boundary.
+    ///
+    /// @param inShape: the dimensions of the array
+    /// @param inPreambleSize: pad the preamble to exactly this many bytes instead,
+    ///                        used to rewrite a header in place. default 0
+    /// @return preamble bytes
+    ///
+    template<typename dtype>
+    std::string makeHeader(const std::vector<uint64>& inShape, uint64 inPreambleSize = 0)
+    {
+        std::string shape;
+        for (const auto dim : inShape)
+        {
+            shape += std::to_string(dim) + ", ";
+        }
+        if (inShape.size() > 1)
+        {
+            shape.erase(shape.size() - 2);
+        }
+        else if (inShape.size() == 1)
+        {
+            shape.pop_back();
+        }
+
+        std::string dict = "{'descr': '" + descr<dtype>() + "', 'fortran_order': False, 'shape': (" + shape + "), }";
+
+        // version 1.0 stores the header length in 2 bytes, 2.0 in 4
+        uint32     lengthBytes = 2;
+        const auto padded      = [&dict, &lengthBytes, inPreambleSize]() noexcept -> uint64
+        {
+            const uint64 unpadded = MAGIC.size() + 2 + lengthBytes + dict.size() + 1;
+            if (inPreambleSize > 0)
+            {
+                return std::max(unpadded, inPreambleSize);
+            }
+            return (unpadded + HEADER_ALIGNMENT - 1) / HEADER_ALIGNMENT * HEADER_ALIGNMENT;
+        };
+
+        if (padded() - MAGIC.size() - 4 > std::numeric_limits<uint16>::max())
+        {
+            lengthBytes = 4;
+        }
+
+        const auto totalSize = padded();
+        if (inPreambleSize > 0 && totalSize != inPreambleSize)
+        {
+            THROW_INVALID_ARGUMENT_ERROR("npy header does not fit in the requested size");
+        }
+
+        const auto headerLength = static_cast<uint32>(totalSize - MAGIC.size() - 2 - lengthBytes);
+        dict.append(headerLength - dict.size() - 1, ' ');
+        dict.push_back('\n');
+
+        std::string preamble(MAGIC.begin(), MAGIC.end());
+        preamble.push_back(static_cast<char>(lengthBytes == 2 ? 1 : 2));
+        preamble.push_back('\0');
+        for (uint32 i = 0; i < lengthBytes; ++i)
+        {
+            preamble.push_back(static_cast<char>((headerLength >> (8 * i)) & 0xFF));
+        }
+
+        return preamble + dict;
+    }
+
+    //============================================================================
+    // Function Description:
+    /// Builds the full .npy preamble for a 2d C ordered array of the native dtype
+    ///
+    /// @param inShape
+    /// @return preamble bytes
+    ///
+    template<typename dtype>
+    std::string makeHeader(const Shape& inShape)
+    {
+        return makeHeader<dtype>(std::vector<uint64>{ inShape.rows, inShape.cols });
+    }
+
+    //============================================================================
+    // Function Description:
+    /// Returns whether the bytes begin with the .npy magic string
+    ///
+    /// @param bytes
+    /// @param numBytes
+    /// @return bool
+    ///
+    inline bool isNpy(const char* bytes, uint64 numBytes) noexcept
+    {
+        return numBytes >= MAGIC.size() && std::equal(MAGIC.begin(), MAGIC.end(), bytes);
+    }
+
+    //============================================================================
+    // Function Description:
+    /// Parses the .npy preamble at the beginning of the bytes
+    ///
+    /// @param bytes
+    /// @param numBytes
+    /// @return Header
+    ///
+    inline Header parseHeader(const char* bytes, uint64 numBytes)
+    {
+        if (!isNpy(bytes, numBytes) || numBytes < MAGIC.size() + 4)
+        {
+            THROW_RUNTIME_ERROR("not an npy file");
+        }
+
+        const auto*  unsignedBytes = reinterpret_cast<const uint8*>(bytes);
+        const uint32 majorVersion  = unsignedBytes[MAGIC.size()];
+        if (majorVersion < 1 || majorVersion > 3)
+        {
+            THROW_RUNTIME_ERROR("unsupported npy version " + std::to_string(majorVersion));
+        }
+
+        const uint32 lengthBytes = majorVersion == 1 ? 2 : 4;
+        const uint64 dictBegin   = MAGIC.size() + 2 + lengthBytes;
+        if (numBytes < dictBegin)
+        {
+            THROW_RUNTIME_ERROR("truncated npy header");
+        }
+
+        const auto headerLength = detail::readLittleEndian(unsignedBytes + MAGIC.size() + 2, lengthBytes);
+        if (numBytes < dictBegin + headerLength)
+        {
+            THROW_RUNTIME_ERROR("truncated npy header");
+        }
+
+        const std::string dict(bytes + dictBegin, headerLength);
+
+        Header header;
+        header.dataOffset = dictBegin + headerLength;
+
+        auto position = detail::findValue(dict, "descr");
+        if (dict[position] != '\'')
+        {
+            THROW_RUNTIME_ERROR("structured npy dtypes are not supported");
+        }
+        const auto descrEnd = dict.find('\'', position + 1);
+        if (descrEnd == std::string::npos)
+        {
+            THROW_RUNTIME_ERROR("malformed npy header");
+        }
+        header.descr = dict.substr(position + 1, descrEnd - position - 1);
+
+        position            = detail::findValue(dict, "fortran_order");
+        header.fortranOrder = dict.compare(position, 4, "True") == 0;
+
+        position = detail::findValue(dict, "shape");
+        if (dict[position] != '(')
+        {
+            THROW_RUNTIME_ERROR("malformed npy header");
+        }
+        const auto shapeEnd = dict.find(')', position);
+        if (shapeEnd == std::string::npos)
+        {
+            THROW_RUNTIME_ERROR("malformed npy header");
+        }
+
+        for (++position; position < shapeEnd; ++position)
+        {
+            if (std::isdigit(static_cast<unsigned char>(dict[position])) != 0)
+            {
+                uint64 dim = 0;
+                while (std::isdigit(static_cast<unsigned char>(dict[position])) != 0)
+                {
+                    dim = dim * 10 + static_cast<uint64>(dict[position++] - '0');
+                }
+                header.shape.push_back(dim);
+            }
+        }
+
+        return header;
+    }
+
+    //============================================================================
+    // Function Description:
+    /// Reads and parses the .npy preamble from the current stream position.
+    /// On return the stream is positioned at the beginning of the data.
+    ///
+    /// @param stream
+    /// @return Header
+    ///
+    inline Header readHeader(std::istream& stream)
+    {
+        std::vector<char> preamble(MAGIC.size() + 6);
+        stream.read(preamble.data(), static_cast<std::streamsize>(preamble.size()));
+        if (!stream || !isNpy(preamble.data(), preamble.size()))
+        {
+            THROW_RUNTIME_ERROR("not an npy file");
+        }
+
+        const uint32 lengthBytes  = static_cast<uint8>(preamble[MAGIC.size()]) == 1 ? 2 : 4;
+        const auto   headerLength = detail::readLittleEndian(
+            reinterpret_cast<const uint8*>(preamble.data()) + MAGIC.size() + 2, lengthBytes);
+
+        const auto preambleSize = MAGIC.size() + 2 + lengthBytes + headerLength;
+        const auto alreadyRead  = preamble.size();
+        preamble.resize(preambleSize);
+        if (preambleSize > alreadyRead)
+        {
+            stream.read(preamble.data() + alreadyRead, static_cast<std::streamsize>(preambleSize - alreadyRead));
+        }
+        else
+        {
+            stream.seekg(static_cast<std::streamoff>(preambleSize) - static_cast<std::streamoff>(alreadyRead),
+                         std::ios::cur);
+        }
+
+        if (!stream)
+        {
+            THROW_RUNTIME_ERROR("truncated npy header");
+        }
+
+        return parseHeader(preamble.data(), preamble.size());
+    }
+} // namespace nc::npy
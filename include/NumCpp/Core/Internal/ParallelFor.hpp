@@ -0,0 +1,68 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Runs a loop body across threads when NUMCPP_USE_MULTITHREAD is defined
+///
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "NumCpp/Core/Internal/StlAlgorithms.hpp"
+#include "NumCpp/Core/Types.hpp"
+
+#ifdef PARALLEL_ALGORITHMS_SUPPORTED
+#include <execution>
+#include <numeric>
+#endif
+
+namespace nc::parallel
+{
+    //============================================================================
+    // Method Description:
+    /// Calls function(i) for i in [0, count), across threads when NUMCPP_USE_MULTITHREAD
+    /// is defined and the standard library supports the parallel algorithms
+    ///
+    /// @param count: the number of iterations
+    /// @param function: the loop body
+    ///
+    template<typename Function>
+    void parallelFor(uint32 count, Function function)
+    {
+#ifdef PARALLEL_ALGORITHMS_SUPPORTED
+        if (count > 1)
+        {
+            std::vector<uint32> indices(count);
+            std::iota(indices.begin(), indices.end(), 0);
+            std::for_each(std::execution::par, indices.begin(), indices.end(), function);
+            return;
+        }
+#endif
+        for (uint32 i = 0; i < count; ++i)
+        {
+            function(i);
+        }
+    }
+} // namespace nc::parallel
@@ -0,0 +1,163 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Memory mapped NdArray files
+///
+#pragma once
+
+#include <limits>
+#include <string>
+
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/FileMapping.hpp"
+#include "NumCpp/Core/Internal/NpyFormat.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Shape.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc
+{
+    //================================================================================
+    /// Maps a binary file into memory and exposes its contents as a non-owning
+    /// NdArray. Files written by save() are mapped with the shape from their .npy
+    /// header, any other file is mapped as a single row of raw values as written by
+    /// dump() or tofile(). Pages are only read from disk when they are touched, so
+    /// even very large files open immediately.
+    ///
+    /// The array is only valid for the lifetime of the MemMap. Copying the array
+    /// makes an owning copy of the data, and assigning a whole array to it detaches
+    /// it from the file, write through its elements, put() or view().assign().
+    template<typename dtype>
+    class MemMap
+    {
+    public:
+        STATIC_ASSERT_ARITHMETIC_OR_COMPLEX(dtype);
+
+        //============================================================================
+        // Method Description:
+        /// Constructor
+        ///
+        /// @param inFilename
+        /// @param inMode: COPY_ON_WRITE keeps modifications private to the process,
+        ///                READ_WRITE writes them back to the file. default COPY_ON_WRITE
+        ///
+        explicit MemMap(const std::string& inFilename, MapMode inMode = MapMode::COPY_ON_WRITE) :
+            mapping_(inFilename, inMode)
+        {
+            const auto* bytes  = mapping_.data();
+            uint64      offset = 0;
+            Shape       shape(1, static_cast<uint32>(mapping_.size() / sizeof(dtype)));
+            if (npy::isNpy(bytes, mapping_.size()))
+            {
+                const auto header = npy::parseHeader(bytes, mapping_.size());
+                if (npy::byteSwapRequired<dtype>(header))
+                {
+                    THROW_INVALID_ARGUMENT_ERROR("only files in the native byte order can be memory mapped");
+                }
+
+                shape = npy::toShape(header);
+                if (header.fortranOrder && shape.rows > 1 && shape.cols > 1)
+                {
+                    THROW_INVALID_ARGUMENT_ERROR("fortran ordered files can not be memory mapped");
+                }
+
+                offset = header.dataOffset;
+                if (offset % alignof(dtype) != 0 ||
+                    offset + static_cast<uint64>(shape.size()) * sizeof(dtype) > mapping_.size())
+                {
+                    THROW_INVALID_ARGUMENT_ERROR("npy file data is misaligned or truncated");
+                }
+            }
+            else if (mapping_.size() / sizeof(dtype) > std::numeric_limits<uint32>::max())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("file is too large to be mapped as a single row");
+            }
+
+            auto* data = reinterpret_cast<dtype*>(mapping_.data() + offset);
+            array_     = NdArray<dtype>(data, shape.rows, shape.cols, PointerPolicy::SHELL);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the mapped array
+        ///
+        /// @return NdArray
+        ///
+        NdArray<dtype>& array() noexcept
+        {
+            return array_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the mapped array
+        ///
+        /// @return NdArray
+        ///
+        [[nodiscard]] const NdArray<dtype>& array() const noexcept
+        {
+            return array_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the shape of the mapped array
+        ///
+        /// @return Shape
+        ///
+        [[nodiscard]] Shape shape() const noexcept
+        {
+            return array_.shape();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the access mode of the mapping
+        ///
+        /// @return MapMode
+        ///
+        [[nodiscard]] MapMode mode() const noexcept
+        {
+            return mapping_.mode();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Writes any modifications back to the file. Does nothing for COPY_ON_WRITE
+        /// mappings.
+        ///
+        void flush() const
+        {
+            mapping_.flush();
+        }
+
+    private:
+        //==============================Attributes====================================
+        mapping::FileMapping mapping_{};
+        NdArray<dtype>       array_{};
+    };
+} // namespace nc
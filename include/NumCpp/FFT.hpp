@@ -36,6 +36,7 @@
 #include "NumCpp/FFT/ifftshift.hpp"
 #include "NumCpp/FFT/irfft.hpp"
 #include "NumCpp/FFT/irfft2.hpp"
+#include "NumCpp/FFT/Plan.hpp"
 #include "NumCpp/FFT/rfft.hpp"
 #include "NumCpp/FFT/rfft2.hpp"
 #include "NumCpp/FFT/rfftfreq.hpp"
@@ -0,0 +1,1137 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// O(n log n) Fast Fourier Transform engine
+///
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <vector>
+
+#include "NumCpp/Core/Constants.hpp"
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/ParallelFor.hpp"
+#include "NumCpp/Core/Internal/StlAlgorithms.hpp"
+#include "NumCpp/Core/Shape.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::fft::detail
+{
+    //============================================================================
+    // Method Description:
+    /// Complex multiplication without the inf/nan recovery of operator*, which
+    /// otherwise dominates the cost of the butterflies
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return std::complex<double>
+    ///
+    inline std::complex<double> multiply(const std::complex<double>& lhs, const std::complex<double>& rhs) noexcept
+    {
+        return { lhs.real() * rhs.real() - lhs.imag() * rhs.imag(),
+                 lhs.real() * rhs.imag() + lhs.imag() * rhs.real() };
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Computes exp(-2 pi i k / n). The angle is reduced to the first octant so that
+    /// the symmetries of the roots of unity hold exactly, in particular 1, -i, -1, i.
+    ///
+    /// @param k
+    /// @param n
+    /// @return std::complex<double>
+    ///
+    inline std::complex<double> unitRoot(uint64 k, uint64 n) noexcept
+    {
+        const auto eighthTurns = 8 * (k % n);
+        const auto octant      = eighthTurns / n;
+        auto       remainder   = eighthTurns % n;
+        if (octant % 2 == 1)
+        {
+            remainder = n - remainder;
+        }
+
+        const auto angle    = constants::pi / 4. * static_cast<double>(remainder) / static_cast<double>(n);
+        auto       cosAngle = std::cos(angle);
+        auto       sinAngle = std::sin(angle);
+        if (octant % 2 == 1)
+        {
+            std::swap(cosAngle, sinAngle);
+        }
+
+        // rotate from the first octant into the appropriate quadrant
+        switch (octant / 2)
+        {
+            case 0:
+            {
+                return { cosAngle, -sinAngle };
+            }
+            case 1:
+            {
+                return { -sinAngle, -cosAngle };
+            }
+            case 2:
+            {
+                return { -cosAngle, sinAngle };
+            }
+            default:
+            {
+                return { sinAngle, cosAngle };
+            }
+        }
+    }
+
+    //================================================================================
+    // Class Description:
+    /// Precomputed Fast Fourier Transform of a fixed length. Lengths whose prime factors
+    /// are all small are transformed with a mixed radix Stockham (autosort) Cooley-Tukey
+    /// algorithm, all other lengths with Bluestein's chirp-z algorithm. The engine is
+    /// immutable once constructed so it may be shared across threads as long as each
+    /// thread supplies its own workspace.
+    ///
+    class FftEngine
+    {
+    public:
+        /// Largest prime factor handled directly by the mixed radix algorithm
+        static constexpr uint32 MAX_DIRECT_RADIX = 32;
+
+        //============================================================================
+        // Method Description:
+        /// Constructor
+        ///
+        /// @param inN: the transform length
+        ///
+        explicit FftEngine(uint32 inN) :
+            n_(inN)
+        {
+            if (n_ < 2)
+            {
+                return;
+            }
+
+            auto remaining = n_;
+            while (remaining % 4 == 0)
+            {
+                radices_.push_back(4);
+                remaining /= 4;
+            }
+
+            for (uint32 factor = 2; static_cast<uint64>(factor) * factor <= remaining; ++factor)
+            {
+                while (remaining % factor == 0)
+                {
+                    radices_.push_back(factor);
+                    remaining /= factor;
+                }
+            }
+
+            if (remaining > 1)
+            {
+                radices_.push_back(remaining);
+            }
+
+            if (*std::max_element(radices_.begin(), radices_.end()) > MAX_DIRECT_RADIX)
+            {
+                radices_.clear();
+                initBluestein();
+            }
+            else
+            {
+                twiddles_.resize(n_);
+                for (uint32 i = 0; i < n_; ++i)
+                {
+                    twiddles_[i] = unitRoot(i, n_);
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The transform length
+        ///
+        /// @return uint32
+        ///
+        [[nodiscard]] uint32 size() const noexcept
+        {
+            return n_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The number of complex elements of workspace required by execute
+        ///
+        /// @return uint32
+        ///
+        [[nodiscard]] uint32 workspaceSize() const noexcept
+        {
+            return bluesteinEngine_ ? 2 * bluesteinEngine_->size() : n_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Performs the unnormalized transform in place
+        ///
+        /// @param data: n elements to transform
+        /// @param workspace: at least workspaceSize() elements of scratch memory
+        /// @param inverse: whether to perform the inverse (positive exponent) transform
+        ///
+        void execute(std::complex<double>* data, std::complex<double>* workspace, bool inverse) const
+        {
+            if (n_ < 2)
+            {
+                return;
+            }
+
+            // the inverse transform is conj(fft(conj(x)))
+            if (inverse)
+            {
+                std::transform(data, data + n_, data, [](const auto& value) { return std::conj(value); });
+            }
+
+            if (bluesteinEngine_)
+            {
+                executeBluestein(data, workspace);
+            }
+            else
+            {
+                executeMixedRadix(data, workspace);
+            }
+
+            if (inverse)
+            {
+                std::transform(data, data + n_, data, [](const auto& value) { return std::conj(value); });
+            }
+        }
+
+    private:
+        //============================================================================
+        // Method Description:
+        /// Precomputes the chirp and the transformed chirp filter for Bluestein's algorithm
+        ///
+        void initBluestein()
+        {
+            uint32 m = 1;
+            while (m < 2 * n_ - 1)
+            {
+                m <<= 1;
+            }
+
+            bluesteinEngine_ = std::make_shared<const FftEngine>(m);
+
+            // k^2 is reduced modulo 2n to keep the chirp angles accurate for large k
+            chirp_.resize(n_);
+            const auto twoN = 2 * static_cast<uint64>(n_);
+            for (uint32 k = 0; k < n_; ++k)
+            {
+                const auto kSquared = (static_cast<uint64>(k) * static_cast<uint64>(k)) % twoN;
+                chirp_[k]           = unitRoot(kSquared, twoN);
+            }
+
+            chirpFilterFft_.assign(m, std::complex<double>{ 0., 0. });
+            chirpFilterFft_[0] = std::conj(chirp_[0]);
+            for (uint32 k = 1; k < n_; ++k)
+            {
+                chirpFilterFft_[k]     = std::conj(chirp_[k]);
+                chirpFilterFft_[m - k] = std::conj(chirp_[k]);
+            }
+
+            std::vector<std::complex<double>> workspace(bluesteinEngine_->workspaceSize());
+            bluesteinEngine_->execute(chirpFilterFft_.data(), workspace.data(), false);
+
+            // fold the 1/m normalization of the inverse convolution transform into the filter
+            const auto scale = 1. / static_cast<double>(m);
+            for (auto& value : chirpFilterFft_)
+            {
+                value *= scale;
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Forward transform via Bluestein's chirp-z algorithm
+        ///
+        /// @param data: n elements to transform
+        /// @param workspace: scratch memory
+        ///
+        void executeBluestein(std::complex<double>* data, std::complex<double>* workspace) const
+        {
+            const auto m                  = bluesteinEngine_->size();
+            auto*      convolution        = workspace;
+            auto*      convolutionScratch = workspace + m;
+
+            for (uint32 k = 0; k < n_; ++k)
+            {
+                convolution[k] = multiply(data[k], chirp_[k]);
+            }
+            std::fill(convolution + n_, convolution + m, std::complex<double>{ 0., 0. });
+
+            bluesteinEngine_->execute(convolution, convolutionScratch, false);
+            for (uint32 k = 0; k < m; ++k)
+            {
+                convolution[k] = multiply(convolution[k], chirpFilterFft_[k]);
+            }
+            bluesteinEngine_->execute(convolution, convolutionScratch, true);
+
+            for (uint32 k = 0; k < n_; ++k)
+            {
+                data[k] = multiply(convolution[k], chirp_[k]);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Forward transform via the mixed radix Stockham algorithm
+        ///
+        /// @param data: n elements to transform
+        /// @param workspace: scratch memory
+        ///
+        void executeMixedRadix(std::complex<double>* data, std::complex<double>* workspace) const
+        {
+            std::array<std::complex<double>, MAX_DIRECT_RADIX> butterflyIn{};
+            std::array<std::complex<double>, MAX_DIRECT_RADIX> butterflyOut{};
+
+            auto*  src           = data;
+            auto*  dst           = workspace;
+            uint32 previousRadix = 1; // product of the radices of the previous stages
+
+            for (const auto radix : radices_)
+            {
+                const auto stride      = n_ / radix;
+                const auto twiddleStep = n_ / (previousRadix * radix);
+
+                for (uint32 j = 0; j < stride; ++j)
+                {
+                    const auto k = j % previousRadix;
+
+                    butterflyIn[0] = src[j];
+                    for (uint32 r = 1; r < radix; ++r)
+                    {
+                        butterflyIn[r] = multiply(src[j + r * stride], twiddles_[k * r * twiddleStep]);
+                    }
+
+                    butterfly(radix, butterflyIn.data(), butterflyOut.data());
+
+                    const auto outIdx = (j - k) * radix + k;
+                    for (uint32 r = 0; r < radix; ++r)
+                    {
+                        dst[outIdx + r * previousRadix] = butterflyOut[r];
+                    }
+                }
+
+                std::swap(src, dst);
+                previousRadix *= radix;
+            }
+
+            if (src != data)
+            {
+                std::copy(src, src + n_, data);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Length radix forward DFT of a single butterfly
+        ///
+        /// @param radix: the butterfly length
+        /// @param in: the butterfly inputs
+        /// @param out: the butterfly outputs
+        ///
+        void butterfly(uint32 radix, const std::complex<double>* in, std::complex<double>* out) const noexcept
+        {
+            switch (radix)
+            {
+                case 2:
+                {
+                    out[0] = in[0] + in[1];
+                    out[1] = in[0] - in[1];
+                    break;
+                }
+                case 3:
+                {
+                    constexpr double sin60 = 0.8660254037844386;
+
+                    const auto sum  = in[1] + in[2];
+                    const auto diff = in[1] - in[2];
+                    const auto mid  = in[0] - 0.5 * sum;
+                    const auto rot  = std::complex<double>{ sin60 * diff.imag(), -sin60 * diff.real() };
+
+                    out[0] = in[0] + sum;
+                    out[1] = mid + rot;
+                    out[2] = mid - rot;
+                    break;
+                }
+                case 4:
+                {
+                    const auto sum02  = in[0] + in[2];
+                    const auto diff02 = in[0] - in[2];
+                    const auto sum13  = in[1] + in[3];
+                    const auto diff13 = in[1] - in[3];
+                    const auto rot13  = std::complex<double>{ diff13.imag(), -diff13.real() }; // -i * diff13
+
+                    out[0] = sum02 + sum13;
+                    out[1] = diff02 + rot13;
+                    out[2] = sum02 - sum13;
+                    out[3] = diff02 - rot13;
+                    break;
+                }
+                case 5:
+                {
+                    constexpr double cos72  = 0.30901699437494742;
+                    constexpr double sin72  = 0.95105651629515357;
+                    constexpr double cos144 = -0.80901699437494742;
+                    constexpr double sin144 = 0.58778525229247313;
+
+                    const auto sum14  = in[1] + in[4];
+                    const auto diff14 = in[1] - in[4];
+                    const auto sum23  = in[2] + in[3];
+                    const auto diff23 = in[2] - in[3];
+
+                    const auto mid1  = in[0] + cos72 * sum14 + cos144 * sum23;
+                    const auto mid2  = in[0] + cos144 * sum14 + cos72 * sum23;
+                    const auto imag1 = sin72 * diff14 + sin144 * diff23;
+                    const auto imag2 = sin144 * diff14 - sin72 * diff23;
+                    const auto rot1  = std::complex<double>{ imag1.imag(), -imag1.real() }; // -i * imag1
+                    const auto rot2  = std::complex<double>{ imag2.imag(), -imag2.real() }; // -i * imag2
+
+                    out[0] = in[0] + sum14 + sum23;
+                    out[1] = mid1 + rot1;
+                    out[2] = mid2 + rot2;
+                    out[3] = mid2 - rot2;
+                    out[4] = mid1 - rot1;
+                    break;
+                }
+                default:
+                {
+                    const auto twiddleStep = n_ / radix;
+                    for (uint32 q = 0; q < radix; ++q)
+                    {
+                        auto sum = in[0];
+                        for (uint32 r = 1; r < radix; ++r)
+                        {
+                            sum += multiply(in[r], twiddles_[((r * q) % radix) * twiddleStep]);
+                        }
+                        out[q] = sum;
+                    }
+                    break;
+                }
+            }
+        }
+
+        //====================================Attributes==============================
+        uint32                            n_{ 0 };
+        std::vector<uint32>               radices_{};
+        std::vector<std::complex<double>> twiddles_{};
+        std::shared_ptr<const FftEngine>  bluesteinEngine_{ nullptr };
+        std::vector<std::complex<double>> chirp_{};
+        std::vector<std::complex<double>> chirpFilterFft_{};
+    };
+
+    //================================================================================
+    // Class Description:
+    /// Precomputed Fast Fourier Transform of a fixed length real sequence. Even lengths
+    /// are packed into a complex sequence of half the length, odd lengths fall back to a
+    /// full length complex transform.
+    ///
+    class RealFftEngine
+    {
+    public:
+        //============================================================================
+        // Method Description:
+        /// Constructor
+        ///
+        /// @param inN: the transform length
+        ///
+        explicit RealFftEngine(uint32 inN) :
+            n_(inN),
+            engine_(std::make_shared<const FftEngine>(inN % 2 == 0 ? inN / 2 : inN))
+        {
+            if (n_ % 2 == 0)
+            {
+                twiddles_.resize(n_ / 2 + 1);
+                for (uint32 k = 0; k < twiddles_.size(); ++k)
+                {
+                    twiddles_[k] = unitRoot(k, n_);
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The transform length
+        ///
+        /// @return uint32
+        ///
+        [[nodiscard]] uint32 size() const noexcept
+        {
+            return n_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The number of non-negative frequency terms, n / 2 + 1
+        ///
+        /// @return uint32
+        ///
+        [[nodiscard]] uint32 numFrequencies() const noexcept
+        {
+            return n_ / 2 + 1;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The number of complex elements of workspace required by forward and inverse
+        ///
+        /// @return uint32
+        ///
+        [[nodiscard]] uint32 workspaceSize() const noexcept
+        {
+            return engine_->size() + engine_->workspaceSize();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Computes the non-negative frequency terms of the forward transform
+        ///
+        /// @param in: n real elements
+        /// @param out: n / 2 + 1 complex elements
+        /// @param workspace: at least workspaceSize() elements of scratch memory
+        ///
+        void forward(const double* in, std::complex<double>* out, std::complex<double>* workspace) const
+        {
+            if (n_ == 0)
+            {
+                return;
+            }
+
+            auto*      packed          = workspace;
+            auto*      engineWorkspace = workspace + engine_->size();
+            const auto halfN           = engine_->size();
+
+            if (n_ % 2 == 1)
+            {
+                std::copy(in, in + n_, packed);
+                engine_->execute(packed, engineWorkspace, false);
+                std::copy(packed, packed + numFrequencies(), out);
+                return;
+            }
+
+            for (uint32 m = 0; m < halfN; ++m)
+            {
+                packed[m] = { in[2 * m], in[2 * m + 1] };
+            }
+
+            engine_->execute(packed, engineWorkspace, false);
+
+            // split the packed spectrum into the spectra of the even and odd samples
+            for (uint32 k = 0; k <= halfN; ++k)
+            {
+                const auto value    = packed[k % halfN];
+                const auto mirror   = std::conj(packed[(halfN - k) % halfN]);
+                const auto evenPart = 0.5 * (value + mirror);
+                const auto diff     = value - mirror;
+                const auto oddPart  = std::complex<double>{ 0.5 * diff.imag(), -0.5 * diff.real() }; // -i/2 * diff
+                out[k]              = evenPart + multiply(twiddles_[k], oddPart);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Computes the unnormalized inverse transform of the non-negative frequency terms
+        /// of a Hermitian spectrum. As with NumPy the imaginary parts of the zero frequency
+        /// (and for even n the Nyquist frequency) term are ignored.
+        ///
+        /// @param in: n / 2 + 1 complex elements
+        /// @param out: n real elements, scaled by n
+        /// @param workspace: at least workspaceSize() elements of scratch memory
+        ///
+        void inverse(const std::complex<double>* in, double* out, std::complex<double>* workspace) const
+        {
+            if (n_ == 0)
+            {
+                return;
+            }
+
+            auto*      packed          = workspace;
+            auto*      engineWorkspace = workspace + engine_->size();
+            const auto halfN           = engine_->size();
+
+            if (n_ % 2 == 1)
+            {
+                packed[0] = in[0].real();
+                for (uint32 k = 1; k < numFrequencies(); ++k)
+                {
+                    packed[k]      = in[k];
+                    packed[n_ - k] = std::conj(in[k]);
+                }
+
+                engine_->execute(packed, engineWorkspace, true);
+                for (uint32 m = 0; m < n_; ++m)
+                {
+                    out[m] = packed[m].real();
+                }
+                return;
+            }
+
+            // recombine the spectra of the even and odd samples into the packed spectrum
+            for (uint32 k = 0; k < halfN; ++k)
+            {
+                const auto value    = k == 0 ? std::complex<double>{ in[0].real(), 0. } : in[k];
+                const auto mirror   = k == 0 ? std::complex<double>{ in[halfN].real(), 0. } : std::conj(in[halfN - k]);
+                const auto evenPart = 0.5 * (value + mirror);
+                const auto oddPart  = multiply(0.5 * (value - mirror), std::conj(twiddles_[k]));
+                packed[k]           = evenPart + std::complex<double>{ -oddPart.imag(), oddPart.real() }; // + i * oddPart
+            }
+
+            engine_->execute(packed, engineWorkspace, true);
+
+            for (uint32 m = 0; m < halfN; ++m)
+            {
+                out[2 * m]     = 2. * packed[m].real();
+                out[2 * m + 1] = 2. * packed[m].imag();
+            }
+        }
+
+    private:
+        //====================================Attributes==============================
+        uint32                            n_{ 0 };
+        std::shared_ptr<const FftEngine>  engine_{ nullptr };
+        std::vector<std::complex<double>> twiddles_{};
+    };
+
+    constexpr uint32 COLUMN_BLOCK_SIZE = 8; ///< columns gathered together by the column transforms
+
+    //============================================================================
+    // Method Description:
+    /// Per thread scratch memory for the batched transforms. The buffer only ever grows
+    /// so that repeated transforms do not allocate.
+    ///
+    /// @param size: the number of elements required
+    /// @return dtype*
+    ///
+    template<typename dtype>
+    dtype* threadWorkspace(std::size_t size)
+    {
+        thread_local std::vector<dtype> workspace;
+        if (workspace.size() < size)
+        {
+            workspace.resize(size);
+        }
+
+        return workspace.data();
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Transforms each row of a row major array in place. As with NumPy the inverse
+    /// transform is scaled by 1/n.
+    ///
+    /// @param engine: engine for the row length
+    /// @param data: the data, numRows x engine.size()
+    /// @param numRows: the number of rows
+    /// @param inverse: whether to perform the inverse transform
+    ///
+    inline void fftRowsInPlace(const FftEngine& engine, std::complex<double>* data, uint32 numRows, bool inverse)
+    {
+        const auto numCols = engine.size();
+        const auto scale   = 1. / static_cast<double>(numCols);
+        parallel::parallelFor(
+            numRows,
+            [&engine, data, numCols, scale, inverse](uint32 row)
+            {
+                auto* rowData = data + static_cast<std::size_t>(row) * numCols;
+                engine.execute(rowData, threadWorkspace<std::complex<double>>(engine.workspaceSize()), inverse);
+                if (inverse)
+                {
+                    std::for_each(rowData, rowData + numCols, [scale](auto& value) { value *= scale; });
+                }
+            });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Transforms the leading columns of a row major array in place. Columns are
+    /// gathered COLUMN_BLOCK_SIZE at a time so that the array is traversed along its
+    /// rows. As with NumPy the inverse transform is scaled by 1/n.
+    ///
+    /// @param engine: engine for the column length
+    /// @param data: the data, engine.size() x numCols
+    /// @param numCols: the number of columns
+    /// @param numColsToTransform: only the first numColsToTransform columns are transformed
+    /// @param inverse: whether to perform the inverse transform
+    ///
+    inline void fftColumnsInPlace(const FftEngine&      engine,
+                                  std::complex<double>* data,
+                                  uint32                numCols,
+                                  uint32                numColsToTransform,
+                                  bool                  inverse)
+    {
+        const auto numRows   = engine.size();
+        const auto scale     = inverse ? 1. / static_cast<double>(numRows) : 1.;
+        const auto lastCol   = std::min(numCols, numColsToTransform);
+        const auto numBlocks = (lastCol + COLUMN_BLOCK_SIZE - 1) / COLUMN_BLOCK_SIZE;
+        parallel::parallelFor(
+            numBlocks,
+            [&engine, data, numRows, numCols, lastCol, scale, inverse](uint32 block)
+            {
+                const auto firstCol  = block * COLUMN_BLOCK_SIZE;
+                const auto blockSize = std::min(COLUMN_BLOCK_SIZE, lastCol - firstCol);
+                auto*      columns   = threadWorkspace<std::complex<double>>(
+                    static_cast<std::size_t>(COLUMN_BLOCK_SIZE) * numRows + engine.workspaceSize());
+                auto* engineWorkspace = columns + static_cast<std::size_t>(COLUMN_BLOCK_SIZE) * numRows;
+
+                for (uint32 row = 0; row < numRows; ++row)
+                {
+                    const auto* rowData = data + static_cast<std::size_t>(row) * numCols + firstCol;
+                    for (uint32 col = 0; col < blockSize; ++col)
+                    {
+                        columns[col * numRows + row] = rowData[col];
+                    }
+                }
+
+                for (uint32 col = 0; col < blockSize; ++col)
+                {
+                    engine.execute(columns + col * numRows, engineWorkspace, inverse);
+                }
+
+                for (uint32 row = 0; row < numRows; ++row)
+                {
+                    auto* rowData = data + static_cast<std::size_t>(row) * numCols + firstCol;
+                    for (uint32 col = 0; col < blockSize; ++col)
+                    {
+                        rowData[col] = columns[col * numRows + row] * scale;
+                    }
+                }
+            });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Computes the non-negative frequency terms of the transform of each row of a
+    /// row major real array
+    ///
+    /// @param engine: engine for the row length
+    /// @param in: the data, numRows x engine.size()
+    /// @param out: the output, numRows x engine.numFrequencies()
+    /// @param numRows: the number of rows
+    ///
+    inline void rfftRows(const RealFftEngine& engine, const double* in, std::complex<double>* out, uint32 numRows)
+    {
+        const auto n              = engine.size();
+        const auto numFrequencies = engine.numFrequencies();
+        parallel::parallelFor(
+            numRows,
+            [&engine, in, out, n, numFrequencies](uint32 row)
+            {
+                engine.forward(in + static_cast<std::size_t>(row) * n,
+                               out + static_cast<std::size_t>(row) * numFrequencies,
+                               threadWorkspace<std::complex<double>>(engine.workspaceSize()));
+            });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Computes the inverse transform of each row of the non-negative frequency terms
+    /// of a row major Hermitian array. As with NumPy the result is scaled by 1/n.
+    ///
+    /// @param engine: engine for the real row length
+    /// @param in: the data, numRows x engine.numFrequencies()
+    /// @param out: the output, numRows x engine.size()
+    /// @param numRows: the number of rows
+    ///
+    inline void irfftRows(const RealFftEngine& engine, const std::complex<double>* in, double* out, uint32 numRows)
+    {
+        const auto n              = engine.size();
+        const auto numFrequencies = engine.numFrequencies();
+        const auto scale          = 1. / static_cast<double>(n);
+        parallel::parallelFor(
+            numRows,
+            [&engine, in, out, n, numFrequencies, scale](uint32 row)
+            {
+                auto* rowData = out + static_cast<std::size_t>(row) * n;
+                engine.inverse(in + static_cast<std::size_t>(row) * numFrequencies,
+                               rowData,
+                               threadWorkspace<std::complex<double>>(engine.workspaceSize()));
+                std::for_each(rowData, rowData + n, [scale](auto& value) { value *= scale; });
+            });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Computes the non-negative frequency terms of the transform of each column of a
+    /// row major real array
+    ///
+    /// @param engine: engine for the column length
+    /// @param in: the data, engine.size() x numCols
+    /// @param out: the output, engine.numFrequencies() x numCols
+    /// @param numCols: the number of columns
+    ///
+    inline void rfftColumns(const RealFftEngine& engine, const double* in, std::complex<double>* out, uint32 numCols)
+    {
+        const auto n              = engine.size();
+        const auto numFrequencies = engine.numFrequencies();
+        const auto numBlocks      = (numCols + COLUMN_BLOCK_SIZE - 1) / COLUMN_BLOCK_SIZE;
+        parallel::parallelFor(
+            numBlocks,
+            [&engine, in, out, n, numFrequencies, numCols](uint32 block)
+            {
+                const auto firstCol  = block * COLUMN_BLOCK_SIZE;
+                const auto blockSize = std::min(COLUMN_BLOCK_SIZE, numCols - firstCol);
+                auto* columns = threadWorkspace<double>(static_cast<std::size_t>(COLUMN_BLOCK_SIZE) * n);
+                auto* spectra = threadWorkspace<std::complex<double>>(
+                    static_cast<std::size_t>(COLUMN_BLOCK_SIZE) * numFrequencies + engine.workspaceSize());
+                auto* engineWorkspace = spectra + static_cast<std::size_t>(COLUMN_BLOCK_SIZE) * numFrequencies;
+
+                for (uint32 row = 0; row < n; ++row)
+                {
+                    const auto* rowData = in + static_cast<std::size_t>(row) * numCols + firstCol;
+                    for (uint32 col = 0; col < blockSize; ++col)
+                    {
+                        columns[col * n + row] = rowData[col];
+                    }
+                }
+
+                for (uint32 col = 0; col < blockSize; ++col)
+                {
+                    engine.forward(columns + col * n, spectra + col * numFrequencies, engineWorkspace);
+                }
+
+                for (uint32 row = 0; row < numFrequencies; ++row)
+                {
+                    auto* rowData = out + static_cast<std::size_t>(row) * numCols + firstCol;
+                    for (uint32 col = 0; col < blockSize; ++col)
+                    {
+                        rowData[col] = spectra[col * numFrequencies + row];
+                    }
+                }
+            });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Computes the inverse transform of each column of the non-negative frequency
+    /// terms of a row major Hermitian array. As with NumPy the result is scaled by 1/n.
+    ///
+    /// @param engine: engine for the real column length
+    /// @param in: the data, engine.numFrequencies() x numCols
+    /// @param out: the output, engine.size() x numCols
+    /// @param numCols: the number of columns
+    ///
+    inline void irfftColumns(const RealFftEngine& engine, const std::complex<double>* in, double* out, uint32 numCols)
+    {
+        const auto n              = engine.size();
+        const auto numFrequencies = engine.numFrequencies();
+        const auto scale          = 1. / static_cast<double>(n);
+        const auto numBlocks      = (numCols + COLUMN_BLOCK_SIZE - 1) / COLUMN_BLOCK_SIZE;
+        parallel::parallelFor(
+            numBlocks,
+            [&engine, in, out, n, numFrequencies, numCols, scale](uint32 block)
+            {
+                const auto firstCol  = block * COLUMN_BLOCK_SIZE;
+                const auto blockSize = std::min(COLUMN_BLOCK_SIZE, numCols - firstCol);
+                auto* columns = threadWorkspace<double>(static_cast<std::size_t>(COLUMN_BLOCK_SIZE) * n);
+                auto* spectra = threadWorkspace<std::complex<double>>(
+                    static_cast<std::size_t>(COLUMN_BLOCK_SIZE) * numFrequencies + engine.workspaceSize());
+                auto* engineWorkspace = spectra + static_cast<std::size_t>(COLUMN_BLOCK_SIZE) * numFrequencies;
+
+                for (uint32 row = 0; row < numFrequencies; ++row)
+                {
+                    const auto* rowData = in + static_cast<std::size_t>(row) * numCols + firstCol;
+                    for (uint32 col = 0; col < blockSize; ++col)
+                    {
+                        spectra[col * numFrequencies + row] = rowData[col];
+                    }
+                }
+
+                for (uint32 col = 0; col < blockSize; ++col)
+                {
+                    engine.inverse(spectra + col * numFrequencies, columns + col * n, engineWorkspace);
+                }
+
+                for (uint32 row = 0; row < n; ++row)
+                {
+                    auto* rowData = out + static_cast<std::size_t>(row) * numCols + firstCol;
+                    for (uint32 col = 0; col < blockSize; ++col)
+                    {
+                        rowData[col] = columns[col * n + row] * scale;
+                    }
+                }
+            });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Performs the one-dimensional transform in place. As with NumPy the inverse
+    /// transform is scaled by 1/n.
+    ///
+    /// @param data: the data
+    /// @param n: the transform length
+    /// @param inverse: whether to perform the inverse transform
+    ///
+    inline void fftInPlace(std::complex<double>* data, uint32 n, bool inverse)
+    {
+        fftRowsInPlace(FftEngine(n), data, 1, inverse);
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Performs the two-dimensional transform of a row major array in place. As with
+    /// NumPy the inverse transform is scaled by 1/n along each axis.
+    ///
+    /// @param data: the data
+    /// @param numRows: the number of rows
+    /// @param numCols: the number of columns
+    /// @param inverse: whether to perform the inverse transform
+    /// @param numColsToTransform: only the first numColsToTransform columns are transformed
+    ///                            along the rows axis, the remainder are left half transformed
+    ///
+    inline void fft2InPlace(std::complex<double>* data,
+                            uint32                numRows,
+                            uint32                numCols,
+                            bool                  inverse,
+                            uint32                numColsToTransform)
+    {
+        fftRowsInPlace(FftEngine(numCols), data, numRows, inverse);
+        fftColumnsInPlace(FftEngine(numRows), data, numCols, numColsToTransform, inverse);
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Transforms along an axis of an array without transposing it. The transformed
+    /// axis is truncated or zero padded to length n, Axis::NONE transforms the
+    /// flattened array.
+    ///
+    /// @param inArray: the data
+    /// @param n: length of the transformed axis of the output
+    /// @param inAxis: the axis to transform along
+    /// @param inverse: whether to perform the inverse transform
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::complex<double>> fftAxis(const NdArray<dtype>& inArray, uint32 n, Axis inAxis, bool inverse)
+    {
+        if (n == 0)
+        {
+            return {};
+        }
+
+        const auto toComplex = [](const dtype& value) { return static_cast<std::complex<double>>(value); };
+
+        switch (inAxis)
+        {
+            case Axis::NONE:
+            case Axis::COL:
+            {
+                const auto shape  = inAxis == Axis::NONE ? Shape(1, inArray.size()) : inArray.shape();
+                auto       result = NdArray<std::complex<double>>(shape.rows, n);
+                result.zeros();
+
+                const auto numToCopy = std::min(n, shape.cols);
+                for (uint32 row = 0; row < shape.rows; ++row)
+                {
+                    const auto* rowData = inArray.data() + static_cast<std::size_t>(row) * shape.cols;
+                    std::transform(rowData, rowData + numToCopy, result.begin(row), toComplex);
+                }
+
+                if (result.size() > 0)
+                {
+                    fftRowsInPlace(FftEngine(n), result.data(), shape.rows, inverse);
+                }
+
+                return result;
+            }
+            case Axis::ROW:
+            {
+                const auto& shape  = inArray.shape();
+                auto        result = NdArray<std::complex<double>>(n, shape.cols);
+                result.zeros();
+
+                const auto numToCopy = static_cast<std::size_t>(std::min(n, shape.rows)) * shape.cols;
+                std::transform(inArray.data(), inArray.data() + numToCopy, result.data(), toComplex);
+
+                if (result.size() > 0)
+                {
+                    fftColumnsInPlace(FftEngine(n), result.data(), shape.cols, shape.cols, inverse);
+                }
+
+                return result;
+            }
+            default:
+            {
+                THROW_INVALID_ARGUMENT_ERROR("Unimplemented axis type.");
+                return {};
+            }
+        }
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Computes the non-negative frequency terms of the transform of a real array along
+    /// an axis without transposing it. The transformed axis is truncated or zero padded
+    /// to length n, Axis::NONE transforms the flattened array.
+    ///
+    /// @param inArray: the data
+    /// @param n: length of the transformed axis of the input
+    /// @param inAxis: the axis to transform along
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::complex<double>> rfftAxis(const NdArray<dtype>& inArray, uint32 n, Axis inAxis)
+    {
+        if (n == 0)
+        {
+            return {};
+        }
+
+        const auto toDouble       = [](const dtype& value) { return static_cast<double>(value); };
+        const auto numFrequencies = n / 2 + 1;
+
+        switch (inAxis)
+        {
+            case Axis::NONE:
+            case Axis::COL:
+            {
+                const auto shape  = inAxis == Axis::NONE ? Shape(1, inArray.size()) : inArray.shape();
+                auto       padded = NdArray<double>(shape.rows, n);
+                padded.zeros();
+
+                const auto numToCopy = std::min(n, shape.cols);
+                for (uint32 row = 0; row < shape.rows; ++row)
+                {
+                    const auto* rowData = inArray.data() + static_cast<std::size_t>(row) * shape.cols;
+                    std::transform(rowData, rowData + numToCopy, padded.begin(row), toDouble);
+                }
+
+                auto result = NdArray<std::complex<double>>(shape.rows, numFrequencies);
+                if (padded.size() > 0)
+                {
+                    rfftRows(RealFftEngine(n), padded.data(), result.data(), shape.rows);
+                }
+
+                return result;
+            }
+            case Axis::ROW:
+            {
+                const auto& shape  = inArray.shape();
+                auto        padded = NdArray<double>(n, shape.cols);
+                padded.zeros();
+
+                const auto numToCopy = static_cast<std::size_t>(std::min(n, shape.rows)) * shape.cols;
+                std::transform(inArray.data(), inArray.data() + numToCopy, padded.data(), toDouble);
+
+                auto result = NdArray<std::complex<double>>(numFrequencies, shape.cols);
+                if (padded.size() > 0)
+                {
+                    rfftColumns(RealFftEngine(n), padded.data(), result.data(), shape.cols);
+                }
+
+                return result;
+            }
+            default:
+            {
+                THROW_INVALID_ARGUMENT_ERROR("Unimplemented axis type.");
+                return {};
+            }
+        }
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Computes the real inverse transform of the non-negative frequency terms of a
+    /// Hermitian array along an axis without transposing it. As with NumPy the first
+    /// n / 2 + 1 terms of the transformed axis are used, zero padding if necessary.
+    /// Axis::NONE transforms the flattened array.
+    ///
+    /// @param inArray: the data
+    /// @param n: length of the transformed axis of the output
+    /// @param inAxis: the axis to transform along
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<double> irfftAxis(const NdArray<std::complex<dtype>>& inArray, uint32 n, Axis inAxis)
+    {
+        if (n == 0)
+        {
+            return {};
+        }
+
+        const auto toComplex      = [](const std::complex<dtype>& value)
+        { return static_cast<std::complex<double>>(value); };
+        const auto numFrequencies = n / 2 + 1;
+
+        switch (inAxis)
+        {
+            case Axis::NONE:
+            case Axis::COL:
+            {
+                const auto shape  = inAxis == Axis::NONE ? Shape(1, inArray.size()) : inArray.shape();
+                auto       padded = NdArray<std::complex<double>>(shape.rows, numFrequencies);
+                padded.zeros();
+
+                const auto numToCopy = std::min(numFrequencies, shape.cols);
+                for (uint32 row = 0; row < shape.rows; ++row)
+                {
+                    const auto* rowData = inArray.data() + static_cast<std::size_t>(row) * shape.cols;
+                    std::transform(rowData, rowData + numToCopy, padded.begin(row), toComplex);
+                }
+
+                auto result = NdArray<double>(shape.rows, n);
+                if (result.size() > 0)
+                {
+                    irfftRows(RealFftEngine(n), padded.data(), result.data(), shape.rows);
+                }
+
+                return result;
+            }
+            case Axis::ROW:
+            {
+                const auto& shape  = inArray.shape();
+                auto        padded = NdArray<std::complex<double>>(numFrequencies, shape.cols);
+                padded.zeros();
+
+                const auto numToCopy = static_cast<std::size_t>(std::min(numFrequencies, shape.rows)) * shape.cols;
+                std::transform(inArray.data(), inArray.data() + numToCopy, padded.data(), toComplex);
+
+                auto result = NdArray<double>(n, shape.cols);
+                if (result.size() > 0)
+                {
+                    irfftColumns(RealFftEngine(n), padded.data(), result.data(), shape.cols);
+                }
+
+                return result;
+            }
+            default:
+            {
+                THROW_INVALID_ARGUMENT_ERROR("Unimplemented axis type.");
+                return {};
+            }
+        }
+    }
+} // namespace nc::fft::detail
@@ -0,0 +1,392 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Reusable Fast Fourier Transform plans
+///
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Shape.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/FFT/FftEngine.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::fft
+{
+    //================================================================================
+    // Class Description:
+    /// The transform a Plan performs
+    enum class Transform
+    {
+        FFT = 0, ///< complex forward transform, see fft/fft2
+        IFFT,    ///< complex inverse transform, see ifft/ifft2
+        RFFT,    ///< real forward transform, see rfft/rfft2
+        IRFFT    ///< real inverse transform, see irfft/irfft2
+    };
+
+    namespace detail
+    {
+        //============================================================================
+        // Method Description:
+        /// Per thread scratch memory for the column pass of two dimensional IRFFT plans.
+        /// The buffer only ever grows so that repeated executions do not allocate.
+        ///
+        /// @param size: the number of elements required
+        /// @return std::complex<double>*
+        ///
+        inline std::complex<double>* planWorkspace(std::size_t size)
+        {
+            thread_local std::vector<std::complex<double>> workspace;
+            if (workspace.size() < size)
+            {
+                workspace.resize(size);
+            }
+
+            return workspace.data();
+        }
+    } // namespace detail
+
+    //================================================================================
+    // Class Description:
+    /// A reusable one or two dimensional Fast Fourier Transform of a fixed shape. All
+    /// twiddle factors and sub-transforms are computed once at construction. Executing
+    /// a plan is const and uses per thread scratch memory, so a single plan may be
+    /// shared by multiple threads, and executing into a correctly sized output array
+    /// does not allocate (other than the scheduling of rows across threads when
+    /// NUMCPP_USE_MULTITHREAD is defined). Copies of a plan share the precomputed tables.
+    ///
+    class Plan
+    {
+    public:
+        //============================================================================
+        // Method Description:
+        /// One dimensional plan
+        ///
+        /// @param inN: length of the transformed axis of the output (real space length for
+        ///             the real transforms)
+        /// @param inTransform: the transform to perform
+        ///
+        Plan(uint32 inN, Transform inTransform) :
+            Plan(Shape(1, inN), inTransform, false)
+        {
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Two dimensional plan
+        ///
+        /// @param inShape: shape of the transform (real space shape for the real transforms)
+        /// @param inTransform: the transform to perform
+        ///
+        Plan(const Shape& inShape, Transform inTransform) :
+            Plan(inShape, inTransform, true)
+        {
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The transform performed
+        ///
+        /// @return Transform
+        ///
+        [[nodiscard]] Transform transform() const noexcept
+        {
+            return transform_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Whether the plan is two dimensional
+        ///
+        /// @return bool
+        ///
+        [[nodiscard]] bool is2d() const noexcept
+        {
+            return is2d_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The required shape of the input array
+        ///
+        /// @return Shape
+        ///
+        [[nodiscard]] const Shape& inputShape() const noexcept
+        {
+            return inputShape_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The shape of the output array
+        ///
+        /// @return Shape
+        ///
+        [[nodiscard]] const Shape& outputShape() const noexcept
+        {
+            return outputShape_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Executes a FFT or IFFT plan into a caller provided output array. The output
+        /// is reshaped in place when it already has the size of outputShape() and is only
+        /// reallocated otherwise. It may be the same array as the input, a one dimensional
+        /// row or column vector then comes back as a row vector.
+        ///
+        /// @param inArray: array of inputShape()
+        /// @param outArray: the output array
+        ///
+        void execute(const NdArray<std::complex<double>>& inArray, NdArray<std::complex<double>>& outArray) const
+        {
+            checkTransform(transform_ == Transform::FFT || transform_ == Transform::IFFT);
+            checkInput(inArray.shape());
+            prepareOutput(outArray, inArray.data());
+
+            if (outArray.data() != inArray.data())
+            {
+                std::copy(inArray.begin(), inArray.end(), outArray.begin());
+            }
+
+            const auto inverse = transform_ == Transform::IFFT;
+            detail::fftRowsInPlace(*rowEngine_, outArray.data(), shape_.rows, inverse);
+            if (is2d_)
+            {
+                detail::fftColumnsInPlace(*colEngine_, outArray.data(), shape_.cols, shape_.cols, inverse);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Executes a RFFT plan into a caller provided output array. The output is only
+        /// reallocated if it does not already have the size of outputShape().
+        ///
+        /// @param inArray: array of inputShape()
+        /// @param outArray: the output array
+        ///
+        void execute(const NdArray<double>& inArray, NdArray<std::complex<double>>& outArray) const
+        {
+            checkTransform(transform_ == Transform::RFFT);
+            checkInput(inArray.shape());
+            prepareOutput(outArray, inArray.data());
+
+            detail::rfftRows(*realRowEngine_, inArray.data(), outArray.data(), shape_.rows);
+            if (is2d_)
+            {
+                const auto numFrequencies = realRowEngine_->numFrequencies();
+                detail::fftColumnsInPlace(*colEngine_, outArray.data(), numFrequencies, numFrequencies, false);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Executes an IRFFT plan into a caller provided output array. The output is only
+        /// reallocated if it does not already have the size of outputShape().
+        ///
+        /// @param inArray: array of inputShape(), the non-negative frequency terms
+        /// @param outArray: the output array
+        ///
+        void execute(const NdArray<std::complex<double>>& inArray, NdArray<double>& outArray) const
+        {
+            checkTransform(transform_ == Transform::IRFFT);
+            checkInput(inArray.shape());
+            prepareOutput(outArray, inArray.data());
+
+            const std::complex<double>* spectrum = inArray.data();
+            if (is2d_)
+            {
+                // the column transforms can not be done in place on the const input
+                const auto numFrequencies = realRowEngine_->numFrequencies();
+                auto*      columnSpectrum = detail::planWorkspace(inArray.size());
+                std::copy(inArray.begin(), inArray.end(), columnSpectrum);
+                detail::fftColumnsInPlace(*colEngine_, columnSpectrum, numFrequencies, numFrequencies, true);
+                spectrum = columnSpectrum;
+            }
+
+            detail::irfftRows(*realRowEngine_, spectrum, outArray.data(), shape_.rows);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Executes a FFT or IFFT plan into a new array
+        ///
+        /// @param inArray: array of inputShape()
+        /// @return NdArray
+        ///
+        [[nodiscard]] NdArray<std::complex<double>> operator()(const NdArray<std::complex<double>>& inArray) const
+        {
+            if (transform_ == Transform::IRFFT)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("IRFFT plans produce real output, use execute() with an NdArray<double>.");
+            }
+
+            auto result = NdArray<std::complex<double>>(outputShape_);
+            execute(inArray, result);
+            return result;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Executes a RFFT plan into a new array
+        ///
+        /// @param inArray: array of inputShape()
+        /// @return NdArray
+        ///
+        [[nodiscard]] NdArray<std::complex<double>> operator()(const NdArray<double>& inArray) const
+        {
+            auto result = NdArray<std::complex<double>>(outputShape_);
+            execute(inArray, result);
+            return result;
+        }
+
+    private:
+        //============================================================================
+        // Method Description:
+        /// Constructor
+        ///
+        /// @param inShape: shape of the transform
+        /// @param inTransform: the transform to perform
+        /// @param inIs2d: whether the plan is two dimensional
+        ///
+        Plan(const Shape& inShape, Transform inTransform, bool inIs2d) :
+            transform_(inTransform),
+            is2d_(inIs2d),
+            shape_(inShape),
+            inputShape_(inShape),
+            outputShape_(inShape)
+        {
+            if (shape_.size() == 0)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("Plan shape must be non-empty.");
+            }
+
+            switch (transform_)
+            {
+                case Transform::FFT:
+                case Transform::IFFT:
+                {
+                    rowEngine_ = std::make_shared<const detail::FftEngine>(shape_.cols);
+                    break;
+                }
+                case Transform::RFFT:
+                case Transform::IRFFT:
+                {
+                    realRowEngine_ = std::make_shared<const detail::RealFftEngine>(shape_.cols);
+
+                    auto& spectrumShape = transform_ == Transform::RFFT ? outputShape_ : inputShape_;
+                    spectrumShape.cols  = realRowEngine_->numFrequencies();
+                    break;
+                }
+                default:
+                {
+                    THROW_INVALID_ARGUMENT_ERROR("Unimplemented transform type.");
+                }
+            }
+
+            if (is2d_)
+            {
+                colEngine_ = std::make_shared<const detail::FftEngine>(shape_.rows);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Throws if the execute overload does not match the transform
+        ///
+        /// @param inMatches
+        ///
+        static void checkTransform(bool inMatches)
+        {
+            if (!inMatches)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("Input/output types do not match the plan's transform.");
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Throws if the input does not have the plan's input shape. One dimensional plans
+        /// accept row or column vectors.
+        ///
+        /// @param inShape
+        ///
+        void checkInput(const Shape& inShape) const
+        {
+            const auto matches = is2d_ ? inShape == inputShape_ : inShape.size() == inputShape_.size();
+            if (!matches)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("Input array shape " + inShape.str() + " does not match the plan's " +
+                                             inputShape_.str() + ".");
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Gives the output array the output shape. An array that already has the output
+        /// size is reshaped in place, anything else is reallocated, which is not allowed
+        /// when the output is also the input.
+        ///
+        /// @param outArray
+        /// @param inData: data of the input array
+        ///
+        template<typename dtype>
+        void prepareOutput(NdArray<dtype>& outArray, const void* inData) const
+        {
+            if (outArray.shape() == outputShape_)
+            {
+                return;
+            }
+
+            if (outArray.size() == outputShape_.size())
+            {
+                outArray.reshape(outputShape_);
+                return;
+            }
+
+            if (static_cast<const void*>(outArray.data()) == inData)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("The output array can only be the input array when it has the output size.");
+            }
+
+            outArray.resizeFast(outputShape_);
+        }
+
+        //====================================Attributes==============================
+        Transform                                    transform_{ Transform::FFT };
+        bool                                         is2d_{ false };
+        Shape                                        shape_{};
+        Shape                                        inputShape_{};
+        Shape                                        outputShape_{};
+        std::shared_ptr<const detail::FftEngine>     rowEngine_{ nullptr };
+        std::shared_ptr<const detail::RealFftEngine> realRowEngine_{ nullptr };
+        std::shared_ptr<const detail::FftEngine>     colEngine_{ nullptr };
+    };
+} // namespace nc::fft
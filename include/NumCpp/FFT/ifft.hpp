@@ -29,53 +29,13 @@
 
 #include <complex>
 
-#include "NumCpp/Core/Constants.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
-#include "NumCpp/Core/Internal/StlAlgorithms.hpp"
 #include "NumCpp/Core/Types.hpp"
-#include "NumCpp/Functions/complex.hpp"
+#include "NumCpp/FFT/FftEngine.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::fft
 {
-    namespace detail
-    {
-        //===========================================================================
-        // Method Description:
-        /// Inverse Fast Fourier Transform
-        ///
-        /// @param x the data
-        /// @param n Length of the transformed axis of the output.
-        ///
-        inline NdArray<std::complex<double>> ifft_internal(const NdArray<std::complex<double>>& x, uint32 n)
-        {
-            if (n == 0)
-            {
-                return {};
-            }
-
-            auto result = NdArray<std::complex<double>>(1, n);
-
-            stl_algorithms::for_each(result.begin(),
-                                     result.end(),
-                                     [&](auto& resultElement)
-                                     {
-                                         const auto m = static_cast<double>(&resultElement - result.data());
-                                         const auto minusTwoPiKOverN = constants::twoPi * m / static_cast<double>(n);
-                                         resultElement               = std::complex<double>{ 0., 0. };
-                                         for (auto k = 0u; k < std::min(n, x.size()); ++k)
-                                         {
-                                             const auto angle = minusTwoPiKOverN * static_cast<double>(k);
-                                             resultElement += (x[k] * std::polar(1., angle));
-                                         }
-
-                                         resultElement /= n;
-                                     });
-
-            return result;
-        }
-    } // namespace detail
-
     //===========================================================================
     // Method Description:
     /// Compute the one-dimensional inverse discrete Fourier Transform.
@@ -93,40 +53,7 @@ namespace nc::fft
     {
         STATIC_ASSERT_ARITHMETIC(dtype);
 
-        switch (inAxis)
-        {
-            case Axis::NONE:
-            {
-                const auto data = nc::complex<dtype, double>(inArray);
-                return detail::ifft_internal(data, inN);
-            }
-            case Axis::COL:
-            {
-                auto        data           = nc::complex<dtype, double>(inArray);
-                const auto& shape          = inArray.shape();
-                auto        result         = NdArray<std::complex<double>>(shape.rows, inN);
-                const auto  dataColSlice   = data.cSlice();
-                const auto  resultColSlice = result.cSlice();
-
-                for (uint32 row = 0; row < data.numRows(); ++row)
-                {
-                    const auto rowData   = data(row, dataColSlice);
-                    const auto rowResult = detail::ifft_internal(rowData, inN);
-                    result.put(row, resultColSlice, rowResult);
-                }
-
-                return result;
-            }
-            case Axis::ROW:
-            {
-                return ifft(inArray.transpose(), inN, Axis::COL).transpose();
-            }
-            default:
-            {
-                THROW_INVALID_ARGUMENT_ERROR("Unimplemented axis type.");
-                return {};
-            }
-        }
+        return detail::fftAxis(inArray, inN, inAxis, true);
     }
 
     //===========================================================================
@@ -185,40 +112,7 @@ namespace nc::fft
     {
         STATIC_ASSERT_ARITHMETIC(dtype);
 
-        switch (inAxis)
-        {
-            case Axis::NONE:
-            {
-                const auto data = nc::complex<dtype, double>(inArray);
-                return detail::ifft_internal(data, inN);
-            }
-            case Axis::COL:
-            {
-                const auto  data           = nc::complex<dtype, double>(inArray);
-                const auto& shape          = inArray.shape();
-                auto        result         = NdArray<std::complex<double>>(shape.rows, inN);
-                const auto  dataColSlice   = data.cSlice();
-                const auto  resultColSlice = result.cSlice();
-
-                for (uint32 row = 0; row < data.numRows(); ++row)
-                {
-                    const auto rowData   = data(row, dataColSlice);
-                    const auto rowResult = detail::ifft_internal(rowData, inN);
-                    result.put(row, resultColSlice, rowResult);
-                }
-
-                return result;
-            }
-            case Axis::ROW:
-            {
-                return ifft(inArray.transpose(), inN, Axis::COL).transpose();
-            }
-            default:
-            {
-                THROW_INVALID_ARGUMENT_ERROR("Unimplemented axis type.");
-                return {};
-            }
-        }
+        return detail::fftAxis(inArray, inN, inAxis, true);
     }
 
     //============================================================================
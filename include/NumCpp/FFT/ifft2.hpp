@@ -30,7 +30,9 @@
 #include <complex>
 
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Internal/StlAlgorithms.hpp"
 #include "NumCpp/Core/Types.hpp"
+#include "NumCpp/FFT/FftEngine.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::fft
@@ -52,28 +54,16 @@ namespace nc::fft
             }
 
             auto result = NdArray<std::complex<double>>(shape.rows, shape.cols);
+            result.zeros();
 
-            stl_algorithms::for_each(result.begin(),
-                                     result.end(),
-                                     [&](auto& resultElement)
-                                     {
-                                         const auto i  = &resultElement - result.data();
-                                         const auto m  = static_cast<double>(i / shape.cols);
-                                         const auto n  = static_cast<double>(i % shape.cols);
-                                         resultElement = std::complex<double>{ 0., 0. };
-                                         for (auto k = 0u; k < std::min(shape.rows, x.numRows()); ++k)
-                                         {
-                                             for (auto l = 0u; l < std::min(shape.cols, x.numCols()); ++l)
-                                             {
-                                                 const auto angle =
-                                                     constants::twoPi *
-                                                     (((static_cast<double>(k) * m) / static_cast<double>(shape.rows)) +
-                                                      ((static_cast<double>(l) * n) / static_cast<double>(shape.cols)));
-                                                 resultElement += (x(k, l) * std::polar(1., angle));
-                                             }
-                                         }
-                                         resultElement /= shape.size();
-                                     });
+            const auto numRows = std::min(shape.rows, x.numRows());
+            const auto numCols = std::min(shape.cols, x.numCols());
+            for (uint32 row = 0; row < numRows; ++row)
+            {
+                stl_algorithms::copy(x.begin(row), x.begin(row) + numCols, result.begin(row));
+            }
+
+            fft2InPlace(result.data(), shape.rows, shape.cols, true, shape.cols);
 
             return result;
         }
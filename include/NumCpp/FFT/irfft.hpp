@@ -29,61 +29,13 @@
 
 #include <complex>
 
-#include "NumCpp/Core/Constants.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
-#include "NumCpp/Core/Internal/StlAlgorithms.hpp"
 #include "NumCpp/Core/Types.hpp"
-#include "NumCpp/FFT/ifft.hpp"
-#include "NumCpp/Functions/complex.hpp"
-#include "NumCpp/Functions/real.hpp"
+#include "NumCpp/FFT/FftEngine.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::fft
 {
-    namespace detail
-    {
-        //===========================================================================
-        // Method Description:
-        /// Inverse Fast Fourier Transform
-        ///
-        /// @param x the data
-        /// @param n Length of the transformed axis of the output.
-        ///
-        inline NdArray<double> irfft_internal(const NdArray<std::complex<double>>& x, uint32 n)
-        {
-            if (x.size() == 0 || n == 0)
-            {
-                return {};
-            }
-
-            const auto necessaryInputPoints = n / 2 + 1;
-            auto       input                = NdArray<std::complex<double>>{};
-            if (x.size() > necessaryInputPoints)
-            {
-                input = x.flatten()(0, Slice(necessaryInputPoints + 1));
-            }
-            else if (x.size() < necessaryInputPoints)
-            {
-                input = NdArray<std::complex<double>>(1, necessaryInputPoints).zeros();
-                stl_algorithms::copy(x.begin(), x.end(), input.begin());
-            }
-            else
-            {
-                input = x;
-            }
-
-            auto realN = 2 * (input.size() - 1);
-            realN += n % 2 == 1 ? 1 : 0;
-            auto fullOutput = NdArray<std::complex<double>>(1, realN);
-            stl_algorithms::copy(input.begin(), input.end(), fullOutput.begin());
-            stl_algorithms::transform(fullOutput.begin() + 1,
-                                      fullOutput.begin() + input.size(),
-                                      fullOutput.rbegin(),
-                                      [](const auto& value) { return std::conj(value); });
-            return real(ifft_internal(fullOutput, n));
-        }
-    } // namespace detail
-
     //============================================================================
     // Method Description:
     /// Compute the one-dimensional inverse discrete Fourier Transform for real inputs.
@@ -101,40 +53,7 @@ namespace nc::fft
     {
         STATIC_ASSERT_ARITHMETIC(dtype);
 
-        switch (inAxis)
-        {
-            case Axis::NONE:
-            {
-                const auto data = nc::complex<dtype, double>(inArray);
-                return detail::irfft_internal(data, inN);
-            }
-            case Axis::COL:
-            {
-                const auto  data           = nc::complex<dtype, double>(inArray);
-                const auto& shape          = inArray.shape();
-                auto        result         = NdArray<double>(shape.rows, inN);
-                const auto  dataColSlice   = data.cSlice();
-                const auto  resultColSlice = result.cSlice();
-
-                for (uint32 row = 0; row < data.numRows(); ++row)
-                {
-                    const auto rowData   = data(row, dataColSlice);
-                    const auto rowResult = detail::irfft_internal(rowData, inN);
-                    result.put(row, resultColSlice, rowResult);
-                }
-
-                return result;
-            }
-            case Axis::ROW:
-            {
-                return irfft(inArray.transpose(), inN, Axis::COL).transpose();
-            }
-            default:
-            {
-                THROW_INVALID_ARGUMENT_ERROR("Unimplemented axis type.");
-                return {};
-            }
-        }
+        return detail::irfftAxis(inArray, inN, inAxis);
     }
 
     //============================================================================
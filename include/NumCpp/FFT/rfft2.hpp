@@ -30,7 +30,9 @@
 #include <complex>
 
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Internal/StlAlgorithms.hpp"
 #include "NumCpp/Core/Types.hpp"
+#include "NumCpp/FFT/FftEngine.hpp"
 #include "NumCpp/Functions/complex.hpp"
 #include "NumCpp/NdArray.hpp"
 
@@ -52,29 +54,24 @@ namespace nc::fft
                 return {};
             }
 
-            const auto realN  = shape.cols / 2 + 1;
-            auto       result = NdArray<std::complex<double>>(shape.rows, realN);
+            const auto realN      = shape.cols / 2 + 1;
+            auto       fullOutput = NdArray<std::complex<double>>(shape.rows, shape.cols);
+            fullOutput.zeros();
 
-            stl_algorithms::for_each(result.begin(),
-                                     result.end(),
-                                     [&](auto& resultElement)
-                                     {
-                                         const auto i  = &resultElement - result.data();
-                                         const auto k  = static_cast<double>(i / realN);
-                                         const auto l  = static_cast<double>(i % realN);
-                                         resultElement = std::complex<double>{ 0., 0. };
-                                         for (auto m = 0u; m < std::min(shape.rows, x.numRows()); ++m)
-                                         {
-                                             for (auto n = 0u; n < std::min(shape.cols, x.numCols()); ++n)
-                                             {
-                                                 const auto angle =
-                                                     -constants::twoPi *
-                                                     (((static_cast<double>(m) * k) / static_cast<double>(shape.rows)) +
-                                                      ((static_cast<double>(n) * l) / static_cast<double>(shape.cols)));
-                                                 resultElement += (x(m, n) * std::polar(1., angle));
-                                             }
-                                         }
-                                     });
+            const auto numRows = std::min(shape.rows, x.numRows());
+            const auto numCols = std::min(shape.cols, x.numCols());
+            for (uint32 row = 0; row < numRows; ++row)
+            {
+                stl_algorithms::copy(x.begin(row), x.begin(row) + numCols, fullOutput.begin(row));
+            }
+
+            fft2InPlace(fullOutput.data(), shape.rows, shape.cols, false, realN);
+
+            auto result = NdArray<std::complex<double>>(shape.rows, realN);
+            for (uint32 row = 0; row < shape.rows; ++row)
+            {
+                stl_algorithms::copy(fullOutput.begin(row), fullOutput.begin(row) + realN, result.begin(row));
+            }
 
             return result;
         }
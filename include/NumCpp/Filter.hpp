@@ -28,6 +28,7 @@
 #pragma once
 
 #include "NumCpp/Filter/Boundaries/Boundary.hpp"
+#include "NumCpp/Filter/Filters/ConvolutionMethod.hpp"
 #include "NumCpp/Filter/Filters/Filters1d/complementaryMeanFilter1d.hpp"
 #include "NumCpp/Filter/Filters/Filters1d/complementaryMedianFilter1d.hpp"
 #include "NumCpp/Filter/Filters/Filters1d/convolve1d.hpp"
@@ -0,0 +1,120 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Running sum box filters shared by the mean and uniform filters
+///
+#pragma once
+
+#include <algorithm>
+
+#include "NumCpp/Core/Shape.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::filter::detail
+{
+    //============================================================================
+    // Method Description:
+    /// Sums every inSize wide window along the rows of an array with a running sum,
+    /// so the cost does not depend on the window size. The sum is restarted on every
+    /// row to bound the accumulated rounding error.
+    ///
+    /// @param inArray
+    /// @param inSize: the window size
+    /// @return NdArray of shape (rows, cols - inSize + 1)
+    ///
+    template<typename dtype>
+    NdArray<double> boxSumRows(const NdArray<dtype>& inArray, uint32 inSize)
+    {
+        const auto& inShape = inArray.shape();
+        const auto  outCols = inShape.cols - inSize + 1;
+
+        NdArray<double> output(inShape.rows, outCols);
+        for (uint32 row = 0; row < inShape.rows; ++row)
+        {
+            const auto* inRow  = inArray.data() + static_cast<std::size_t>(row) * inShape.cols;
+            auto*       outRow = output.data() + static_cast<std::size_t>(row) * outCols;
+
+            double sum = 0.;
+            for (uint32 col = 0; col < inSize; ++col)
+            {
+                sum += static_cast<double>(inRow[col]);
+            }
+
+            outRow[0] = sum;
+            for (uint32 col = 1; col < outCols; ++col)
+            {
+                sum += static_cast<double>(inRow[col + inSize - 1]) - static_cast<double>(inRow[col - 1]);
+                outRow[col] = sum;
+            }
+        }
+
+        return output;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Sums every inSize tall window along the columns of an array with a running sum
+    /// over whole rows, so the cost does not depend on the window size and the array
+    /// is only traversed along its rows.
+    ///
+    /// @param inArray
+    /// @param inSize: the window size
+    /// @return NdArray of shape (rows - inSize + 1, cols)
+    ///
+    template<typename dtype>
+    NdArray<double> boxSumColumns(const NdArray<dtype>& inArray, uint32 inSize)
+    {
+        const auto& inShape = inArray.shape();
+        const auto  outRows = inShape.rows - inSize + 1;
+        const auto  numCols = inShape.cols;
+
+        NdArray<double> output(outRows, numCols);
+        auto*           sums = output.data();
+        std::fill(sums, sums + numCols, 0.);
+        for (uint32 row = 0; row < inSize; ++row)
+        {
+            const auto* inRow = inArray.data() + static_cast<std::size_t>(row) * numCols;
+            for (uint32 col = 0; col < numCols; ++col)
+            {
+                sums[col] += static_cast<double>(inRow[col]);
+            }
+        }
+
+        for (uint32 row = 1; row < outRows; ++row)
+        {
+            const auto* previousSums = output.data() + static_cast<std::size_t>(row - 1) * numCols;
+            const auto* leaving      = inArray.data() + static_cast<std::size_t>(row - 1) * numCols;
+            const auto* entering     = inArray.data() + static_cast<std::size_t>(row + inSize - 1) * numCols;
+            auto*       rowSums      = output.data() + static_cast<std::size_t>(row) * numCols;
+            for (uint32 col = 0; col < numCols; ++col)
+            {
+                rowSums[col] = previousSums[col] + (static_cast<double>(entering[col]) - static_cast<double>(leaving[col]));
+            }
+        }
+
+        return output;
+    }
+} // namespace nc::filter::detail
@@ -0,0 +1,323 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Direct and FFT kernel convolution engines shared by the convolution filters
+///
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <type_traits>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Shape.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/FFT/FftEngine.hpp"
+#include "NumCpp/FFT/Plan.hpp"
+#include "NumCpp/Filter/Filters/ConvolutionMethod.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::filter::detail
+{
+    //============================================================================
+    // Method Description:
+    /// Chooses the FFT tile length along one axis for overlap-save convolution. The
+    /// power of two that minimizes the transform work per valid output is chosen, up
+    /// to the length needed to cover the whole axis in a single tile.
+    ///
+    /// @param inKernelSize: the kernel length along the axis
+    /// @param inPaddedSize: the length of the boundary padded input along the axis
+    /// @return uint32
+    ///
+    inline uint32 fftConvolutionTileSize(uint32 inKernelSize, uint32 inPaddedSize)
+    {
+        uint32 maxTileSize = 1;
+        while (maxTileSize < inPaddedSize)
+        {
+            maxTileSize <<= 1;
+        }
+
+        uint32 tileSize = 1;
+        while (tileSize < inKernelSize)
+        {
+            tileSize <<= 1;
+        }
+
+        auto bestTileSize = tileSize;
+        auto bestCost     = std::numeric_limits<double>::max();
+        for (; tileSize <= maxTileSize; tileSize <<= 1)
+        {
+            const auto numOutputs = static_cast<double>(tileSize - inKernelSize + 1);
+            const auto cost =
+                static_cast<double>(tileSize) * std::max(std::log2(static_cast<double>(tileSize)), 1.) / numOutputs;
+            if (cost < bestCost)
+            {
+                bestCost     = cost;
+                bestTileSize = tileSize;
+            }
+        }
+
+        return bestTileSize;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Whether the FFT convolution is estimated to be faster than the direct sum
+    ///
+    /// @param inOutputShape: shape of the output
+    /// @param inKernelShape: shape of the kernel
+    /// @return bool
+    ///
+    inline bool useFftConvolution(const Shape& inOutputShape, const Shape& inKernelShape)
+    {
+        // cost of the transforms per n log2(n) relative to one direct multiply-add, measured
+        // so that the crossover falls at about 15x15 kernels in 2D and 100 taps in 1D
+        constexpr double FFT_OPERATION_COST = 10.;
+
+        const auto paddedRows = inOutputShape.rows + inKernelShape.rows - 1;
+        const auto paddedCols = inOutputShape.cols + inKernelShape.cols - 1;
+        const auto tileRows   = fftConvolutionTileSize(inKernelShape.rows, paddedRows);
+        const auto tileCols   = fftConvolutionTileSize(inKernelShape.cols, paddedCols);
+        const auto tileSize   = static_cast<double>(tileRows) * static_cast<double>(tileCols);
+        const auto tileOutput = static_cast<double>(tileRows - inKernelShape.rows + 1) *
+                                static_cast<double>(tileCols - inKernelShape.cols + 1);
+
+        // a forward and an inverse real transform per tile
+        const auto fftCost    = FFT_OPERATION_COST * tileSize * std::max(std::log2(tileSize), 1.) / tileOutput;
+        const auto directCost = static_cast<double>(inKernelShape.size());
+
+        return fftCost < directCost;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Direct "valid" convolution, out(r, c) = sum(in(r + i, c + j) * kernel(kr - 1 - i, kc - 1 - j)).
+    /// The weighted rows are accumulated along whole output rows so the inner loop is
+    /// contiguous and does not allocate. Integer outputs wrap around on overflow.
+    ///
+    /// @param inPadded: the boundary padded input
+    /// @param inKernel: the convolution kernel
+    /// @param outArray: the output, of shape inPadded.shape() - inKernel.shape() + 1
+    ///
+    template<typename dtype>
+    void directConvolveValid(const NdArray<dtype>& inPadded, const NdArray<dtype>& inKernel, NdArray<dtype>& outArray)
+    {
+        // small unsigned types are promoted to int, so multiply them as unsigned to wrap without overflowing
+        using ProductType = std::conditional_t<std::is_unsigned_v<dtype>, std::common_type_t<dtype, unsigned>, dtype>;
+
+        const auto& kernelShape = inKernel.shape();
+        const auto  paddedCols  = inPadded.numCols();
+        const auto  outCols     = outArray.numCols();
+
+        for (uint32 row = 0; row < outArray.numRows(); ++row)
+        {
+            auto* outRow = outArray.data() + static_cast<std::size_t>(row) * outCols;
+            std::fill(outRow, outRow + outCols, dtype{ 0 });
+
+            for (uint32 kernelRow = 0; kernelRow < kernelShape.rows; ++kernelRow)
+            {
+                const auto* inRow      = inPadded.data() + static_cast<std::size_t>(row + kernelRow) * paddedCols;
+                const auto* weightsRow = inKernel.data() +
+                                         static_cast<std::size_t>(kernelShape.rows - 1 - kernelRow) * kernelShape.cols;
+
+                for (uint32 kernelCol = 0; kernelCol < kernelShape.cols; ++kernelCol)
+                {
+                    const auto  weight = static_cast<ProductType>(weightsRow[kernelShape.cols - 1 - kernelCol]);
+                    const auto* inData = inRow + kernelCol;
+                    for (uint32 col = 0; col < outCols; ++col)
+                    {
+                        outRow[col] = static_cast<dtype>(outRow[col] + static_cast<ProductType>(inData[col]) * weight);
+                    }
+                }
+            }
+        }
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Overlap-save "valid" convolution. The output is computed in tiles, each tile is
+    /// the circular convolution of an FFT sized block of the input with the kernel, of
+    /// which the entries unaffected by wrap around are kept. The kernel spectrum and
+    /// transform plans are computed once and reused for every tile. Integer outputs
+    /// are rounded to the nearest value and saturate at the limits of the type.
+    ///
+    /// @param inPadded: the boundary padded input
+    /// @param inKernel: the convolution kernel
+    /// @param outArray: the output, of shape inPadded.shape() - inKernel.shape() + 1
+    ///
+    template<typename dtype>
+    void fftConvolveValid(const NdArray<dtype>& inPadded, const NdArray<dtype>& inKernel, NdArray<dtype>& outArray)
+    {
+        const auto& paddedShape = inPadded.shape();
+        const auto& kernelShape = inKernel.shape();
+        const auto& outShape    = outArray.shape();
+
+        const auto tileShape = Shape(fftConvolutionTileSize(kernelShape.rows, paddedShape.rows),
+                                     fftConvolutionTileSize(kernelShape.cols, paddedShape.cols));
+        const auto validRows = tileShape.rows - kernelShape.rows + 1;
+        const auto validCols = tileShape.cols - kernelShape.cols + 1;
+
+        const auto forwardPlan = fft::Plan(tileShape, fft::Transform::RFFT);
+        const auto inversePlan = fft::Plan(tileShape, fft::Transform::IRFFT);
+
+        auto block = NdArray<double>(tileShape);
+        block.zeros();
+        for (uint32 row = 0; row < kernelShape.rows; ++row)
+        {
+            std::transform(inKernel.data() + static_cast<std::size_t>(row) * kernelShape.cols,
+                           inKernel.data() + static_cast<std::size_t>(row + 1) * kernelShape.cols,
+                           block.begin(row),
+                           [](dtype value) { return static_cast<double>(value); });
+        }
+
+        NdArray<std::complex<double>> kernelSpectrum;
+        forwardPlan.execute(block, kernelSpectrum);
+
+        NdArray<std::complex<double>> blockSpectrum;
+        NdArray<double>               blockResult;
+        for (uint32 tileRow = 0; tileRow < outShape.rows; tileRow += validRows)
+        {
+            for (uint32 tileCol = 0; tileCol < outShape.cols; tileCol += validCols)
+            {
+                // the input block starting at (tileRow, tileCol), zero filled past the edges
+                const auto blockRows = std::min(tileShape.rows, paddedShape.rows - tileRow);
+                const auto blockCols = std::min(tileShape.cols, paddedShape.cols - tileCol);
+                block.zeros();
+                for (uint32 row = 0; row < blockRows; ++row)
+                {
+                    const auto* inRow =
+                        inPadded.data() + static_cast<std::size_t>(tileRow + row) * paddedShape.cols + tileCol;
+                    std::transform(inRow,
+                                   inRow + blockCols,
+                                   block.begin(row),
+                                   [](dtype value) { return static_cast<double>(value); });
+                }
+
+                forwardPlan.execute(block, blockSpectrum);
+                std::transform(blockSpectrum.begin(),
+                               blockSpectrum.end(),
+                               kernelSpectrum.begin(),
+                               blockSpectrum.begin(),
+                               fft::detail::multiply);
+                inversePlan.execute(blockSpectrum, blockResult);
+
+                const auto numRows = std::min(validRows, outShape.rows - tileRow);
+                const auto numCols = std::min(validCols, outShape.cols - tileCol);
+                for (uint32 row = 0; row < numRows; ++row)
+                {
+                    const auto* resultRow = blockResult.data() +
+                                            static_cast<std::size_t>(row + kernelShape.rows - 1) * tileShape.cols +
+                                            kernelShape.cols - 1;
+                    auto* outRow = outArray.data() + static_cast<std::size_t>(tileRow + row) * outShape.cols + tileCol;
+                    std::transform(resultRow,
+                                   resultRow + numCols,
+                                   outRow,
+                                   [](double value)
+                                   {
+                                       if constexpr (std::is_integral_v<dtype>)
+                                       {
+                                           // converting an out of range value is undefined, so saturate instead
+                                           constexpr auto lowest = std::numeric_limits<dtype>::lowest();
+                                           constexpr auto max    = std::numeric_limits<dtype>::max();
+
+                                           value = std::round(value);
+                                           if (value <= static_cast<double>(lowest))
+                                           {
+                                               return lowest;
+                                           }
+                                           if (value >= static_cast<double>(max))
+                                           {
+                                               return max;
+                                           }
+                                           return static_cast<dtype>(value);
+                                       }
+                                       else
+                                       {
+                                           return static_cast<dtype>(value);
+                                       }
+                                   });
+                }
+            }
+        }
+    }
+
+    //============================================================================
+    // Method Description:
+    /// "valid" convolution of a boundary padded input with a kernel. AUTO always uses the
+    /// direct sum for integer types so that overflow wraps the same way for every kernel size.
+    ///
+    /// @param inPadded: the boundary padded input
+    /// @param inKernel: the convolution kernel
+    /// @param outShape: shape of the output, inPadded.shape() - inKernel.shape() + 1
+    /// @param inMethod: the convolution method
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<dtype> convolveValid(const NdArray<dtype>& inPadded,
+                                 const NdArray<dtype>& inKernel,
+                                 const Shape&          outShape,
+                                 ConvolutionMethod     inMethod)
+    {
+        NdArray<dtype> output(outShape);
+        if (output.size() == 0 || inKernel.size() == 0)
+        {
+            return output.zeros();
+        }
+
+        switch (inMethod)
+        {
+            case ConvolutionMethod::AUTO:
+            {
+                if (!std::is_integral_v<dtype> && useFftConvolution(outShape, inKernel.shape()))
+                {
+                    fftConvolveValid(inPadded, inKernel, output);
+                }
+                else
+                {
+                    directConvolveValid(inPadded, inKernel, output);
+                }
+                break;
+            }
+            case ConvolutionMethod::DIRECT:
+            {
+                directConvolveValid(inPadded, inKernel, output);
+                break;
+            }
+            case ConvolutionMethod::FFT:
+            {
+                fftConvolveValid(inPadded, inKernel, output);
+                break;
+            }
+            default:
+            {
+                THROW_INVALID_ARGUMENT_ERROR("Unimplemented convolution method.");
+            }
+        }
+
+        return output;
+    }
+} // namespace nc::filter::detail
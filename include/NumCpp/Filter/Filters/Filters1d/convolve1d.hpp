@@ -27,12 +27,12 @@
 ///
 #pragma once
 
-#include "NumCpp/Core/Slice.hpp"
+#include "NumCpp/Core/Shape.hpp"
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Filter/Boundaries/Boundaries1d/addBoundary1d.hpp"
 #include "NumCpp/Filter/Boundaries/Boundary.hpp"
-#include "NumCpp/Functions/dot.hpp"
-#include "NumCpp/Functions/fliplr.hpp"
+#include "NumCpp/Filter/Filters/ConvolutionEngine.hpp"
+#include "NumCpp/Filter/Filters/ConvolutionMethod.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::filter
@@ -48,30 +48,22 @@ namespace nc::filter
     /// @param inWeights
     /// @param inBoundaryType: boundary mode (default Reflect) options (reflect, constant, nearest, mirror, wrap)
     /// @param inConstantValue: contant value if boundary = 'constant' (default 0)
+    /// @param inMethod: convolution method (default AUTO) options (auto, direct, fft)
     /// @return NdArray
     ///
     template<typename dtype>
     NdArray<dtype> convolve1d(const NdArray<dtype>& inImageArray,
                               const NdArray<dtype>& inWeights,
                               Boundary              inBoundaryType  = Boundary::REFLECT,
-                              dtype                 inConstantValue = 0)
+                              dtype                 inConstantValue = 0,
+                              ConvolutionMethod     inMethod        = ConvolutionMethod::AUTO)
     {
-        const uint32   boundarySize = inWeights.size() / 2; // integer division
-        NdArray<dtype> arrayWithBoundary =
+        const NdArray<dtype> arrayWithBoundary =
             boundary::addBoundary1d(inImageArray, inBoundaryType, inWeights.size(), inConstantValue);
-        NdArray<dtype> output(1, inImageArray.size());
 
-        NdArray<dtype> weightsFlat = fliplr(inWeights.flatten());
+        auto kernel = inWeights;
+        kernel.reshape(Shape(1, kernel.size()));
 
-        const uint32 endPointRow = boundarySize + inImageArray.size();
-
-        for (uint32 i = boundarySize; i < endPointRow; ++i)
-        {
-            NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)].flatten();
-
-            output[i - boundarySize] = dot(window, weightsFlat).item();
-        }
-
-        return output;
+        return detail::convolveValid(arrayWithBoundary, kernel, Shape(1, inImageArray.size()), inMethod);
     }
 } // namespace nc::filter
@@ -27,6 +27,7 @@
 ///
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 
@@ -39,6 +40,48 @@
 
 namespace nc::filter
 {
+    namespace detail
+    {
+        //============================================================================
+        // Method Description:
+        /// Normalized one-dimensional gaussian kernel spanning 4 standard deviations
+        /// either side of the center
+        ///
+        /// @param inSigma: Standard deviation for Gaussian kernel
+        /// @return NdArray
+        ///
+        inline NdArray<double> gaussianKernel1d(double inSigma)
+        {
+            if (inSigma <= 0)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input sigma value must be greater than zero.");
+            }
+
+            // calculate the kernel size based off of the input sigma value
+            constexpr uint32 MIN_KERNEL_SIZE = 5;
+            uint32           kernelSize =
+                std::max(static_cast<uint32>(std::ceil(inSigma * 2. * 4.)), MIN_KERNEL_SIZE); // 4 standard deviations
+            if (kernelSize % 2 == 0)
+            {
+                ++kernelSize; // make sure the kernel is an odd size
+            }
+
+            const auto kernalHalfSize = static_cast<double>(kernelSize / 2); // integer division
+
+            // calculate the gaussian kernel
+            NdArray<double> kernel(1, kernelSize);
+            for (double i = 0; i < kernelSize; ++i)
+            {
+                kernel[static_cast<uint32>(i)] = utils::gaussian1d(i - kernalHalfSize, 0., inSigma);
+            }
+
+            // normalize the kernel
+            kernel /= kernel.sum().item();
+
+            return kernel;
+        }
+    } // namespace detail
+
     //============================================================================
     // Method Description:
     /// Calculate a one-dimensional gaussian filter.
@@ -58,31 +101,7 @@ namespace nc::filter
                                     Boundary              inBoundaryType  = Boundary::REFLECT,
                                     dtype                 inConstantValue = 0)
     {
-        if (inSigma <= 0)
-        {
-            THROW_INVALID_ARGUMENT_ERROR("input sigma value must be greater than zero.");
-        }
-
-        // calculate the kernel size based off of the input sigma value
-        constexpr uint32 MIN_KERNEL_SIZE = 5;
-        uint32           kernelSize =
-            std::max(static_cast<uint32>(std::ceil(inSigma * 2. * 4.)), MIN_KERNEL_SIZE); // 4 standard deviations
-        if (kernelSize % 2 == 0)
-        {
-            ++kernelSize; // make sure the kernel is an odd size
-        }
-
-        const auto kernalHalfSize = static_cast<double>(kernelSize / 2); // integer division
-
-        // calculate the gaussian kernel
-        NdArray<double> kernel(1, kernelSize);
-        for (double i = 0; i < kernelSize; ++i)
-        {
-            kernel[static_cast<uint32>(i)] = utils::gaussian1d(i - kernalHalfSize, 0., inSigma);
-        }
-
-        // normalize the kernel
-        kernel /= kernel.sum().item();
+        const auto kernel = detail::gaussianKernel1d(inSigma);
 
         // perform the convolution
         NdArray<dtype> output =
@@ -27,10 +27,12 @@
 ///
 #pragma once
 
-#include "NumCpp/Core/Slice.hpp"
+#include <algorithm>
+
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Filter/Boundaries/Boundaries1d/addBoundary1d.hpp"
 #include "NumCpp/Filter/Boundaries/Boundary.hpp"
+#include "NumCpp/Filter/Filters/VanHerkGilWerman.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::filter
@@ -54,20 +56,11 @@ namespace nc::filter
                                    Boundary              inBoundaryType  = Boundary::REFLECT,
                                    dtype                 inConstantValue = 0)
     {
-        NdArray<dtype> arrayWithBoundary =
-            boundary::addBoundary1d(inImageArray, inBoundaryType, inSize, inConstantValue);
-        NdArray<dtype> output(1, inImageArray.size());
-
-        const uint32 boundarySize = inSize / 2; // integer division
-        const uint32 endPoint     = boundarySize + inImageArray.size();
+        const auto maxOf = [](dtype lhs, dtype rhs) noexcept { return std::max(lhs, rhs); };
 
-        for (uint32 i = boundarySize; i < endPoint; ++i)
-        {
-            NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)];
-
-            output[i - boundarySize] = window.max().item();
-        }
+        const NdArray<dtype> arrayWithBoundary =
+            boundary::addBoundary1d(inImageArray, inBoundaryType, inSize, inConstantValue);
 
-        return output;
+        return detail::runningExtremumRows(arrayWithBoundary, inSize, maxOf);
     }
 } // namespace nc::filter
@@ -27,11 +27,12 @@
 ///
 #pragma once
 
-#include "NumCpp/Core/Slice.hpp"
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Filter/Boundaries/Boundaries1d/addBoundary1d.hpp"
 #include "NumCpp/Filter/Boundaries/Boundary.hpp"
-#include "NumCpp/Functions/percentile.hpp"
+#include "NumCpp/Filter/Filters/RankWindow.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::filter
@@ -57,20 +58,20 @@ namespace nc::filter
                                       Boundary              inBoundaryType  = Boundary::REFLECT,
                                       dtype                 inConstantValue = 0)
     {
-        NdArray<dtype> arrayWithBoundary =
-            boundary::addBoundary1d(inImageArray, inBoundaryType, inSize, inConstantValue);
-        NdArray<dtype> output(1, inImageArray.size());
+        if (inPercentile < 0. || inPercentile > 100.)
+        {
+            THROW_INVALID_ARGUMENT_ERROR("input percentile value must be of the range [0, 100].");
+        }
 
-        const uint32 boundarySize = inSize / 2; // integer division
-        const uint32 endPoint     = boundarySize + inImageArray.size();
+        const NdArray<dtype> arrayWithBoundary =
+            boundary::addBoundary1d(inImageArray, inBoundaryType, inSize, inConstantValue);
 
-        for (uint32 i = boundarySize; i < endPoint; ++i)
+        const auto percentileOfWindow = [inSize, inPercentile](auto& window)
         {
-            NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)];
-
-            output[i - boundarySize] = percentile(window, inPercentile).item();
-        }
+            return static_cast<dtype>(
+                detail::windowPercentile(window, inSize, inPercentile, InterpolationMethod::LINEAR));
+        };
 
-        return output;
+        return detail::rankFilterValid1d(arrayWithBoundary, inSize, inImageArray.size(), percentileOfWindow);
     }
 } // namespace nc::filter
@@ -27,11 +27,10 @@
 ///
 #pragma once
 
-#include "NumCpp/Core/Slice.hpp"
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Filter/Boundaries/Boundaries1d/addBoundary1d.hpp"
 #include "NumCpp/Filter/Boundaries/Boundary.hpp"
-#include "NumCpp/Functions/sort.hpp"
+#include "NumCpp/Filter/Filters/RankWindow.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::filter
@@ -62,20 +61,11 @@ namespace nc::filter
             THROW_INVALID_ARGUMENT_ERROR("rank not within filter footprint size.");
         }
 
-        NdArray<dtype> arrayWithBoundary =
+        const NdArray<dtype> arrayWithBoundary =
             boundary::addBoundary1d(inImageArray, inBoundaryType, inSize, inConstantValue);
-        NdArray<dtype> output(1, inImageArray.size());
 
-        const uint32 boundarySize = inSize / 2; // integer division
-        const uint32 endPoint     = boundarySize + inImageArray.size();
+        const auto rankOfWindow = [inRank](auto& window) { return window.select(inRank); };
 
-        for (uint32 i = boundarySize; i < endPoint; ++i)
-        {
-            NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)];
-
-            output[i - boundarySize] = sort(window)[inRank];
-        }
-
-        return output;
+        return detail::rankFilterValid1d(arrayWithBoundary, inSize, inImageArray.size(), rankOfWindow);
     }
 } // namespace nc::filter
@@ -27,11 +27,9 @@
 ///
 #pragma once
 
-#include "NumCpp/Core/Slice.hpp"
 #include "NumCpp/Core/Types.hpp"
-#include "NumCpp/Filter/Boundaries/Boundaries1d/addBoundary1d.hpp"
 #include "NumCpp/Filter/Boundaries/Boundary.hpp"
-#include "NumCpp/Functions/mean.hpp"
+#include "NumCpp/Filter/Filters/Filters1d/meanFilter1d.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::filter
@@ -55,20 +53,6 @@ namespace nc::filter
                                    Boundary              inBoundaryType  = Boundary::REFLECT,
                                    dtype                 inConstantValue = 0)
     {
-        NdArray<dtype> arrayWithBoundary =
-            boundary::addBoundary1d(inImageArray, inBoundaryType, inSize, inConstantValue);
-        NdArray<dtype> output(1, inImageArray.size());
-
-        const uint32 boundarySize = inSize / 2; // integer division
-        const uint32 endPoint     = boundarySize + inImageArray.size();
-
-        for (uint32 i = boundarySize; i < endPoint; ++i)
-        {
-            NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)];
-
-            output[i - boundarySize] = mean(window).item();
-        }
-
-        return output;
+        return meanFilter1d(inImageArray, inSize, inBoundaryType, inConstantValue).template astype<dtype>();
     }
 } // namespace nc::filter
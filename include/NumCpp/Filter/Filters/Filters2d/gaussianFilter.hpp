@@ -27,15 +27,14 @@
 ///
 #pragma once
 
-#include <cmath>
-#include <string>
-#include <utility>
-
-#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Shape.hpp"
 #include "NumCpp/Core/Types.hpp"
-#include "NumCpp/Filter/Filters/Filters2d/convolve.hpp"
+#include "NumCpp/Filter/Boundaries/Boundaries2d/addBoundary2d.hpp"
+#include "NumCpp/Filter/Boundaries/Boundary.hpp"
+#include "NumCpp/Filter/Filters/ConvolutionEngine.hpp"
+#include "NumCpp/Filter/Filters/ConvolutionMethod.hpp"
+#include "NumCpp/Filter/Filters/Filters1d/gaussianFilter1d.hpp"
 #include "NumCpp/NdArray.hpp"
-#include "NumCpp/Utils/gaussian.hpp"
 
 namespace nc::filter
 {
@@ -58,39 +57,24 @@ namespace nc::filter
                                   Boundary              inBoundaryType  = Boundary::REFLECT,
                                   dtype                 inConstantValue = 0)
     {
-        if (inSigma <= 0)
-        {
-            THROW_INVALID_ARGUMENT_ERROR("input sigma value must be greater than zero.");
-        }
-
-        // calculate the kernel size based off of the input sigma value
-        constexpr uint32 MIN_KERNEL_SIZE = 5;
-        uint32           kernelSize =
-            std::max(static_cast<uint32>(std::ceil(inSigma * 2. * 4.)), MIN_KERNEL_SIZE); // 4 standard deviations
-        if (kernelSize % 2 == 0)
-        {
-            ++kernelSize; // make sure the kernel is an odd size
-        }
-
-        const auto kernalHalfSize = static_cast<double>(kernelSize / 2); // integer division
-
-        // calculate the gaussian kernel
-        NdArray<double> kernel(kernelSize);
-        for (double row = 0; row < kernelSize; ++row)
-        {
-            for (double col = 0; col < kernelSize; ++col)
-            {
-                kernel(static_cast<uint32>(row), static_cast<uint32>(col)) =
-                    utils::gaussian(row - kernalHalfSize, col - kernalHalfSize, inSigma);
-            }
-        }
+        // the gaussian is separable, so the 2D kernel is applied as a column pass and then
+        // a row pass of the 1D kernel over the same boundary padded image
+        const auto rowKernel    = detail::gaussianKernel1d(inSigma);
+        const auto kernelSize   = rowKernel.size();
+        auto       columnKernel = rowKernel;
+        columnKernel.reshape(Shape(kernelSize, 1));
 
-        // normalize the kernel
-        kernel /= kernel.sum().item();
+        const auto arrayWithBoundary = boundary::addBoundary2d(inImageArray.template astype<double>(),
+                                                               inBoundaryType,
+                                                               kernelSize,
+                                                               static_cast<double>(inConstantValue));
+        const auto columnsFiltered   = detail::convolveValid(arrayWithBoundary,
+                                                           columnKernel,
+                                                           Shape(inImageArray.numRows(), arrayWithBoundary.numCols()),
+                                                           ConvolutionMethod::AUTO);
 
-        // perform the convolution
         NdArray<dtype> output =
-            convolve(inImageArray.template astype<double>(), kernelSize, kernel, inBoundaryType, inConstantValue)
+            detail::convolveValid(columnsFiltered, rowKernel, inImageArray.shape(), ConvolutionMethod::AUTO)
                 .template astype<dtype>();
 
         return output;
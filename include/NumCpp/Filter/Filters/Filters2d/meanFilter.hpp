@@ -27,11 +27,10 @@
 ///
 #pragma once
 
-#include "NumCpp/Core/Shape.hpp"
-#include "NumCpp/Core/Slice.hpp"
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Filter/Boundaries/Boundaries2d/addBoundary2d.hpp"
-#include "NumCpp/Functions/mean.hpp"
+#include "NumCpp/Filter/Boundaries/Boundary.hpp"
+#include "NumCpp/Filter/Filters/BoxSum.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::filter
@@ -52,25 +51,12 @@ namespace nc::filter
                                Boundary              inBoundaryType  = Boundary::REFLECT,
                                dtype                 inConstantValue = 0)
     {
-        NdArray<dtype> arrayWithBoundary =
+        const NdArray<dtype> arrayWithBoundary =
             boundary::addBoundary2d(inImageArray, inBoundaryType, inSize, inConstantValue);
-        NdArray<double> output(inImageArray.shape());
 
-        const Shape  inShape      = inImageArray.shape();
-        const uint32 boundarySize = inSize / 2; // integer division
-        const uint32 endPointRow  = boundarySize + inShape.rows;
-        const uint32 endPointCol  = boundarySize + inShape.cols;
-
-        for (uint32 row = boundarySize; row < endPointRow; ++row)
-        {
-            for (uint32 col = boundarySize; col < endPointCol; ++col)
-            {
-                NdArray<dtype> window = arrayWithBoundary(Slice(row - boundarySize, row + boundarySize + 1),
-                                                          Slice(col - boundarySize, col + boundarySize + 1));
-
-                output(row - boundarySize, col - boundarySize) = mean(window).item();
-            }
-        }
+        // the box is separable: sum the columns of the padded array, then the rows of those sums
+        auto output = detail::boxSumRows(detail::boxSumColumns(arrayWithBoundary, inSize), inSize);
+        output /= static_cast<double>(inSize) * static_cast<double>(inSize);
 
         return output;
     }
@@ -27,11 +27,11 @@
 ///
 #pragma once
 
-#include "NumCpp/Core/Shape.hpp"
-#include "NumCpp/Core/Slice.hpp"
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Filter/Boundaries/Boundaries2d/addBoundary2d.hpp"
+#include "NumCpp/Filter/Filters/RankWindow.hpp"
 #include "NumCpp/NdArray.hpp"
+#include "NumCpp/Utils/sqr.hpp"
 
 namespace nc::filter
 {
@@ -54,26 +54,13 @@ namespace nc::filter
                                 Boundary              inBoundaryType  = Boundary::REFLECT,
                                 dtype                 inConstantValue = 0)
     {
-        NdArray<dtype> arrayWithBoundary =
+        const NdArray<dtype> arrayWithBoundary =
             boundary::addBoundary2d(inImageArray, inBoundaryType, inSize, inConstantValue);
-        NdArray<dtype> output(inImageArray.shape());
+        const uint32 windowSize = utils::sqr(inSize);
 
-        const Shape  inShape      = inImageArray.shape();
-        const uint32 boundarySize = inSize / 2; // integer division
-        const uint32 endPointRow  = boundarySize + inShape.rows;
-        const uint32 endPointCol  = boundarySize + inShape.cols;
+        const auto medianOfWindow = [windowSize](auto& window)
+        { return detail::windowMedian<dtype>(window, windowSize); };
 
-        for (uint32 row = boundarySize; row < endPointRow; ++row)
-        {
-            for (uint32 col = boundarySize; col < endPointCol; ++col)
-            {
-                NdArray<dtype> window = arrayWithBoundary(Slice(row - boundarySize, row + boundarySize + 1),
-                                                          Slice(col - boundarySize, col + boundarySize + 1));
-
-                output(row - boundarySize, col - boundarySize) = window.median().item();
-            }
-        }
-
-        return output;
+        return detail::rankFilterValid2d(arrayWithBoundary, inSize, inImageArray.shape(), medianOfWindow);
     }
 } // namespace nc::filter
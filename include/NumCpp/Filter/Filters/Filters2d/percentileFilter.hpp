@@ -27,12 +27,13 @@
 ///
 #pragma once
 
-#include "NumCpp/Core/Shape.hpp"
-#include "NumCpp/Core/Slice.hpp"
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Filter/Boundaries/Boundaries2d/addBoundary2d.hpp"
-#include "NumCpp/Functions/percentile.hpp"
+#include "NumCpp/Filter/Filters/RankWindow.hpp"
 #include "NumCpp/NdArray.hpp"
+#include "NumCpp/Utils/sqr.hpp"
 
 namespace nc::filter
 {
@@ -57,27 +58,21 @@ namespace nc::filter
                                     Boundary              inBoundaryType  = Boundary::REFLECT,
                                     dtype                 inConstantValue = 0)
     {
-        NdArray<dtype> arrayWithBoundary =
-            boundary::addBoundary2d(inImageArray, inBoundaryType, inSize, inConstantValue);
-        NdArray<dtype> output(inImageArray.shape());
+        if (inPercentile < 0. || inPercentile > 100.)
+        {
+            THROW_INVALID_ARGUMENT_ERROR("input percentile value must be of the range [0, 100].");
+        }
 
-        const Shape  inShape      = inImageArray.shape();
-        const uint32 boundarySize = inSize / 2; // integer division
-        const uint32 endPointRow  = boundarySize + inShape.rows;
-        const uint32 endPointCol  = boundarySize + inShape.cols;
+        const NdArray<dtype> arrayWithBoundary =
+            boundary::addBoundary2d(inImageArray, inBoundaryType, inSize, inConstantValue);
+        const uint32 windowSize = utils::sqr(inSize);
 
-        for (uint32 row = boundarySize; row < endPointRow; ++row)
+        const auto percentileOfWindow = [windowSize, inPercentile](auto& window)
         {
-            for (uint32 col = boundarySize; col < endPointCol; ++col)
-            {
-                NdArray<dtype> window = arrayWithBoundary(Slice(row - boundarySize, row + boundarySize + 1),
-                                                          Slice(col - boundarySize, col + boundarySize + 1));
-
-                output(row - boundarySize, col - boundarySize) =
-                    percentile(window, inPercentile, Axis::NONE, InterpolationMethod::NEAREST).item();
-            }
-        }
+            return static_cast<dtype>(
+                detail::windowPercentile(window, windowSize, inPercentile, InterpolationMethod::NEAREST));
+        };
 
-        return output;
+        return detail::rankFilterValid2d(arrayWithBoundary, inSize, inImageArray.shape(), percentileOfWindow);
     }
 } // namespace nc::filter
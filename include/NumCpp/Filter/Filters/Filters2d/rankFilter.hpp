@@ -30,12 +30,11 @@
 #include <string>
 
 #include "NumCpp/Core/Internal/Error.hpp"
-#include "NumCpp/Core/Shape.hpp"
-#include "NumCpp/Core/Slice.hpp"
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Filter/Boundaries/Boundaries2d/addBoundary2d.hpp"
-#include "NumCpp/Functions/sort.hpp"
+#include "NumCpp/Filter/Filters/RankWindow.hpp"
 #include "NumCpp/NdArray.hpp"
+#include "NumCpp/Utils/sqr.hpp"
 
 namespace nc::filter
 {
@@ -65,26 +64,11 @@ namespace nc::filter
             THROW_INVALID_ARGUMENT_ERROR("rank not within filter footprint size.");
         }
 
-        NdArray<dtype> arrayWithBoundary =
+        const NdArray<dtype> arrayWithBoundary =
             boundary::addBoundary2d(inImageArray, inBoundaryType, inSize, inConstantValue);
-        NdArray<dtype> output(inImageArray.shape());
 
-        const Shape  inShape      = inImageArray.shape();
-        const uint32 boundarySize = inSize / 2; // integer division
-        const uint32 endPointRow  = boundarySize + inShape.rows;
-        const uint32 endPointCol  = boundarySize + inShape.cols;
+        const auto rankOfWindow = [inRank](auto& window) { return window.select(inRank); };
 
-        for (uint32 row = boundarySize; row < endPointRow; ++row)
-        {
-            for (uint32 col = boundarySize; col < endPointCol; ++col)
-            {
-                NdArray<dtype> window = arrayWithBoundary(Slice(row - boundarySize, row + boundarySize + 1),
-                                                          Slice(col - boundarySize, col + boundarySize + 1));
-
-                output(row - boundarySize, col - boundarySize) = sort(window)[inRank];
-            }
-        }
-
-        return output;
+        return detail::rankFilterValid2d(arrayWithBoundary, inSize, inImageArray.shape(), rankOfWindow);
     }
 } // namespace nc::filter
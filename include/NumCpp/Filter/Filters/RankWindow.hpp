@@ -0,0 +1,849 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Sliding window order statistic engines shared by the median, rank and percentile filters
+///
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Shape.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/NdArray.hpp"
+#include "NumCpp/Utils/essentiallyEqual.hpp"
+
+namespace nc::filter::detail
+{
+    //============================================================================
+    // Method Description:
+    /// Returns the histogram bin of an 8 or 16 bit integer, the offset from the
+    /// smallest value of the type
+    ///
+    /// @param inValue
+    /// @return bin
+    ///
+    template<typename dtype>
+    uint32 histogramBin(dtype inValue) noexcept
+    {
+        return static_cast<uint32>(static_cast<int32>(inValue) - static_cast<int32>(std::numeric_limits<dtype>::min()));
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Returns the value of a histogram bin
+    ///
+    /// @param inBin
+    /// @return dtype
+    ///
+    template<typename dtype>
+    dtype histogramValue(uint32 inBin) noexcept
+    {
+        return static_cast<dtype>(static_cast<int32>(inBin) + static_cast<int32>(std::numeric_limits<dtype>::min()));
+    }
+
+    //================================================================================
+    // Class Description:
+    /// Order statistics of a sliding window of 8 or 16 bit integers held in a two level
+    /// histogram (Huang). Inserting or removing a value is O(1) and selecting a rank
+    /// walks at most the coarse bins between the previous and the new rank plus the
+    /// fine bins of a single coarse bin, so sliding a K x K window by one pixel costs
+    /// O(K). Used for 1D windows and for 16 bit 2D windows.
+    ///
+    template<typename dtype>
+    class HistogramRankWindow
+    {
+    public:
+        //============================================================================
+        // Method Description:
+        /// Constructor
+        ///
+        HistogramRankWindow() :
+            fine_(NUM_BINS, 0),
+            coarse_(NUM_COARSE_BINS, 0)
+        {
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Replaces the window contents
+        ///
+        /// @param inValues
+        /// @param inCount
+        ///
+        void assign(const dtype* inValues, uint32 inCount)
+        {
+            for (uint32 coarseBin = 0; coarseBin < NUM_COARSE_BINS; ++coarseBin)
+            {
+                if (coarse_[coarseBin] != 0)
+                {
+                    const auto first = fine_.begin() + (static_cast<std::ptrdiff_t>(coarseBin) << FINE_BITS);
+                    std::fill(first, first + FINE_BINS, 0);
+                    coarse_[coarseBin] = 0;
+                }
+            }
+
+            pivot_      = 0;
+            countBelow_ = 0;
+            for (uint32 i = 0; i < inCount; ++i)
+            {
+                insert(inValues[i]);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Removes one value from the window and adds another
+        ///
+        /// @param inOutgoing
+        /// @param inIncoming
+        ///
+        void replace(dtype inOutgoing, dtype inIncoming)
+        {
+            erase(inOutgoing);
+            insert(inIncoming);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Removes inCount values from the window and adds inCount others
+        ///
+        /// @param inOutgoing
+        /// @param inIncoming
+        /// @param inCount
+        ///
+        void slide(const dtype* inOutgoing, const dtype* inIncoming, uint32 inCount)
+        {
+            for (uint32 i = 0; i < inCount; ++i)
+            {
+                replace(inOutgoing[i], inIncoming[i]);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the value of the given rank, ie the element that would be at that
+        /// index if the window were sorted
+        ///
+        /// @param inRank: must be smaller than the number of values in the window
+        /// @return dtype
+        ///
+        dtype select(uint32 inRank)
+        {
+            while (countBelow_ > inRank)
+            {
+                --pivot_;
+                countBelow_ -= coarse_[pivot_];
+            }
+
+            while (countBelow_ + coarse_[pivot_] <= inRank)
+            {
+                countBelow_ += coarse_[pivot_];
+                ++pivot_;
+            }
+
+            auto remaining = inRank - countBelow_;
+            auto bin       = pivot_ << FINE_BITS;
+            while (fine_[bin] <= remaining)
+            {
+                remaining -= fine_[bin];
+                ++bin;
+            }
+
+            return histogramValue<dtype>(bin);
+        }
+
+    private:
+        //====================================Attributes==============================
+        static constexpr uint32 NUM_BITS        = 8 * sizeof(dtype);
+        static constexpr uint32 FINE_BITS       = NUM_BITS / 2;
+        static constexpr uint32 NUM_BINS        = 1U << NUM_BITS;
+        static constexpr uint32 FINE_BINS       = 1U << FINE_BITS;
+        static constexpr uint32 NUM_COARSE_BINS = NUM_BINS / FINE_BINS;
+
+        std::vector<uint32> fine_{};
+        std::vector<uint32> coarse_{};
+        uint32              pivot_{ 0 };
+        uint32              countBelow_{ 0 };
+
+        //============================================================================
+        // Method Description:
+        /// Adds a value to the window
+        ///
+        /// @param inValue
+        ///
+        void insert(dtype inValue) noexcept
+        {
+            const auto bin       = histogramBin(inValue);
+            const auto coarseBin = bin >> FINE_BITS;
+            ++fine_[bin];
+            ++coarse_[coarseBin];
+            countBelow_ += static_cast<uint32>(coarseBin < pivot_); // branchless, the comparison is data dependent
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Removes a value from the window
+        ///
+        /// @param inValue
+        ///
+        void erase(dtype inValue) noexcept
+        {
+            const auto bin       = histogramBin(inValue);
+            const auto coarseBin = bin >> FINE_BITS;
+            --fine_[bin];
+            --coarse_[coarseBin];
+            countBelow_ -= static_cast<uint32>(coarseBin < pivot_); // branchless, the comparison is data dependent
+        }
+    };
+
+    //================================================================================
+    // Class Description:
+    /// Order statistics of a K x K window of 8 bit integers swept across a 2D array with
+    /// one histogram per array column (Perreault and Hebert). Moving down a row updates
+    /// each column histogram with one value out and one in, moving right adds one column
+    /// histogram to the window's coarse histogram and subtracts another, and the fine
+    /// bins of a coarse bin are only brought up to date when a rank search enters it.
+    /// Each output pixel therefore costs O(1) independently of K.
+    ///
+    template<typename dtype>
+    class ColumnHistogramRankWindow
+    {
+    public:
+        //============================================================================
+        // Method Description:
+        /// Constructor
+        ///
+        /// @param inNumColumns: the number of columns of the array
+        /// @param inSize: the window size
+        ///
+        ColumnHistogramRankWindow(uint32 inNumColumns, uint32 inSize) :
+            size_(inSize),
+            columnFine_(static_cast<std::size_t>(inNumColumns) * NUM_BINS, 0),
+            columnCoarse_(static_cast<std::size_t>(inNumColumns) * NUM_COARSE_BINS, 0),
+            fine_(NUM_BINS, 0),
+            coarse_(NUM_COARSE_BINS, 0),
+            fineColumn_(NUM_COARSE_BINS, NOT_UPDATED)
+        {
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Fills the column histograms with the inSize rows starting at inTop
+        ///
+        /// @param inTop: the first row of the window
+        /// @param inStride: the number of columns of the array
+        ///
+        void assign(const dtype* inTop, uint32 inStride)
+        {
+            std::fill(columnFine_.begin(), columnFine_.end(), 0);
+            std::fill(columnCoarse_.begin(), columnCoarse_.end(), 0);
+            for (uint32 row = 0; row < size_; ++row)
+            {
+                const auto rowBegin = inTop + static_cast<std::size_t>(row) * inStride;
+                for (uint32 col = 0; col < inStride; ++col)
+                {
+                    insert(col, rowBegin[col]);
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Moves the column histograms down one row
+        ///
+        /// @param inOutgoingRow: the row leaving the window
+        /// @param inIncomingRow: the row entering the window
+        /// @param inNumColumns: the number of columns of the array
+        ///
+        void moveDown(const dtype* inOutgoingRow, const dtype* inIncomingRow, uint32 inNumColumns)
+        {
+            for (uint32 col = 0; col < inNumColumns; ++col)
+            {
+                erase(col, inOutgoingRow[col]);
+                insert(col, inIncomingRow[col]);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Places the window on the columns [inCol, inCol + size). The window must
+        /// start each row at column 0 and then move one column at a time.
+        ///
+        /// @param inCol
+        ///
+        void moveTo(uint32 inCol)
+        {
+            if (inCol == 0)
+            {
+                std::fill(coarse_.begin(), coarse_.end(), 0);
+                std::fill(fineColumn_.begin(), fineColumn_.end(), NOT_UPDATED);
+                for (uint32 col = 0; col < size_; ++col)
+                {
+                    addCoarse(col);
+                }
+            }
+            else
+            {
+                subtractCoarse(inCol - 1);
+                addCoarse(inCol + size_ - 1);
+            }
+
+            col_ = inCol;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the value of the given rank, ie the element that would be at that
+        /// index if the window were sorted
+        ///
+        /// @param inRank: must be smaller than the number of values in the window
+        /// @return dtype
+        ///
+        dtype select(uint32 inRank)
+        {
+            uint32 coarseBin = 0;
+            while (coarse_[coarseBin] <= inRank)
+            {
+                inRank -= coarse_[coarseBin];
+                ++coarseBin;
+            }
+
+            updateFine(coarseBin);
+
+            auto bin = coarseBin << FINE_BITS;
+            while (fine_[bin] <= inRank)
+            {
+                inRank -= fine_[bin];
+                ++bin;
+            }
+
+            return histogramValue<dtype>(bin);
+        }
+
+    private:
+        //====================================Attributes==============================
+        static constexpr uint32 NUM_BITS        = 8 * sizeof(dtype);
+        static constexpr uint32 FINE_BITS       = NUM_BITS / 2;
+        static constexpr uint32 NUM_BINS        = 1U << NUM_BITS;
+        static constexpr uint32 FINE_BINS       = 1U << FINE_BITS;
+        static constexpr uint32 NUM_COARSE_BINS = NUM_BINS / FINE_BINS;
+        static constexpr uint32 NOT_UPDATED     = std::numeric_limits<uint32>::max();
+
+        uint32              size_{ 0 };
+        uint32              col_{ 0 };
+        std::vector<uint32> columnFine_{};
+        std::vector<uint32> columnCoarse_{};
+        std::vector<uint32> fine_{};
+        std::vector<uint32> coarse_{};
+        std::vector<uint32> fineColumn_{};
+
+        //============================================================================
+        // Method Description:
+        /// Adds a value to a column histogram
+        ///
+        /// @param inCol
+        /// @param inValue
+        ///
+        void insert(uint32 inCol, dtype inValue) noexcept
+        {
+            const auto bin = histogramBin(inValue);
+            ++columnFine_[static_cast<std::size_t>(inCol) * NUM_BINS + bin];
+            ++columnCoarse_[static_cast<std::size_t>(inCol) * NUM_COARSE_BINS + (bin >> FINE_BITS)];
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Removes a value from a column histogram
+        ///
+        /// @param inCol
+        /// @param inValue
+        ///
+        void erase(uint32 inCol, dtype inValue) noexcept
+        {
+            const auto bin = histogramBin(inValue);
+            --columnFine_[static_cast<std::size_t>(inCol) * NUM_BINS + bin];
+            --columnCoarse_[static_cast<std::size_t>(inCol) * NUM_COARSE_BINS + (bin >> FINE_BITS)];
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Adds a column histogram to the window's coarse histogram
+        ///
+        /// @param inCol
+        ///
+        void addCoarse(uint32 inCol) noexcept
+        {
+            const auto column = columnCoarse_.data() + static_cast<std::size_t>(inCol) * NUM_COARSE_BINS;
+            for (uint32 coarseBin = 0; coarseBin < NUM_COARSE_BINS; ++coarseBin)
+            {
+                coarse_[coarseBin] += column[coarseBin];
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Subtracts a column histogram from the window's coarse histogram
+        ///
+        /// @param inCol
+        ///
+        void subtractCoarse(uint32 inCol) noexcept
+        {
+            const auto column = columnCoarse_.data() + static_cast<std::size_t>(inCol) * NUM_COARSE_BINS;
+            for (uint32 coarseBin = 0; coarseBin < NUM_COARSE_BINS; ++coarseBin)
+            {
+                coarse_[coarseBin] -= column[coarseBin];
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Brings the fine bins of one coarse bin up to the current window position,
+        /// sliding them across the columns passed since they were last used or
+        /// summing them afresh when that is cheaper
+        ///
+        /// @param inCoarseBin
+        ///
+        void updateFine(uint32 inCoarseBin) noexcept
+        {
+            const auto offset     = static_cast<std::size_t>(inCoarseBin) << FINE_BITS;
+            auto       fine       = fine_.data() + offset;
+            const auto lastColumn = fineColumn_[inCoarseBin];
+
+            const auto addColumn = [this, fine, offset](uint32 inCol, bool inSubtract) noexcept
+            {
+                const auto column = columnFine_.data() + static_cast<std::size_t>(inCol) * NUM_BINS + offset;
+                for (uint32 bin = 0; bin < FINE_BINS; ++bin)
+                {
+                    fine[bin] = inSubtract ? fine[bin] - column[bin] : fine[bin] + column[bin];
+                }
+            };
+
+            if (lastColumn == NOT_UPDATED || col_ - lastColumn >= size_)
+            {
+                std::fill(fine, fine + FINE_BINS, 0);
+                for (uint32 col = col_; col < col_ + size_; ++col)
+                {
+                    addColumn(col, false);
+                }
+            }
+            else
+            {
+                for (uint32 col = lastColumn + 1; col <= col_; ++col)
+                {
+                    addColumn(col - 1, true);
+                    addColumn(col + size_ - 1, false);
+                }
+            }
+
+            fineColumn_[inCoarseBin] = col_;
+        }
+    };
+
+    //================================================================================
+    // Class Description:
+    /// Order statistics of a sliding window kept as a sorted vector. Single values are
+    /// moved in with a binary search, whole columns of a 2D window are merged in with
+    /// one linear pass so no per pixel sort or allocation is needed. Sliding a K x K
+    /// window by one pixel costs O(K log K) to sort the columns plus O(K^2) to merge.
+    ///
+    template<typename dtype>
+    class SortedRankWindow
+    {
+    public:
+        //============================================================================
+        // Method Description:
+        /// Replaces the window contents
+        ///
+        /// @param inValues
+        /// @param inCount
+        ///
+        void assign(const dtype* inValues, uint32 inCount)
+        {
+            values_.assign(inValues, inValues + inCount);
+            std::sort(values_.begin(), values_.end(), lessThan);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Removes one value from the window and adds another
+        ///
+        /// @param inOutgoing
+        /// @param inIncoming
+        ///
+        void replace(dtype inOutgoing, dtype inIncoming)
+        {
+            auto outIter = std::lower_bound(values_.begin(), values_.end(), inOutgoing, lessThan);
+            if (outIter == values_.end() || !equivalent(*outIter, inOutgoing))
+            {
+                // unordered values such as nan are never found by the binary search
+                outIter = std::find_if(values_.begin(),
+                                       values_.end(),
+                                       [inOutgoing](dtype value) noexcept { return equivalent(value, inOutgoing); });
+            }
+
+            // shift only the elements between the outgoing and incoming positions
+            auto inIter = std::upper_bound(values_.begin(), values_.end(), inIncoming, lessThan);
+            if (inIter > outIter)
+            {
+                std::move(outIter + 1, inIter, outIter);
+                *(inIter - 1) = inIncoming;
+            }
+            else
+            {
+                std::move_backward(inIter, outIter, outIter + 1);
+                *inIter = inIncoming;
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Removes inCount values from the window and adds inCount others
+        ///
+        /// @param inOutgoing
+        /// @param inIncoming
+        /// @param inCount
+        ///
+        void slide(const dtype* inOutgoing, const dtype* inIncoming, uint32 inCount)
+        {
+            outgoing_.assign(inOutgoing, inOutgoing + inCount);
+            incoming_.assign(inIncoming, inIncoming + inCount);
+            std::sort(outgoing_.begin(), outgoing_.end(), lessThan);
+            std::sort(incoming_.begin(), incoming_.end(), lessThan);
+
+            scratch_.clear();
+            auto outIter = outgoing_.begin();
+            auto inIter  = incoming_.begin();
+            for (const auto value : values_)
+            {
+                if (outIter != outgoing_.end() && equivalent(value, *outIter))
+                {
+                    ++outIter;
+                    continue;
+                }
+
+                while (inIter != incoming_.end() && lessThan(*inIter, value))
+                {
+                    scratch_.push_back(*inIter++);
+                }
+                scratch_.push_back(value);
+            }
+            scratch_.insert(scratch_.end(), inIter, incoming_.end());
+
+            if (scratch_.size() != values_.size())
+            {
+                // unordered values such as nan could not be matched, so fall back to one at a time
+                for (uint32 i = 0; i < inCount; ++i)
+                {
+                    replace(inOutgoing[i], inIncoming[i]);
+                }
+                return;
+            }
+
+            values_.swap(scratch_);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the value of the given rank, ie the element that would be at that
+        /// index if the window were sorted
+        ///
+        /// @param inRank: must be smaller than the number of values in the window
+        /// @return dtype
+        ///
+        dtype select(uint32 inRank) const noexcept
+        {
+            return values_[inRank];
+        }
+
+    private:
+        //====================================Attributes==============================
+        std::vector<dtype> values_{};
+        std::vector<dtype> outgoing_{};
+        std::vector<dtype> incoming_{};
+        std::vector<dtype> scratch_{};
+
+        //============================================================================
+        // Method Description:
+        /// The window ordering
+        ///
+        static bool lessThan(dtype lhs, dtype rhs) noexcept
+        {
+            return lhs < rhs;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Whether two values are the same under the window ordering, nan only
+        /// matching nan
+        ///
+        static bool equivalent(dtype lhs, dtype rhs) noexcept
+        {
+            if (isUnordered(lhs) || isUnordered(rhs))
+            {
+                return isUnordered(lhs) && isUnordered(rhs);
+            }
+
+            return !lessThan(lhs, rhs) && !lessThan(rhs, lhs);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Whether a value has no place in the window ordering
+        ///
+        static bool isUnordered(dtype inValue) noexcept
+        {
+            if constexpr (std::is_floating_point_v<dtype>)
+            {
+                return std::isnan(inValue);
+            }
+            else
+            {
+                return false;
+            }
+        }
+    };
+
+    //================================================================================
+    /// The window engine used for a dtype: a histogram for 8 and 16 bit integers,
+    /// a sorted window for everything else. 2D filters of 8 bit integers use
+    /// ColumnHistogramRankWindow instead.
+    template<typename dtype>
+    using RankWindow = std::conditional_t<std::is_integral_v<dtype> && !std::is_same_v<dtype, bool> &&
+                                              sizeof(dtype) <= sizeof(uint16),
+                                          HistogramRankWindow<dtype>,
+                                          SortedRankWindow<dtype>>;
+
+    //============================================================================
+    // Method Description:
+    /// Applies an order statistic to every inSize window along a 1D padded array
+    ///
+    /// @param inPaddedArray
+    /// @param inSize: the window size
+    /// @param inOutSize: the number of windows, size - inSize + 1
+    /// @param inFunction: callable taking the window and returning the output value
+    /// @return NdArray of shape (1, inOutSize)
+    ///
+    template<typename dtype, typename Function>
+    NdArray<dtype>
+        rankFilterValid1d(const NdArray<dtype>& inPaddedArray, uint32 inSize, uint32 inOutSize, Function inFunction)
+    {
+        NdArray<dtype> output(1, inOutSize);
+        if (output.isempty())
+        {
+            return output;
+        }
+
+        const auto        input = inPaddedArray.data();
+        RankWindow<dtype> window;
+        window.assign(input, inSize);
+        output[0] = inFunction(window);
+
+        for (uint32 i = 1; i < inOutSize; ++i)
+        {
+            window.replace(input[i - 1], input[i + inSize - 1]);
+            output[i] = inFunction(window);
+        }
+
+        return output;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Applies an order statistic to every inSize x inSize window of a 2D padded array.
+    /// Each row of output is swept left to right, swapping one column of the window
+    /// in and one out per pixel. 8 bit integers keep a histogram per column instead,
+    /// which is O(1) per pixel, 16 bit integers are O(K) and other types O(K^2).
+    ///
+    /// @param inPaddedArray
+    /// @param inSize: the window size
+    /// @param inOutShape: the number of windows, (rows - inSize + 1, cols - inSize + 1)
+    /// @param inFunction: callable taking the window and returning the output value
+    /// @return NdArray of shape inOutShape
+    ///
+    template<typename dtype, typename Function>
+    NdArray<dtype> rankFilterValid2d(const NdArray<dtype>& inPaddedArray,
+                                     uint32                inSize,
+                                     const Shape&          inOutShape,
+                                     Function              inFunction)
+    {
+        NdArray<dtype> output(inOutShape);
+        if (output.isempty())
+        {
+            return output;
+        }
+
+        const auto& paddedShape = inPaddedArray.shape();
+        const auto  input       = inPaddedArray.data();
+
+        if constexpr (std::is_integral_v<dtype> && !std::is_same_v<dtype, bool> && sizeof(dtype) == 1)
+        {
+            ColumnHistogramRankWindow<dtype> window(paddedShape.cols, inSize);
+            window.assign(input, paddedShape.cols);
+            for (uint32 row = 0; row < inOutShape.rows; ++row)
+            {
+                if (row > 0)
+                {
+                    window.moveDown(input + static_cast<std::size_t>(row - 1) * paddedShape.cols,
+                                    input + static_cast<std::size_t>(row + inSize - 1) * paddedShape.cols,
+                                    paddedShape.cols);
+                }
+
+                for (uint32 col = 0; col < inOutShape.cols; ++col)
+                {
+                    window.moveTo(col);
+                    output(row, col) = inFunction(window);
+                }
+            }
+        }
+        else
+        {
+            RankWindow<dtype>  window;
+            std::vector<dtype> buffer(static_cast<std::size_t>(inSize) * inSize);
+            std::vector<dtype> outgoing(inSize);
+            std::vector<dtype> incoming(inSize);
+
+            for (uint32 row = 0; row < inOutShape.rows; ++row)
+            {
+                const auto windowTop = input + static_cast<std::size_t>(row) * paddedShape.cols;
+                for (uint32 windowRow = 0; windowRow < inSize; ++windowRow)
+                {
+                    const auto rowBegin = windowTop + static_cast<std::size_t>(windowRow) * paddedShape.cols;
+                    std::copy(rowBegin,
+                              rowBegin + inSize,
+                              buffer.begin() + static_cast<std::ptrdiff_t>(windowRow) * inSize);
+                }
+
+                window.assign(buffer.data(), inSize * inSize);
+                output(row, 0) = inFunction(window);
+
+                for (uint32 col = 1; col < inOutShape.cols; ++col)
+                {
+                    for (uint32 windowRow = 0; windowRow < inSize; ++windowRow)
+                    {
+                        const auto rowBegin = windowTop + static_cast<std::size_t>(windowRow) * paddedShape.cols;
+                        outgoing[windowRow] = rowBegin[col - 1];
+                        incoming[windowRow] = rowBegin[col + inSize - 1];
+                    }
+
+                    window.slide(outgoing.data(), incoming.data(), inSize);
+                    output(row, col) = inFunction(window);
+                }
+            }
+        }
+
+        return output;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Returns the median of a window, averaging the two middle values for an even
+    /// count the same way NdArray::median does
+    ///
+    /// @param inWindow
+    /// @param inCount: the number of values in the window
+    /// @return dtype
+    ///
+    template<typename dtype, typename Window>
+    dtype windowMedian(Window& inWindow, uint32 inCount)
+    {
+        const uint32 middleIdx   = inCount / 2; // integer division
+        dtype        medianValue = inWindow.select(middleIdx);
+        if (inCount % 2 == 0)
+        {
+            // potentially integer division, ok
+            medianValue = static_cast<dtype>((medianValue + inWindow.select(middleIdx - 1)) / dtype{ 2 });
+        }
+
+        return medianValue;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Returns the percentile of a window with the same interpolation as nc::percentile
+    ///
+    /// @param inWindow
+    /// @param inCount: the number of values in the window
+    /// @param inPercentile: in the range [0, 100]
+    /// @param inInterpMethod
+    /// @return double
+    ///
+    template<typename Window>
+    double windowPercentile(Window& inWindow, uint32 inCount, double inPercentile, InterpolationMethod inInterpMethod)
+    {
+        if (inCount == 1 || utils::essentiallyEqual(inPercentile, 0.))
+        {
+            return static_cast<double>(inWindow.select(0));
+        }
+        if (utils::essentiallyEqual(inPercentile, 100.))
+        {
+            return static_cast<double>(inWindow.select(inCount - 1));
+        }
+
+        const auto lastIndex  = static_cast<double>(inCount - 1);
+        const auto indexLower = std::min(static_cast<uint32>(std::floor(lastIndex * inPercentile / 100.)), inCount - 2);
+        const auto lower      = static_cast<double>(inWindow.select(indexLower));
+        const auto upper      = static_cast<double>(inWindow.select(indexLower + 1));
+
+        const double percent      = inPercentile / 100.;
+        const double percentLower = static_cast<double>(indexLower) / lastIndex;
+        const double percentUpper = static_cast<double>(indexLower + 1) / lastIndex;
+
+        switch (inInterpMethod)
+        {
+            case InterpolationMethod::LINEAR:
+            {
+                const double fraction = (percent - percentLower) / (percentUpper - percentLower);
+                return lower + (upper - lower) * fraction;
+            }
+            case InterpolationMethod::LOWER:
+            {
+                return lower;
+            }
+            case InterpolationMethod::HIGHER:
+            {
+                return upper;
+            }
+            case InterpolationMethod::NEAREST:
+            {
+                return percent - percentLower <= percentUpper - percent ? lower : upper;
+            }
+            case InterpolationMethod::MIDPOINT:
+            {
+                return (lower + upper) / 2.;
+            }
+            default:
+            {
+                THROW_INVALID_ARGUMENT_ERROR("Unimplemented Interpolation method.");
+                return {}; // get rid of compiler warning
+            }
+        }
+    }
+} // namespace nc::filter::detail
@@ -0,0 +1,151 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// van Herk/Gil-Werman running extremum passes shared by the minimum and maximum filters
+///
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::filter::detail
+{
+    //============================================================================
+    // Method Description:
+    /// Takes the extremum of every inSize wide window along the rows of an array with
+    /// the van Herk/Gil-Werman algorithm. The row is cut into blocks of inSize, each
+    /// window spans the tail of one block and the head of the next, so a running
+    /// extremum from the block ends gives every window in three comparisons no matter
+    /// the window size.
+    ///
+    /// @param inArray
+    /// @param inSize: the window size
+    /// @param inFunction: binary function returning the extremum of its arguments
+    /// @return NdArray of shape (rows, cols - inSize + 1)
+    ///
+    template<typename dtype, typename Function>
+    NdArray<dtype> runningExtremumRows(const NdArray<dtype>& inArray, uint32 inSize, Function inFunction)
+    {
+        const auto& inShape = inArray.shape();
+        const auto  outCols = inShape.cols - inSize + 1;
+
+        NdArray<dtype>     output(inShape.rows, outCols);
+        std::vector<dtype> prefix(inShape.cols);
+        std::vector<dtype> suffix(inShape.cols);
+        for (uint32 row = 0; row < inShape.rows; ++row)
+        {
+            const auto* inRow  = inArray.data() + static_cast<std::size_t>(row) * inShape.cols;
+            auto*       outRow = output.data() + static_cast<std::size_t>(row) * outCols;
+
+            for (uint32 blockBegin = 0; blockBegin < inShape.cols; blockBegin += inSize)
+            {
+                const auto blockEnd = std::min(blockBegin + inSize, inShape.cols);
+
+                prefix[blockBegin] = inRow[blockBegin];
+                for (uint32 col = blockBegin + 1; col < blockEnd; ++col)
+                {
+                    prefix[col] = inFunction(prefix[col - 1], inRow[col]);
+                }
+
+                suffix[blockEnd - 1] = inRow[blockEnd - 1];
+                for (uint32 col = blockEnd - 1; col-- > blockBegin;)
+                {
+                    suffix[col] = inFunction(suffix[col + 1], inRow[col]);
+                }
+            }
+
+            for (uint32 col = 0; col < outCols; ++col)
+            {
+                outRow[col] = inFunction(suffix[col], prefix[col + inSize - 1]);
+            }
+        }
+
+        return output;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Takes the extremum of every inSize tall window along the columns of an array
+    /// with the van Herk/Gil-Werman algorithm, processing whole rows at a time so
+    /// the array is only ever traversed contiguously.
+    ///
+    /// @param inArray
+    /// @param inSize: the window size
+    /// @param inFunction: binary function returning the extremum of its arguments
+    /// @return NdArray of shape (rows - inSize + 1, cols)
+    ///
+    template<typename dtype, typename Function>
+    NdArray<dtype> runningExtremumColumns(const NdArray<dtype>& inArray, uint32 inSize, Function inFunction)
+    {
+        const auto& inShape = inArray.shape();
+        const auto  outRows = inShape.rows - inSize + 1;
+        const auto  numCols = static_cast<std::size_t>(inShape.cols);
+
+        NdArray<dtype>     output(outRows, inShape.cols);
+        std::vector<dtype> prefix(inArray.size());
+        std::vector<dtype> suffix(inArray.size());
+
+        const auto rowOf = [numCols](auto* inData, uint32 inRow) noexcept { return inData + inRow * numCols; };
+
+        for (uint32 blockBegin = 0; blockBegin < inShape.rows; blockBegin += inSize)
+        {
+            const auto blockEnd = std::min(blockBegin + inSize, inShape.rows);
+
+            std::copy_n(rowOf(inArray.data(), blockBegin), numCols, rowOf(prefix.data(), blockBegin));
+            for (uint32 row = blockBegin + 1; row < blockEnd; ++row)
+            {
+                std::transform(rowOf(prefix.data(), row - 1),
+                               rowOf(prefix.data(), row),
+                               rowOf(inArray.data(), row),
+                               rowOf(prefix.data(), row),
+                               inFunction);
+            }
+
+            std::copy_n(rowOf(inArray.data(), blockEnd - 1), numCols, rowOf(suffix.data(), blockEnd - 1));
+            for (uint32 row = blockEnd - 1; row-- > blockBegin;)
+            {
+                std::transform(rowOf(suffix.data(), row + 1),
+                               rowOf(suffix.data(), row + 2),
+                               rowOf(inArray.data(), row),
+                               rowOf(suffix.data(), row),
+                               inFunction);
+            }
+        }
+
+        for (uint32 row = 0; row < outRows; ++row)
+        {
+            std::transform(rowOf(suffix.data(), row),
+                           rowOf(suffix.data(), row + 1),
+                           rowOf(prefix.data(), row + inSize - 1),
+                           rowOf(output.data(), row),
+                           inFunction);
+        }
+
+        return output;
+    }
+} // namespace nc::filter::detail
@@ -181,6 +181,7 @@
 #include "NumCpp/Functions/maximum.hpp"
 #include "NumCpp/Functions/mean.hpp"
 #include "NumCpp/Functions/median.hpp"
+#include "NumCpp/Functions/memmap.hpp"
 #include "NumCpp/Functions/meshgrid.hpp"
 #include "NumCpp/Functions/min.hpp"
 #include "NumCpp/Functions/minimum.hpp"
@@ -247,6 +248,7 @@
 #include "NumCpp/Functions/rot90.hpp"
 #include "NumCpp/Functions/round.hpp"
 #include "NumCpp/Functions/row_stack.hpp"
+#include "NumCpp/Functions/save.hpp"
 #include "NumCpp/Functions/searchsorted.hpp"
 #include "NumCpp/Functions/select.hpp"
 #include "NumCpp/Functions/setdiff1d.hpp"
@@ -83,21 +83,7 @@ namespace nc
         if (shape1.cols == shape2.rows)
         {
             // 2D array, use matrix multiplication
-            NdArray<std::complex<dtype>> returnArray(shape1.rows, shape2.cols);
-            auto                         array2T = inArray2.transpose();
-
-            for (uint32 i = 0; i < shape1.rows; ++i)
-            {
-                for (uint32 j = 0; j < shape2.cols; ++j)
-                {
-                    returnArray(i, j) = stl_algorithms::transform_reduce(array2T.cbegin(j),
-                                                                         array2T.cend(j),
-                                                                         inArray1.cbegin(i),
-                                                                         std::complex<dtype>{ 0 });
-                }
-            }
-
-            return returnArray;
+            return inArray1.template astype<std::complex<dtype>>().dot(inArray2);
         }
 
         std::string errStr = "shapes of [" + utils::num2str(shape1.rows) + ", " + utils::num2str(shape1.cols) + "]";
@@ -141,21 +127,7 @@ namespace nc
         if (shape1.cols == shape2.rows)
         {
             // 2D array, use matrix multiplication
-            NdArray<std::complex<dtype>> returnArray(shape1.rows, shape2.cols);
-            auto                         array2T = inArray2.transpose();
-
-            for (uint32 i = 0; i < shape1.rows; ++i)
-            {
-                for (uint32 j = 0; j < shape2.cols; ++j)
-                {
-                    returnArray(i, j) = stl_algorithms::transform_reduce(array2T.cbegin(j),
-                                                                         array2T.cend(j),
-                                                                         inArray1.cbegin(i),
-                                                                         std::complex<dtype>{ 0 });
-                }
-            }
-
-            return returnArray;
+            return inArray1.dot(inArray2.template astype<std::complex<dtype>>());
         }
 
         std::string errStr = "shapes of [" + utils::num2str(shape1.rows) + ", " + utils::num2str(shape1.cols) + "]";
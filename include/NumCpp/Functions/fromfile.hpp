@@ -29,8 +29,6 @@
 
 #include <filesystem>
 #include <fstream>
-#include <memory>
-#include <sstream>
 #include <string>
 
 #include "NumCpp/Core/Internal/Error.hpp"
@@ -69,9 +67,10 @@ namespace nc
         const auto fileSize = static_cast<uint64>(file.tellg());
         file.seekg(0, std::ifstream::beg);
 
-        std::vector<char> fileBuffer;
-        fileBuffer.reserve(fileSize);
-        file.read(fileBuffer.data(), fileSize);
+        // read straight into the array's buffer
+        NdArray<dtype> returnArray(1, static_cast<uint32>(fileSize / sizeof(dtype)));
+        file.read(reinterpret_cast<char*>(returnArray.data()),
+                  static_cast<std::streamsize>(returnArray.size() * sizeof(dtype)));
 
         if (file.bad() || file.fail())
         {
@@ -80,8 +79,6 @@ namespace nc
 
         file.close();
 
-        NdArray<dtype> returnArray(reinterpret_cast<dtype*>(fileBuffer.data()), fileSize / sizeof(dtype));
-
         return returnArray;
     }
 
@@ -98,16 +95,25 @@ namespace nc
     template<typename dtype>
     NdArray<dtype> fromfile(const std::string& inFilename, const char inSep)
     {
-        std::ifstream file(inFilename.c_str());
+        std::ifstream file(inFilename.c_str(), std::ios::in | std::ios::binary);
         if (!file.is_open())
         {
             THROW_INVALID_ARGUMENT_ERROR("unable to open file\n\t" + inFilename);
         }
 
-        std::stringstream buffer;
-        buffer << file.rdbuf();
+        file.seekg(0, std::ifstream::end);
+        const auto fileSize = static_cast<uint64>(file.tellg());
+        file.seekg(0, std::ifstream::beg);
+
+        std::string buffer(fileSize, '\0');
+        file.read(buffer.data(), static_cast<std::streamsize>(fileSize));
+        if (file.bad() || file.fail())
+        {
+            THROW_INVALID_ARGUMENT_ERROR("error occured while reading the file\n");
+        }
+
         file.close();
 
-        return fromstring<dtype>(buffer.str(), inSep);
+        return fromstring<dtype>(buffer, inSep);
     }
 } // namespace nc
@@ -27,16 +27,153 @@
 ///
 #pragma once
 
-#include <sstream>
+#include <algorithm>
+#include <limits>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
+#include "NumCpp/Core/Internal/CharConv.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/ParallelFor.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Shape.hpp"
+#include "NumCpp/Core/Types.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc
 {
+    namespace detail
+    {
+        /// text is not split into pieces smaller than this many characters for parsing
+        constexpr std::size_t MIN_PARSE_CHUNK = 1 << 20;
+
+        //============================================================================
+        // Class Description:
+        /// Counts of the values in a piece of text
+        ///
+        struct TextCounts
+        {
+            uint64 numValues{ 0 };
+            uint64 numLines{ 0 };
+            uint64 valuesPerLine{ 0 };
+            bool   ragged{ false };
+        };
+
+        //============================================================================
+        // Method Description:
+        /// Returns whether the character separates values
+        ///
+        /// @param inChar
+        /// @param inSep
+        /// @return bool
+        ///
+        inline bool isDelimiter(char inChar, char inSep) noexcept
+        {
+            return inChar == inSep || inChar == ' ' || inChar == '\n' || inChar == '\t' || inChar == '\r' ||
+                   inChar == '\v' || inChar == '\f';
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Counts the values and the values per line of a piece of text
+        ///
+        /// @param inText
+        /// @param inSep
+        /// @return TextCounts
+        ///
+        inline TextCounts countValues(std::string_view inText, char inSep) noexcept
+        {
+            TextCounts counts;
+            uint64     lineValues = 0;
+            const auto endLine    = [&counts, &lineValues]() noexcept
+            {
+                if (lineValues == 0)
+                {
+                    return;
+                }
+
+                if (counts.numLines == 0)
+                {
+                    counts.valuesPerLine = lineValues;
+                }
+                counts.ragged = counts.ragged || lineValues != counts.valuesPerLine;
+                ++counts.numLines;
+                lineValues = 0;
+            };
+
+            bool inToken = false;
+            for (const char c : inText)
+            {
+                if (isDelimiter(c, inSep))
+                {
+                    inToken = false;
+                    if (c == '\n')
+                    {
+                        endLine();
+                    }
+                }
+                else if (!inToken)
+                {
+                    inToken = true;
+                    ++counts.numValues;
+                    ++lineValues;
+                }
+            }
+            endLine();
+
+            return counts;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Parses the values of a piece of text into the output buffer
+        ///
+        /// @param inText
+        /// @param inSep
+        /// @param outValues: receives the values, must hold all of them
+        /// @return the offset into the text of the first value that could not be
+        ///         parsed, or npos
+        ///
+        template<typename dtype>
+        std::size_t parseValues(std::string_view inText, char inSep, dtype* outValues) noexcept
+        {
+            const char* const begin = inText.data();
+            const char* const end   = begin + inText.size();
+            const char*       iter  = begin;
+            while (iter != end)
+            {
+                if (isDelimiter(*iter, inSep))
+                {
+                    ++iter;
+                    continue;
+                }
+
+                const char* tokenEnd = iter;
+                while (tokenEnd != end && !isDelimiter(*tokenEnd, inSep))
+                {
+                    ++tokenEnd;
+                }
+
+                if (charconv::fromChars(iter, tokenEnd, *outValues++) != tokenEnd)
+                {
+                    return static_cast<std::size_t>(iter - begin);
+                }
+                iter = tokenEnd;
+            }
+
+            return std::string_view::npos;
+        }
+    } // namespace detail
+
     //============================================================================
     // Method Description:
-    /// Construct an array from data in a string
+    /// Construct an array from data in a string. Values are separated by the
+    /// separator or whitespace. If the text has more than one line and every
+    /// line holds the same number of values the array has one row per line,
+    /// otherwise it is a single row. Large strings are parsed in pieces split on
+    /// line boundaries across threads when NUMCPP_USE_MULTITHREAD is defined.
     ///
     /// NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.fromstring.html
     ///
@@ -45,28 +182,88 @@ namespace nc
     /// @return NdArray
     ///
     template<typename dtype>
-    NdArray<dtype> fromstring(const std::string& inStr, const char inSep = ' ')
+    NdArray<dtype> fromstring(std::string_view inStr, const char inSep = ' ')
     {
         STATIC_ASSERT_ARITHMETIC(dtype);
 
-        std::istringstream inputStream(inStr);
-        auto               values = std::vector<dtype>{};
-        dtype              value{};
-        for (std::string segment; std::getline(inputStream, segment, inSep);)
+        // split the text on line boundaries
+        std::vector<std::string_view> pieces;
+        uint32                        numPieces = 1;
+#ifdef PARALLEL_ALGORITHMS_SUPPORTED
+        numPieces = static_cast<uint32>(
+            std::max<std::size_t>(std::min<std::size_t>(std::thread::hardware_concurrency(),
+                                                        inStr.size() / detail::MIN_PARSE_CHUNK),
+                                  1));
+#endif
+        std::size_t pieceBegin = 0;
+        for (uint32 piece = 1; piece <= numPieces && pieceBegin < inStr.size(); ++piece)
         {
-            if (!inputStream.fail())
+            auto pieceEnd = inStr.size();
+            if (piece < numPieces)
             {
-                std::istringstream segmentStream(segment);
-                while (segmentStream >> value)
-                {
-                    if (!inputStream.fail())
-                    {
-                        values.push_back(value);
-                    }
-                }
+                pieceEnd = inStr.find('\n', std::max(pieceBegin, inStr.size() * piece / numPieces));
+                pieceEnd = pieceEnd == std::string_view::npos ? inStr.size() : pieceEnd + 1;
+            }
+            pieces.push_back(inStr.substr(pieceBegin, pieceEnd - pieceBegin));
+            pieceBegin = pieceEnd;
+        }
+
+        std::vector<detail::TextCounts> counts(pieces.size());
+        parallel::parallelFor(static_cast<uint32>(pieces.size()),
+                              [&](uint32 piece) { counts[piece] = detail::countValues(pieces[piece], inSep); });
+
+        // combine the counts of the pieces to find the shape and where each piece's values go
+        std::vector<uint64> offsets(pieces.size() + 1, 0);
+        uint64              numLines      = 0;
+        uint64              valuesPerLine = 0;
+        bool                ragged        = false;
+        for (std::size_t piece = 0; piece < pieces.size(); ++piece)
+        {
+            const auto& pieceCounts = counts[piece];
+            offsets[piece + 1]      = offsets[piece] + pieceCounts.numValues;
+            if (pieceCounts.numLines == 0)
+            {
+                continue;
+            }
+
+            if (numLines == 0)
+            {
+                valuesPerLine = pieceCounts.valuesPerLine;
+            }
+            ragged = ragged || pieceCounts.ragged || pieceCounts.valuesPerLine != valuesPerLine;
+            numLines += pieceCounts.numLines;
+        }
+
+        const auto numValues = offsets.back();
+        if (numValues > std::numeric_limits<uint32>::max())
+        {
+            THROW_INVALID_ARGUMENT_ERROR("too many values in the string.");
+        }
+
+        const auto     returnShape = numLines > 1 && !ragged
+                                         ? Shape(static_cast<uint32>(numLines), static_cast<uint32>(valuesPerLine))
+                                         : Shape(1, static_cast<uint32>(numValues));
+        NdArray<dtype> returnArray(returnShape);
+
+        std::vector<std::size_t> errors(pieces.size(), std::string_view::npos);
+        parallel::parallelFor(static_cast<uint32>(pieces.size()),
+                              [&](uint32 piece)
+                              {
+                                  errors[piece] = detail::parseValues(pieces[piece],
+                                                                      inSep,
+                                                                      returnArray.data() + offsets[piece]);
+                              });
+
+        for (std::size_t piece = 0; piece < pieces.size(); ++piece)
+        {
+            if (errors[piece] != std::string_view::npos)
+            {
+                const auto token = pieces[piece].substr(errors[piece], 32);
+                THROW_INVALID_ARGUMENT_ERROR("unable to parse value from '" +
+                                             std::string(token.substr(0, token.find_first_of(" \t\r\n"))) + "'");
             }
         }
 
-        return NdArray<dtype>(values);
+        return returnArray;
     }
 } // namespace nc
@@ -27,8 +27,13 @@
 ///
 #pragma once
 
+#include <array>
+#include <fstream>
 #include <string>
 
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/NpyFormat.hpp"
+#include "NumCpp/Core/Shape.hpp"
 #include "NumCpp/Functions/fromfile.hpp"
 #include "NumCpp/NdArray.hpp"
 
@@ -36,7 +41,11 @@ namespace nc
 {
     //============================================================================
     // Method Description:
-    /// loads a .bin file from the dump() method into an NdArray
+    /// loads a .npy file from the save() method, or a .bin file from the dump()
+    /// method, into an NdArray. .npy files keep their shape, are converted to the
+    /// native byte order, and fortran ordered files are transposed into row major
+    /// order. The dtype of a .npy file must match the requested dtype. Files
+    /// without a .npy header are read as a single row of raw values.
     ///
     /// NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.load.html
     ///
@@ -47,6 +56,44 @@ namespace nc
     template<typename dtype>
     NdArray<dtype> load(const std::string& inFilename)
     {
-        return fromfile<dtype>(inFilename);
+        std::ifstream file(inFilename.c_str(), std::ios::in | std::ios::binary);
+        if (!file.is_open())
+        {
+            THROW_INVALID_ARGUMENT_ERROR("unable to open file\n\t" + inFilename);
+        }
+
+        std::array<char, npy::MAGIC.size()> magic{};
+        file.read(magic.data(), magic.size());
+        if (!file || !npy::isNpy(magic.data(), magic.size()))
+        {
+            file.close();
+            return fromfile<dtype>(inFilename);
+        }
+
+        file.seekg(0, std::ifstream::beg);
+        const auto header       = npy::readHeader(file);
+        const auto byteSwap     = npy::byteSwapRequired<dtype>(header);
+        const auto shape        = npy::toShape(header);
+        const auto fortranOrder = header.fortranOrder && shape.rows > 1 && shape.cols > 1;
+
+        NdArray<dtype> returnArray(fortranOrder ? Shape(shape.cols, shape.rows) : shape);
+        file.read(reinterpret_cast<char*>(returnArray.data()),
+                  static_cast<std::streamsize>(returnArray.size() * sizeof(dtype)));
+        if (file.fail())
+        {
+            THROW_INVALID_ARGUMENT_ERROR("npy file is truncated\n\t" + inFilename);
+        }
+
+        if (byteSwap)
+        {
+            npy::byteSwap(returnArray.data(), returnArray.size());
+        }
+
+        if (fortranOrder)
+        {
+            return returnArray.transpose();
+        }
+
+        return returnArray;
     }
 } // namespace nc
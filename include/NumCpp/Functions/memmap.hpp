@@ -0,0 +1,55 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Functions for working with NdArrays
+///
+#pragma once
+
+#include <string>
+
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/MemMap.hpp"
+
+namespace nc
+{
+    //============================================================================
+    // Method Description:
+    /// Memory maps a file from the save(), dump() or tofile() methods. The file is
+    /// not read up front, pages are loaded as the returned array is accessed.
+    ///
+    /// NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.memmap.html
+    ///
+    /// @param inFilename
+    /// @param inMode: COPY_ON_WRITE keeps modifications private to the process,
+    ///                READ_WRITE writes them back to the file. default COPY_ON_WRITE
+    ///
+    /// @return MemMap
+    ///
+    template<typename dtype>
+    MemMap<dtype> memmap(const std::string& inFilename, MapMode inMode = MapMode::COPY_ON_WRITE)
+    {
+        return MemMap<dtype>(inFilename, inMode);
+    }
+} // namespace nc
@@ -0,0 +1,80 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Functions for working with NdArrays
+///
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/NpyFormat.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc
+{
+    //============================================================================
+    // Method Description:
+    /// Save an array to a binary file in NumPy .npy format. The header records
+    /// the shape, dtype and byte order so the file can be read back with load()
+    /// or memmap(), or from Python with numpy.load. If the filename has no
+    /// extension ".npy" is appended.
+    ///
+    /// NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.save.html
+    ///
+    /// @param inArray
+    /// @param inFilename
+    ///
+    template<typename dtype>
+    void save(const NdArray<dtype>& inArray, const std::string& inFilename)
+    {
+        STATIC_ASSERT_ARITHMETIC_OR_COMPLEX(dtype);
+
+        std::filesystem::path f(inFilename);
+        if (!f.has_extension())
+        {
+            f.replace_extension("npy");
+        }
+
+        std::ofstream ofile(f.c_str(), std::ios::binary);
+        if (!ofile.good())
+        {
+            THROW_RUNTIME_ERROR("Unable to open the input file:\n\t" + inFilename);
+        }
+
+        const auto header = npy::makeHeader<dtype>(inArray.shape());
+        ofile.write(header.data(), static_cast<std::streamsize>(header.size()));
+        ofile.write(reinterpret_cast<const char*>(inArray.data()),
+                    static_cast<std::streamsize>(inArray.size() * sizeof(dtype)));
+
+        if (!ofile.good())
+        {
+            THROW_RUNTIME_ERROR("error occured while writing the file\n\t" + inFilename);
+        }
+    }
+} // namespace nc
@@ -28,9 +28,11 @@
 #pragma once
 
 #include "NumCpp/ImageProcessing/Centroid.hpp"
+#include "NumCpp/ImageProcessing/CentroidDetector.hpp"
 #include "NumCpp/ImageProcessing/Cluster.hpp"
 #include "NumCpp/ImageProcessing/ClusterMaker.hpp"
 #include "NumCpp/ImageProcessing/Pixel.hpp"
+#include "NumCpp/ImageProcessing/ThresholdGenerator.hpp"
 #include "NumCpp/ImageProcessing/applyThreshold.hpp"
 #include "NumCpp/ImageProcessing/centroidClusters.hpp"
 #include "NumCpp/ImageProcessing/clusterPixels.hpp"
@@ -27,6 +27,7 @@
 ///
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <string>
@@ -74,6 +75,33 @@ namespace nc::imageProcessing
             setEllipseProperties(inCluster);
         }
 
+        //=============================================================================
+        // Description:
+        /// constructor from the moments of a cluster
+        ///
+        /// @param inRow: center of mass row
+        /// @param inCol: center of mass col
+        /// @param inIntensity: summed cluster intensity
+        /// @param inEod: cluster energy on detector
+        /// @param inM20: mean squared col offset of the cluster pixels from the center of mass
+        /// @param inM02: mean squared row offset of the cluster pixels from the center of mass
+        /// @param inM11: mean product of the col and row offsets
+        ///
+        Centroid(double        inRow,
+                 double        inCol,
+                 accumulator_t inIntensity,
+                 double        inEod,
+                 double        inM20,
+                 double        inM02,
+                 double        inM11) noexcept :
+            row_(inRow),
+            col_(inCol),
+            intensity_(inIntensity),
+            eod_(inEod)
+        {
+            setEllipseProperties(inM20, inM02, inM11);
+        }
+
         //=============================================================================
         // Description:
         /// gets the centroid row
@@ -300,8 +328,6 @@ namespace nc::imageProcessing
         ///
         void setEllipseProperties(const Cluster<dtype>& inCluster) noexcept
         {
-            constexpr auto two = static_cast<double>(2.);
-
             auto m20 = static_cast<double>(0.);
             auto m02 = static_cast<double>(0.);
             auto m11 = static_cast<double>(0.);
@@ -322,13 +348,29 @@ namespace nc::imageProcessing
             m20 /= numPixels;
             m02 /= numPixels;
 
+            setEllipseProperties(m20, m02, m11);
+        }
+
+        //=============================================================================
+        // Description:
+        /// Sets the cluster ellipse properties from the second moments of its pixels
+        ///
+        /// @param m20
+        /// @param m02
+        /// @param m11
+        ///
+        void setEllipseProperties(double m20, double m02, double m11) noexcept
+        {
+            constexpr auto two = static_cast<double>(2.);
+
             double piece1 = m20 + m02;
             piece1 /= two;
 
             double piece2 = std::sqrt(static_cast<double>(4.) * utils::sqr(m11) + utils::sqr(m20 - m02));
             piece2 /= two;
 
-            const double lambda1 = piece1 - piece2;
+            // rounding can leave the minor eigenvalue of a line shaped cluster slightly negative
+            const double lambda1 = std::max(piece1 - piece2, 0.);
             const double lambda2 = piece1 + piece2;
 
             eccentricity_ = std::sqrt(static_cast<double>(1.) - lambda1 / lambda2);
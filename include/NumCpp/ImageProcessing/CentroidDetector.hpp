@@ -0,0 +1,733 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Fused threshold, window, cluster and centroid detector
+///
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/ParallelFor.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Internal/StlAlgorithms.hpp"
+#include "NumCpp/Core/Shape.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/ImageProcessing/Centroid.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::imageProcessing
+{
+    //=============================================================================
+    // Class Description:
+    /// Generates the centroids of a frame in a single raster pass: thresholds, windows
+    /// and labels the pixels and accumulates the moments of each cluster as it goes,
+    /// without building the exceedance array, pixels or clusters. The internal buffers
+    /// are reused from one frame to the next.
+    ///
+    /// The frame is split into bands of rows that are labeled independently, across
+    /// threads when NUMCPP_USE_MULTITHREAD is defined, and the clusters that cross the
+    /// seams between bands are then stitched together.
+    template<typename dtype>
+    class CentroidDetector
+    {
+    private:
+        STATIC_ASSERT_ARITHMETIC(dtype);
+
+    public:
+        //================================Typedefs=====================================
+        using accumulator_t = typename Centroid<dtype>::accumulator_t;
+
+        //=============================================================================
+        // Description:
+        /// constructor
+        ///
+        /// @param inWindowType: (string "pre", or "post" for where to apply the exceedance windowing)
+        /// @param inBorderWidth: border to apply (default 0)
+        /// @param inNumBands: number of row bands, 0 for one per hardware thread (default 0)
+        ///
+        explicit CentroidDetector(const std::string& inWindowType, uint8 inBorderWidth = 0, uint32 inNumBands = 0) :
+            numBands_(inNumBands)
+        {
+            if (inWindowType == "pre")
+            {
+                borderWidthPre_ = inBorderWidth;
+            }
+            else if (inWindowType == "post")
+            {
+                borderWidthPost_ = inBorderWidth;
+            }
+            else
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input window type options are ['pre', 'post']");
+            }
+        }
+
+        //=============================================================================
+        // Description:
+        /// generates the centroids of the clusters of pixels above the threshold, in
+        /// the same order as centroidClusters(clusterPixels(...))
+        ///
+        /// @param inImageArray
+        /// @param inThreshold
+        /// @return std::vector<Centroid>, valid until the next call
+        ///
+        const std::vector<Centroid<dtype>>& detect(const NdArray<dtype>& inImageArray, dtype inThreshold)
+        {
+            reset(inImageArray.shape());
+
+            parallel::parallelFor(static_cast<uint32>(bands_.size()),
+                                  [this, &inImageArray, inThreshold](uint32 bandIdx)
+                                  { labelBand(bands_[bandIdx], inImageArray, inThreshold); });
+
+            stitchBands();
+
+            if (borderWidthPost_ > 0)
+            {
+                expandClusters(inImageArray);
+            }
+
+            makeCentroids();
+            return centroids_;
+        }
+
+        //=============================================================================
+        // Description:
+        /// returns the centroids of the last detected frame
+        ///
+        /// @return std::vector<Centroid>
+        ///
+        [[nodiscard]] const std::vector<Centroid<dtype>>& centroids() const noexcept
+        {
+            return centroids_;
+        }
+
+    private:
+        //=============================================================================
+        // Class Description:
+        /// running moments of a cluster, positions relative to the cluster's first pixel
+        struct Moments
+        {
+            uint32        originRow{ 0 };
+            uint32        originCol{ 0 };
+            uint32        rowMin{ 0 };
+            uint32        rowMax{ 0 };
+            uint32        colMin{ 0 };
+            uint32        colMax{ 0 };
+            double        numPixels{ 0. };
+            accumulator_t intensity{ 0 };
+            dtype         peakPixelIntensity{ 0 };
+            double        weight{ 0. };
+            double        weightedRow{ 0. };
+            double        weightedCol{ 0. };
+            double        sumRow{ 0. };
+            double        sumCol{ 0. };
+            double        sumRowSqr{ 0. };
+            double        sumColSqr{ 0. };
+            double        sumRowCol{ 0. };
+        };
+
+        //=============================================================================
+        // Class Description:
+        /// a band of rows labeled on its own, with labels local to the band
+        struct Band
+        {
+            uint32               rowBegin{ 0 };
+            uint32               rowEnd{ 0 };
+            uint32               labelOffset{ 0 };
+            std::vector<uint32>  colCounts{};
+            std::vector<uint8>   rowMask{};
+            std::vector<uint32>  parents{};
+            std::vector<Moments> moments{};
+        };
+
+        /// bands are not split below this many rows
+        static constexpr uint32 MIN_BAND_ROWS = 64;
+
+        //==================================Attributes=================================
+        uint8  borderWidthPre_{ 0 };
+        uint8  borderWidthPost_{ 0 };
+        uint32 numBands_{ 0 };
+        Shape  shape_{};
+
+        std::vector<Band>            bands_{};
+        std::vector<uint32>          labels_{};
+        std::vector<uint32>          parents_{};
+        std::vector<Moments>         moments_{};
+        std::vector<uint32>          roots_{};
+        std::vector<Centroid<dtype>> centroids_{};
+
+        //=============================================================================
+        // Description:
+        /// sizes the buffers for the frame and splits it into bands
+        ///
+        /// @param inShape
+        ///
+        void reset(const Shape& inShape)
+        {
+            shape_ = inShape;
+            labels_.resize(shape_.size());
+
+            uint32 numBands = numBands_;
+            if (numBands == 0)
+            {
+                numBands = 1;
+#ifdef PARALLEL_ALGORITHMS_SUPPORTED
+                numBands = std::min(std::max(std::thread::hardware_concurrency(), 1U), shape_.rows / MIN_BAND_ROWS);
+#endif
+            }
+            numBands = std::max(std::min(numBands, shape_.rows), 1U);
+
+            bands_.resize(numBands);
+            for (uint32 bandIdx = 0; bandIdx < numBands; ++bandIdx)
+            {
+                auto& band    = bands_[bandIdx];
+                band.rowBegin = static_cast<uint32>(static_cast<uint64>(shape_.rows) * bandIdx / numBands);
+                band.rowEnd   = static_cast<uint32>(static_cast<uint64>(shape_.rows) * (bandIdx + 1) / numBands);
+                band.colCounts.resize(shape_.cols);
+                band.rowMask.resize(shape_.cols);
+
+                // label 0 is the background
+                band.parents.assign(1, 0);
+                band.moments.resize(1);
+            }
+        }
+
+        //=============================================================================
+        // Description:
+        /// windows and labels the rows of a band
+        ///
+        /// @param ioBand
+        /// @param inImageArray
+        /// @param inThreshold
+        ///
+        void labelBand(Band& ioBand, const NdArray<dtype>& inImageArray, dtype inThreshold)
+        {
+            for (uint32 row = ioBand.rowBegin; row < ioBand.rowEnd; ++row)
+            {
+                windowRow(ioBand, inImageArray, inThreshold, row);
+                labelRow(ioBand, inImageArray, row);
+            }
+        }
+
+        //=============================================================================
+        // Description:
+        /// adds or removes one image row from the per column exceedance counts of a band
+        ///
+        /// @param ioBand
+        /// @param inImageArray
+        /// @param inThreshold
+        /// @param inRow
+        /// @param inAdd: true to add the row, false to remove it
+        ///
+        void countRow(Band& ioBand, const NdArray<dtype>& inImageArray, dtype inThreshold, uint32 inRow, bool inAdd)
+            const noexcept
+        {
+            const dtype* const pixels    = inImageArray.data() + static_cast<std::size_t>(inRow) * shape_.cols;
+            auto&              colCounts = ioBand.colCounts;
+            for (uint32 col = 0; col < shape_.cols; ++col)
+            {
+                if (pixels[col] > inThreshold)
+                {
+                    colCounts[col] = inAdd ? colCounts[col] + 1 : colCounts[col] - 1;
+                }
+            }
+        }
+
+        //=============================================================================
+        // Description:
+        /// computes the windowed exceedance mask of a row: a pixel is an exceedance when
+        /// any pixel within the pre window border exceeds the threshold
+        ///
+        /// @param ioBand
+        /// @param inImageArray
+        /// @param inThreshold
+        /// @param inRow
+        ///
+        void windowRow(Band& ioBand, const NdArray<dtype>& inImageArray, dtype inThreshold, uint32 inRow) const noexcept
+        {
+            const uint32 border    = borderWidthPre_;
+            auto&        colCounts = ioBand.colCounts;
+
+            // slide the vertical window of rows [row - border, row + border]
+            if (inRow == ioBand.rowBegin)
+            {
+                std::fill(colCounts.begin(), colCounts.end(), 0);
+                for (uint32 row = inRow > border ? inRow - border : 0; row < std::min(inRow + border + 1, shape_.rows);
+                     ++row)
+                {
+                    countRow(ioBand, inImageArray, inThreshold, row, true);
+                }
+            }
+            else
+            {
+                if (inRow + border < shape_.rows)
+                {
+                    countRow(ioBand, inImageArray, inThreshold, inRow + border, true);
+                }
+                if (inRow > border)
+                {
+                    countRow(ioBand, inImageArray, inThreshold, inRow - border - 1, false);
+                }
+            }
+
+            // and then the horizontal window of cols [col - border, col + border]
+            uint32 windowCount = 0;
+            for (uint32 col = 0; col < std::min(border, shape_.cols); ++col)
+            {
+                windowCount += colCounts[col];
+            }
+
+            for (uint32 col = 0; col < shape_.cols; ++col)
+            {
+                if (col + border < shape_.cols)
+                {
+                    windowCount += colCounts[col + border];
+                }
+                if (col > border)
+                {
+                    windowCount -= colCounts[col - border - 1];
+                }
+
+                ioBand.rowMask[col] = windowCount > 0 ? 1 : 0;
+            }
+        }
+
+        //=============================================================================
+        // Description:
+        /// finds the root of a label, halving the path along the way
+        ///
+        /// @param ioParents: the union-find parent of each label
+        /// @param inLabel
+        /// @return root label
+        ///
+        static uint32 findRoot(std::vector<uint32>& ioParents, uint32 inLabel) noexcept
+        {
+            while (ioParents[inLabel] != inLabel)
+            {
+                ioParents[inLabel] = ioParents[ioParents[inLabel]];
+                inLabel            = ioParents[inLabel];
+            }
+
+            return inLabel;
+        }
+
+        //=============================================================================
+        // Description:
+        /// merges the label of a neighbor into the label of the current pixel, combining
+        /// the moments of the two clusters
+        ///
+        /// @param ioParents: the union-find parent of each label
+        /// @param ioMoments: the moments of each label
+        /// @param inNeighborLabel: label of the neighbor, 0 if it is not an exceedance
+        /// @param ioLabel: root label of the current pixel, 0 if not yet labeled
+        ///
+        static void mergeLabels(std::vector<uint32>&  ioParents,
+                                std::vector<Moments>& ioMoments,
+                                uint32                inNeighborLabel,
+                                uint32&               ioLabel) noexcept
+        {
+            if (inNeighborLabel == 0)
+            {
+                return;
+            }
+
+            const uint32 neighborRoot = findRoot(ioParents, inNeighborLabel);
+            if (ioLabel == 0)
+            {
+                ioLabel = neighborRoot;
+                return;
+            }
+
+            // link to the smaller root so that every cluster is rooted at its first label in raster order
+            if (neighborRoot < ioLabel)
+            {
+                ioParents[ioLabel] = neighborRoot;
+                mergeMoments(ioMoments[neighborRoot], ioMoments[ioLabel]);
+                ioLabel = neighborRoot;
+            }
+            else if (ioLabel < neighborRoot)
+            {
+                ioParents[neighborRoot] = ioLabel;
+                mergeMoments(ioMoments[ioLabel], ioMoments[neighborRoot]);
+            }
+        }
+
+        //=============================================================================
+        // Description:
+        /// labels the exceedances of a row from their left and upper neighbors within
+        /// the band
+        ///
+        /// @param ioBand
+        /// @param inImageArray
+        /// @param inRow
+        ///
+        void labelRow(Band& ioBand, const NdArray<dtype>& inImageArray, uint32 inRow)
+        {
+            const auto          offset  = static_cast<std::size_t>(inRow) * shape_.cols;
+            const dtype* const  pixels  = inImageArray.data() + offset;
+            uint32* const       labels  = labels_.data() + offset;
+            const uint32* const above   = inRow > ioBand.rowBegin ? labels - shape_.cols : nullptr;
+            auto&               parents = ioBand.parents;
+            auto&               moments = ioBand.moments;
+
+            for (uint32 col = 0; col < shape_.cols; ++col)
+            {
+                if (ioBand.rowMask[col] == 0)
+                {
+                    labels[col] = 0;
+                    continue;
+                }
+
+                uint32 label = 0;
+                if (col > 0)
+                {
+                    mergeLabels(parents, moments, labels[col - 1], label);
+                }
+
+                if (above != nullptr)
+                {
+                    if (col > 0)
+                    {
+                        mergeLabels(parents, moments, above[col - 1], label);
+                    }
+                    mergeLabels(parents, moments, above[col], label);
+                    if (col + 1 < shape_.cols)
+                    {
+                        mergeLabels(parents, moments, above[col + 1], label);
+                    }
+                }
+
+                if (label == 0)
+                {
+                    label = static_cast<uint32>(parents.size());
+                    parents.push_back(label);
+
+                    Moments newMoments;
+                    newMoments.originRow = inRow;
+                    newMoments.originCol = col;
+                    newMoments.rowMin    = inRow;
+                    newMoments.rowMax    = inRow;
+                    newMoments.colMin    = col;
+                    newMoments.colMax    = col;
+                    moments.push_back(newMoments);
+                }
+
+                labels[col] = label;
+                addPixel(moments[label], inRow, col, pixels[col]);
+            }
+        }
+
+        //=============================================================================
+        // Description:
+        /// gathers the labels of all bands into one numbering, in band order so that
+        /// labels stay in raster order, and merges the clusters that touch across the
+        /// seams between bands
+        ///
+        void stitchBands()
+        {
+            parents_.assign(1, 0);
+            moments_.resize(1);
+            for (auto& band : bands_)
+            {
+                band.labelOffset = static_cast<uint32>(parents_.size()) - 1;
+                for (uint32 label = 1; label < static_cast<uint32>(band.parents.size()); ++label)
+                {
+                    parents_.push_back(band.parents[label] + band.labelOffset);
+                    moments_.push_back(band.moments[label]);
+                }
+            }
+
+            for (uint32 bandIdx = 1; bandIdx < static_cast<uint32>(bands_.size()); ++bandIdx)
+            {
+                const auto&         band        = bands_[bandIdx];
+                const uint32        aboveOffset = bands_[bandIdx - 1].labelOffset;
+                const auto          offset      = static_cast<std::size_t>(band.rowBegin) * shape_.cols;
+                const uint32* const labels      = labels_.data() + offset;
+                const uint32* const above       = labels - shape_.cols;
+
+                for (uint32 col = 0; col < shape_.cols; ++col)
+                {
+                    if (labels[col] == 0)
+                    {
+                        continue;
+                    }
+
+                    uint32       label    = findRoot(parents_, labels[col] + band.labelOffset);
+                    const uint32 colBegin = col > 0 ? col - 1 : 0;
+                    const uint32 colEnd   = std::min(col + 2, shape_.cols);
+                    for (uint32 aboveCol = colBegin; aboveCol < colEnd; ++aboveCol)
+                    {
+                        if (above[aboveCol] != 0)
+                        {
+                            mergeLabels(parents_, moments_, above[aboveCol] + aboveOffset, label);
+                        }
+                    }
+                }
+            }
+        }
+
+        //=============================================================================
+        // Description:
+        /// adds a pixel to the moments of a cluster
+        ///
+        /// @param ioMoments
+        /// @param inRow
+        /// @param inCol
+        /// @param inIntensity
+        ///
+        static void addPixel(Moments& ioMoments, uint32 inRow, uint32 inCol, dtype inIntensity) noexcept
+        {
+            const double deltaRow = static_cast<double>(inRow) - static_cast<double>(ioMoments.originRow);
+            const double deltaCol = static_cast<double>(inCol) - static_cast<double>(ioMoments.originCol);
+            const auto   value    = static_cast<double>(inIntensity);
+
+            ioMoments.numPixels += 1.;
+            ioMoments.intensity += static_cast<accumulator_t>(inIntensity);
+            ioMoments.peakPixelIntensity = std::max(ioMoments.peakPixelIntensity, inIntensity);
+
+            ioMoments.weight += value;
+            ioMoments.weightedRow += value * deltaRow;
+            ioMoments.weightedCol += value * deltaCol;
+
+            ioMoments.sumRow += deltaRow;
+            ioMoments.sumCol += deltaCol;
+            ioMoments.sumRowSqr += deltaRow * deltaRow;
+            ioMoments.sumColSqr += deltaCol * deltaCol;
+            ioMoments.sumRowCol += deltaRow * deltaCol;
+
+            ioMoments.rowMin = std::min(ioMoments.rowMin, inRow);
+            ioMoments.rowMax = std::max(ioMoments.rowMax, inRow);
+            ioMoments.colMin = std::min(ioMoments.colMin, inCol);
+            ioMoments.colMax = std::max(ioMoments.colMax, inCol);
+        }
+
+        //=============================================================================
+        // Description:
+        /// merges the moments of one cluster into another, shifting them to its origin
+        ///
+        /// @param ioMoments
+        /// @param inOther
+        ///
+        static void mergeMoments(Moments& ioMoments, const Moments& inOther) noexcept
+        {
+            const double shiftRow = static_cast<double>(inOther.originRow) - static_cast<double>(ioMoments.originRow);
+            const double shiftCol = static_cast<double>(inOther.originCol) - static_cast<double>(ioMoments.originCol);
+            const double count    = inOther.numPixels;
+
+            ioMoments.numPixels += count;
+            ioMoments.intensity += inOther.intensity;
+            ioMoments.peakPixelIntensity = std::max(ioMoments.peakPixelIntensity, inOther.peakPixelIntensity);
+
+            ioMoments.weight += inOther.weight;
+            ioMoments.weightedRow += inOther.weightedRow + shiftRow * inOther.weight;
+            ioMoments.weightedCol += inOther.weightedCol + shiftCol * inOther.weight;
+
+            ioMoments.sumRowSqr += inOther.sumRowSqr + 2. * shiftRow * inOther.sumRow + count * shiftRow * shiftRow;
+            ioMoments.sumColSqr += inOther.sumColSqr + 2. * shiftCol * inOther.sumCol + count * shiftCol * shiftCol;
+            ioMoments.sumRowCol += inOther.sumRowCol + shiftRow * inOther.sumCol + shiftCol * inOther.sumRow +
+                                   count * shiftRow * shiftCol;
+            ioMoments.sumRow += inOther.sumRow + count * shiftRow;
+            ioMoments.sumCol += inOther.sumCol + count * shiftCol;
+
+            ioMoments.rowMin = std::min(ioMoments.rowMin, inOther.rowMin);
+            ioMoments.rowMax = std::max(ioMoments.rowMax, inOther.rowMax);
+            ioMoments.colMin = std::min(ioMoments.colMin, inOther.colMin);
+            ioMoments.colMax = std::max(ioMoments.colMax, inOther.colMax);
+        }
+
+        //=============================================================================
+        // Description:
+        /// adds the post window border of non exceedance pixels to each cluster, one
+        /// 3x3 ring at a time, as ClusterMaker does
+        ///
+        /// @param inImageArray
+        ///
+        void expandClusters(const NdArray<dtype>& inImageArray)
+        {
+            // point every label straight at its root (roots are always the smaller label) so
+            // that the label image can be resolved and the clusters expanded across threads
+            roots_.clear();
+            for (uint32 label = 1; label < static_cast<uint32>(parents_.size()); ++label)
+            {
+                parents_[label] = parents_[parents_[label]];
+                if (parents_[label] == label)
+                {
+                    roots_.push_back(label);
+                }
+            }
+
+            parallel::parallelFor(static_cast<uint32>(bands_.size()),
+                                  [this](uint32 bandIdx)
+                                  {
+                                      const auto& band  = bands_[bandIdx];
+                                      const auto  begin = static_cast<std::size_t>(band.rowBegin) * shape_.cols;
+                                      const auto  end   = static_cast<std::size_t>(band.rowEnd) * shape_.cols;
+                                      for (auto idx = begin; idx < end; ++idx)
+                                      {
+                                          const uint32 label = labels_[idx];
+                                          labels_[idx]       = label == 0 ? 0 : parents_[label + band.labelOffset];
+                                      }
+                                  });
+
+            parallel::parallelFor(static_cast<uint32>(roots_.size()),
+                                  [this, &inImageArray](uint32 rootIdx)
+                                  { expandCluster(roots_[rootIdx], inImageArray); });
+        }
+
+        //=============================================================================
+        // Description:
+        /// adds the post window border of non exceedance pixels to one cluster
+        ///
+        /// @param inLabel: the cluster's root label
+        /// @param inImageArray
+        ///
+        void expandCluster(uint32 inLabel, const NdArray<dtype>& inImageArray)
+        {
+            const uint32 border   = borderWidthPost_;
+            Moments&     moments  = moments_[inLabel];
+            const uint32 rowBegin = moments.rowMin > border ? moments.rowMin - border : 0;
+            const uint32 rowEnd   = std::min(moments.rowMax + border + 1, shape_.rows);
+            const uint32 colBegin = moments.colMin > border ? moments.colMin - border : 0;
+            const uint32 colEnd   = std::min(moments.colMax + border + 1, shape_.cols);
+            const uint32 numRows  = rowEnd - rowBegin;
+            const uint32 numCols  = colEnd - colBegin;
+
+            // level 1 marks the cluster's pixels and level k + 1 the pixels of the k-th ring
+            thread_local std::vector<uint16> levels;
+            levels.assign(static_cast<std::size_t>(numRows) * numCols, 0);
+            for (uint32 row = rowBegin; row < rowEnd; ++row)
+            {
+                for (uint32 col = colBegin; col < colEnd; ++col)
+                {
+                    if (labels_[static_cast<std::size_t>(row) * shape_.cols + col] == inLabel)
+                    {
+                        levels[(row - rowBegin) * numCols + col - colBegin] = 1;
+                    }
+                }
+            }
+
+            for (uint32 ring = 1; ring <= border; ++ring)
+            {
+                for (uint32 row = rowBegin; row < rowEnd; ++row)
+                {
+                    for (uint32 col = colBegin; col < colEnd; ++col)
+                    {
+                        const uint32 idx = (row - rowBegin) * numCols + col - colBegin;
+                        if (levels[idx] != 0 || labels_[static_cast<std::size_t>(row) * shape_.cols + col] != 0 ||
+                            !touchesLevel(levels, row - rowBegin, col - colBegin, numRows, numCols, ring))
+                        {
+                            continue;
+                        }
+
+                        levels[idx] = static_cast<uint16>(ring + 1);
+                        addPixel(moments, row, col, inImageArray(row, col));
+                    }
+                }
+            }
+        }
+
+        //=============================================================================
+        // Description:
+        /// returns whether any 8 neighbor of a pixel of the expansion box is at a level
+        ///
+        /// @param inLevels: the levels of the expansion box
+        /// @param inRow: row within the box
+        /// @param inCol: col within the box
+        /// @param inNumRows: box rows
+        /// @param inNumCols: box cols
+        /// @param inLevel
+        /// @return bool
+        ///
+        static bool touchesLevel(const std::vector<uint16>& inLevels,
+                                 uint32                     inRow,
+                                 uint32                     inCol,
+                                 uint32                     inNumRows,
+                                 uint32                     inNumCols,
+                                 uint32                     inLevel) noexcept
+        {
+            const uint32 rowBegin = inRow > 0 ? inRow - 1 : 0;
+            const uint32 rowEnd   = std::min(inRow + 2, inNumRows);
+            const uint32 colBegin = inCol > 0 ? inCol - 1 : 0;
+            const uint32 colEnd   = std::min(inCol + 2, inNumCols);
+
+            for (uint32 row = rowBegin; row < rowEnd; ++row)
+            {
+                for (uint32 col = colBegin; col < colEnd; ++col)
+                {
+                    if (inLevels[row * inNumCols + col] == inLevel)
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        //=============================================================================
+        // Description:
+        /// converts the moments of each cluster into a centroid, in order of the
+        /// cluster's first pixel
+        ///
+        void makeCentroids()
+        {
+            centroids_.clear();
+            for (uint32 label = 1; label < static_cast<uint32>(parents_.size()); ++label)
+            {
+                if (parents_[label] != label)
+                {
+                    continue;
+                }
+
+                const Moments& moments = moments_[label];
+                const double   count   = moments.numPixels;
+                const double   row     = moments.weightedRow / moments.weight;
+                const double   col     = moments.weightedCol / moments.weight;
+
+                // second moments of the pixel positions about the center of mass
+                const double m20 = moments.sumColSqr / count - 2. * col * moments.sumCol / count + col * col;
+                const double m02 = moments.sumRowSqr / count - 2. * row * moments.sumRow / count + row * row;
+                const double m11 =
+                    (moments.sumRowCol - row * moments.sumCol - col * moments.sumRow) / count + row * col;
+
+                const double eod =
+                    static_cast<double>(moments.peakPixelIntensity) / static_cast<double>(moments.intensity);
+
+                centroids_.emplace_back(static_cast<double>(moments.originRow) + row,
+                                        static_cast<double>(moments.originCol) + col,
+                                        moments.intensity,
+                                        eod,
+                                        m20,
+                                        m02,
+                                        m11);
+            }
+        }
+    };
+} // namespace nc::imageProcessing
@@ -30,7 +30,6 @@
 
 #include <algorithm>
 #include <cmath>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -91,11 +90,7 @@ namespace nc::imageProcessing
             }
 
             runClusterMaker();
-
-            for (uint8 i = 0; i < inBorderWidth; ++i)
-            {
-                expandClusters();
-            }
+            expandClusters(inBorderWidth);
         }
 
         //=============================================================================
@@ -161,6 +156,18 @@ namespace nc::imageProcessing
             return clusters_.cend();
         }
 
+        //=============================================================================
+        // Description:
+        /// returns the label image: the cluster id of each exceedance pixel and -1
+        /// everywhere else. Border pixels added post clustering are not labeled.
+        ///
+        /// @return NdArray<int32>
+        ///
+        [[nodiscard]] const NdArray<int32>& labelImage() const noexcept
+        {
+            return labelImage_;
+        }
+
     private:
         //==================================Attributes=================================
         const NdArray<bool>* const  xcds_{};
@@ -170,192 +177,180 @@ namespace nc::imageProcessing
         Shape shape_{};
 
         std::vector<Cluster<dtype>> clusters_{};
+        NdArray<int32>              labelImage_{};
 
         //=============================================================================
         // Description:
-        /// checks that the input row and column have not fallen off of the edge
+        /// finds the root of a provisional label, halving the path along the way
         ///
-        /// @param inRow
-        /// @param inCol
+        /// @param inLabel
+        /// @param ioParents: the union-find parent of each provisional label
         ///
-        /// @return returns a pixel object clipped to the image boundaries
+        /// @return root label
         ///
-        Pixel<dtype> makePixel(int32 inRow, int32 inCol) noexcept
+        static uint32 findRoot(uint32 inLabel, std::vector<uint32>& ioParents) noexcept
         {
-            // Make sure that on the edges after i've added or subtracted 1 from the row and col that
-            // i haven't gone over the edge
-            const uint32 row       = std::min(static_cast<uint32>(std::max<int32>(inRow, 0)), shape_.rows - 1);
-            const uint32 col       = std::min(static_cast<uint32>(std::max<int32>(inCol, 0)), shape_.cols - 1);
-            const dtype  intensity = intensities_->operator()(row, col);
+            while (ioParents[inLabel] != inLabel)
+            {
+                ioParents[inLabel] = ioParents[ioParents[inLabel]];
+                inLabel            = ioParents[inLabel];
+            }
 
-            return Pixel<dtype>(row, col, intensity);
+            return inLabel;
         }
 
         //=============================================================================
         // Description:
-        /// finds all of the neighboring pixels to the input pixel
+        /// merges the label of an already visited neighbor into the label of the current pixel
         ///
-        /// @param inPixel
-        /// @param outNeighbors
-        /// @return None
+        /// @param inNeighborLabel: label of the neighbor, -1 if it is not an exceedance
+        /// @param ioLabel: root label of the current pixel, -1 if not yet labeled
+        /// @param ioParents: the union-find parent of each provisional label
         ///
-        void findNeighbors(const Pixel<dtype>& inPixel, std::set<Pixel<dtype>>& outNeighbors)
+        static void mergeLabels(int32 inNeighborLabel, int32& ioLabel, std::vector<uint32>& ioParents) noexcept
         {
-            // using a set will auto take care of adding duplicate pixels on the edges
-
-            // the 8 surrounding neighbors
-            const auto row = static_cast<int32>(inPixel.row);
-            const auto col = static_cast<int32>(inPixel.col);
-
-            outNeighbors.insert(outNeighbors.end(), makePixel(row - 1, col - 1));
-            outNeighbors.insert(outNeighbors.end(), makePixel(row - 1, col));
-            outNeighbors.insert(outNeighbors.end(), makePixel(row - 1, col + 1));
-            outNeighbors.insert(outNeighbors.end(), makePixel(row, col - 1));
-            outNeighbors.insert(outNeighbors.end(), makePixel(row, col + 1));
-            outNeighbors.insert(outNeighbors.end(), makePixel(row + 1, col - 1));
-            outNeighbors.insert(outNeighbors.end(), makePixel(row + 1, col));
-            outNeighbors.insert(outNeighbors.end(), makePixel(row + 1, col + 1));
-        }
-
-        //=============================================================================
-        // Description:
-        /// finds all of the neighboring pixels to the input pixel that are NOT exceedances
-        ///
-        /// @param inPixel
-        /// @param outNeighbors
-        ///
-        /// @return vector of non exceedance neighboring pixels
-        ///
-        void findNeighborNotXcds(const Pixel<dtype>& inPixel, std::vector<Pixel<dtype>>& outNeighbors)
-        {
-            std::set<Pixel<dtype>> neighbors;
-            findNeighbors(inPixel, neighbors);
-
-            // check if the neighboring pixels are exceedances and insert into the xcd vector
-            for (auto& pixel : neighbors)
+            if (inNeighborLabel < 0)
             {
-                if (!xcds_->operator()(pixel.row, pixel.col))
-                {
-                    outNeighbors.push_back(pixel);
-                }
+                return;
             }
-        }
-
-        //=============================================================================
-        // Description:
-        /// finds the pixel index of neighboring pixels
-        ///
-        /// @param inPixel
-        /// @param outNeighbors
-        ///
-        /// @return vector of neighboring pixel indices
-        ///
-        void findNeighborXcds(const Pixel<dtype>& inPixel, std::vector<uint32>& outNeighbors)
-        {
-            std::set<Pixel<dtype>> neighbors;
-            findNeighbors(inPixel, neighbors);
-            std::vector<Pixel<dtype>> neighborXcds;
 
-            // check if the neighboring pixels are exceedances and insert into the xcd vector
-            for (auto& pixel : neighbors)
+            const auto neighborRoot = findRoot(static_cast<uint32>(inNeighborLabel), ioParents);
+            if (ioLabel < 0)
             {
-                if (xcds_->operator()(pixel.row, pixel.col))
-                {
-                    neighborXcds.push_back(pixel);
-                }
+                ioLabel = static_cast<int32>(neighborRoot);
+                return;
             }
 
-            // loop through the neighbors and find the cooresponding index into exceedances_
-            for (auto& pixel : neighborXcds)
+            // link to the smaller root so that every set is rooted at its first label in raster order
+            const auto root = static_cast<uint32>(ioLabel);
+            if (neighborRoot < root)
             {
-                auto theExceedanceIter = std::find(xcdsVec_.begin(), xcdsVec_.end(), pixel);
-                outNeighbors.push_back(static_cast<uint32>(theExceedanceIter - xcdsVec_.begin()));
+                ioParents[root] = neighborRoot;
+                ioLabel         = static_cast<int32>(neighborRoot);
+            }
+            else if (root < neighborRoot)
+            {
+                ioParents[neighborRoot] = root;
             }
         }
 
         //=============================================================================
         // Description:
-        /// workhorse method that performs the clustering algorithm
+        /// workhorse method that performs the clustering algorithm. Two pass union-find
+        /// labeling of the 8 connected exceedances: the first pass assigns provisional
+        /// labels from the already visited neighbors, the second resolves them to cluster
+        /// ids numbered in raster order of each cluster's first pixel.
         ///
         void runClusterMaker()
         {
-            uint32 clusterId = 0;
+            labelImage_ = NdArray<int32>(shape_);
+            labelImage_.fill(-1);
+
+            const auto   numCols = shape_.cols;
+            int32* const labels  = labelImage_.data();
 
-            for (auto& currentPixel : xcdsVec_)
+            std::vector<uint32> parents;
+            for (const auto& pixel : xcdsVec_)
             {
-                // not already visited
-                if (currentPixel.clusterId == -1)
+                const uint32 idx   = pixel.row * numCols + pixel.col;
+                int32        label = -1;
+
+                if (pixel.col > 0)
                 {
-                    Cluster<dtype> newCluster(clusterId); // a new cluster
-                    currentPixel.clusterId = clusterId;
-                    newCluster.addPixel(currentPixel); // assign pixel to cluster
-
-                    // get the neighbors
-                    std::vector<uint32> neighborIds;
-                    findNeighborXcds(currentPixel, neighborIds);
-                    if (neighborIds.empty())
+                    mergeLabels(labels[idx - 1], label, parents);
+                }
+
+                if (pixel.row > 0)
+                {
+                    const uint32 above = idx - numCols;
+                    if (pixel.col > 0)
                     {
-                        clusters_.push_back(newCluster);
-                        ++clusterId;
-                        continue;
+                        mergeLabels(labels[above - 1], label, parents);
                     }
-
-                    // loop through the neighbors
-                    for (uint32 neighborsIdx = 0; neighborsIdx < neighborIds.size(); ++neighborsIdx)
+                    mergeLabels(labels[above], label, parents);
+                    if (pixel.col + 1 < numCols)
                     {
-                        Pixel<dtype>& currentNeighborPixel = xcdsVec_[neighborIds[neighborsIdx]];
-
-                        // go to neighbors
-                        std::vector<uint32> newNeighborIds;
-                        findNeighborXcds(currentNeighborPixel, newNeighborIds);
+                        mergeLabels(labels[above + 1], label, parents);
+                    }
+                }
 
-                        // loop through the new neighbors and add them to neighbors
-                        for (auto newNeighborId : newNeighborIds)
-                        {
-                            // not already in neighbors
-                            if (std::find(neighborIds.begin(), neighborIds.end(), newNeighborId) == neighborIds.end())
-                            {
-                                neighborIds.push_back(newNeighborId);
-                            }
-                        }
+                if (label < 0)
+                {
+                    label = static_cast<int32>(parents.size());
+                    parents.push_back(static_cast<uint32>(label));
+                }
 
-                        // not already assigned to a cluster
-                        if (currentNeighborPixel.clusterId == -1)
-                        {
-                            currentNeighborPixel.clusterId = clusterId;
-                            newCluster.addPixel(currentNeighborPixel);
-                        }
-                    }
+                labels[idx] = label;
+            }
 
-                    clusters_.push_back(std::move(newCluster));
-                    ++clusterId;
+            std::vector<int32> clusterIds(parents.size(), -1);
+            for (auto& pixel : xcdsVec_)
+            {
+                const uint32 idx  = pixel.row * numCols + pixel.col;
+                const auto   root = findRoot(static_cast<uint32>(labels[idx]), parents);
+                if (clusterIds[root] < 0)
+                {
+                    clusterIds[root] = static_cast<int32>(clusters_.size());
+                    clusters_.emplace_back(static_cast<uint32>(clusterIds[root]));
                 }
+
+                labels[idx]     = clusterIds[root];
+                pixel.clusterId = clusterIds[root];
+                clusters_[static_cast<uint32>(pixel.clusterId)].addPixel(pixel);
             }
         }
 
         //=============================================================================
         // Description:
-        /// 3x3 dialates the clusters
+        /// 3x3 dialates the clusters inBorderWidth times with non exceedance pixels
+        ///
+        /// @param inBorderWidth
         ///
-        void expandClusters()
+        void expandClusters(uint8 inBorderWidth)
         {
-            // loop through the clusters
+            if (inBorderWidth == 0)
+            {
+                return;
+            }
+
+            const auto numCols = shape_.cols;
+
+            // marks the pixels already added to the cluster being expanded
+            std::vector<uint32> stamps(shape_.size(), 0);
             for (auto& theCluster : clusters_)
             {
-                // loop through the pixels of the cluster
-                for (auto& thePixel : theCluster)
+                const uint32 stamp     = theCluster.clusterId() + 1;
+                uint32       ringBegin = 0;
+                for (uint8 ring = 0; ring < inBorderWidth; ++ring)
                 {
-                    std::vector<Pixel<dtype>> neighborsNotXcds;
-                    findNeighborNotXcds(thePixel, neighborsNotXcds);
-
-                    // loop through the neighbors and if they haven't already been added to the cluster, add them
-                    for (auto& newPixel : neighborsNotXcds)
+                    // only the pixels added by the previous ring can have new neighbors
+                    const uint32 ringEnd = theCluster.size();
+                    for (uint32 pixelIdx = ringBegin; pixelIdx < ringEnd; ++pixelIdx)
                     {
-                        if (std::find(theCluster.begin(), theCluster.end(), newPixel) == theCluster.end())
+                        // copied as adding pixels may reallocate the cluster
+                        const Pixel<dtype> thePixel = theCluster[pixelIdx];
+                        const uint32       rowBegin = thePixel.row > 0 ? thePixel.row - 1 : 0;
+                        const uint32       rowEnd   = std::min(thePixel.row + 2, shape_.rows);
+                        const uint32       colBegin = thePixel.col > 0 ? thePixel.col - 1 : 0;
+                        const uint32       colEnd   = std::min(thePixel.col + 2, numCols);
+
+                        for (uint32 row = rowBegin; row < rowEnd; ++row)
                         {
-                            theCluster.addPixel(newPixel);
+                            for (uint32 col = colBegin; col < colEnd; ++col)
+                            {
+                                const uint32 idx = row * numCols + col;
+                                if (xcds_->operator[](idx) || stamps[idx] == stamp)
+                                {
+                                    continue;
+                                }
+
+                                stamps[idx] = stamp;
+                                theCluster.addPixel(Pixel<dtype>(row, col, intensities_->operator[](idx)));
+                            }
                         }
                     }
+
+                    ringBegin = ringEnd;
                 }
             }
         }
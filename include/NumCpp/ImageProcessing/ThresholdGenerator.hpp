@@ -0,0 +1,197 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Rolling histogram exceedance threshold generator
+///
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/ImageProcessing/generateThreshold.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::imageProcessing
+{
+    //=============================================================================
+    // Class Description:
+    /// Generates exceedance thresholds, as generateThreshold does, from the histogram of
+    /// the last N frames of a stream of 8 or 16 bit integer frames. Each frame is counted
+    /// once into a histogram with one bin per representable value, and the histogram of
+    /// the frame that drops out of the window is subtracted, so the cost per frame does
+    /// not grow with the window length.
+    template<typename dtype>
+    class ThresholdGenerator
+    {
+    private:
+        static_assert(detail::is_small_integer_v<dtype>, "ThresholdGenerator only supports 8 and 16 bit integers.");
+
+    public:
+        //=============================================================================
+        // Description:
+        /// constructor
+        ///
+        /// @param inWindowLength: the number of consecutive frames in the histogram (default 1)
+        ///
+        explicit ThresholdGenerator(uint32 inWindowLength = 1) :
+            frames_(inWindowLength)
+        {
+            if (inWindowLength == 0)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("window length must be greater than 0.");
+            }
+        }
+
+        //=============================================================================
+        // Description:
+        /// adds a frame to the histogram, dropping the oldest frame once the window is full
+        ///
+        /// @param inImageArray
+        ///
+        void addFrame(const NdArray<dtype>& inImageArray)
+        {
+            detail::countValues(inImageArray, frameCounts_);
+            if (counts_.empty())
+            {
+                counts_.assign(frameCounts_.size(), 0);
+            }
+
+            auto& frame = frames_[nextFrame_];
+            if (numFrames_ == frames_.size())
+            {
+                for (const auto& [bin, count] : frame.bins)
+                {
+                    counts_[bin] -= count;
+                }
+                numPixels_ -= frame.numPixels;
+            }
+            else
+            {
+                ++numFrames_;
+            }
+
+            // keep only the occupied bins of the frame to subtract later
+            frame.bins.clear();
+            for (uint32 bin = 0; bin < static_cast<uint32>(frameCounts_.size()); ++bin)
+            {
+                if (frameCounts_[bin] > 0)
+                {
+                    counts_[bin] += frameCounts_[bin];
+                    frame.bins.emplace_back(bin, frameCounts_[bin]);
+                }
+            }
+            frame.numPixels = inImageArray.size();
+            numPixels_ += frame.numPixels;
+
+            nextFrame_ = (nextFrame_ + 1) % static_cast<uint32>(frames_.size());
+        }
+
+        //=============================================================================
+        // Description:
+        /// returns the threshold such that the input rate of the pixels in the window
+        /// exceeds it
+        ///
+        /// @param inRate
+        /// @return dtype
+        ///
+        [[nodiscard]] dtype threshold(double inRate) const
+        {
+            if (inRate < 0. || inRate > 1.)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input rate must be of the range [0, 1]");
+            }
+
+            if (numPixels_ == 0)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("no pixels have been added.");
+            }
+
+            return detail::thresholdFromValueCounts<dtype>(counts_, numPixels_, inRate);
+        }
+
+        //=============================================================================
+        // Description:
+        /// adds a frame and returns the threshold of the updated window
+        ///
+        /// @param inImageArray
+        /// @param inRate
+        /// @return dtype
+        ///
+        dtype update(const NdArray<dtype>& inImageArray, double inRate)
+        {
+            addFrame(inImageArray);
+            return threshold(inRate);
+        }
+
+        //=============================================================================
+        // Description:
+        /// returns the number of frames currently in the window
+        ///
+        /// @return number of frames
+        ///
+        [[nodiscard]] uint32 numFrames() const noexcept
+        {
+            return numFrames_;
+        }
+
+        //=============================================================================
+        // Description:
+        /// removes all frames from the window
+        ///
+        void clear() noexcept
+        {
+            std::fill(counts_.begin(), counts_.end(), 0);
+            for (auto& frame : frames_)
+            {
+                frame.bins.clear();
+                frame.numPixels = 0;
+            }
+            numFrames_ = 0;
+            nextFrame_ = 0;
+            numPixels_ = 0;
+        }
+
+    private:
+        //=============================================================================
+        // Class Description:
+        /// the occupied bins of one frame of the window
+        struct Frame
+        {
+            std::vector<std::pair<uint32, uint64>> bins{};
+            uint64                                 numPixels{ 0 };
+        };
+
+        //==================================Attributes=================================
+        std::vector<Frame>  frames_{};
+        std::vector<uint64> counts_{};
+        std::vector<uint64> frameCounts_{};
+        uint32              numFrames_{ 0 };
+        uint32              nextFrame_{ 0 };
+        uint64              numPixels_{ 0 };
+    };
+} // namespace nc::imageProcessing
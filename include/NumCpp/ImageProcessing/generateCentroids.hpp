@@ -31,14 +31,11 @@
 #include <string>
 #include <vector>
 
-#include "NumCpp/Core/Internal/Error.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
 #include "NumCpp/Core/Types.hpp"
-#include "NumCpp/ImageProcessing/applyThreshold.hpp"
-#include "NumCpp/ImageProcessing/centroidClusters.hpp"
-#include "NumCpp/ImageProcessing/clusterPixels.hpp"
+#include "NumCpp/ImageProcessing/Centroid.hpp"
+#include "NumCpp/ImageProcessing/CentroidDetector.hpp"
 #include "NumCpp/ImageProcessing/generateThreshold.hpp"
-#include "NumCpp/ImageProcessing/windowExceedances.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::imageProcessing
@@ -62,37 +59,12 @@ namespace nc::imageProcessing
     {
         STATIC_ASSERT_ARITHMETIC(dtype);
 
-        uint8 borderWidthPre  = 0;
-        uint8 borderWidthPost = 0;
-        if (inWindowType == "pre")
-        {
-            borderWidthPre = inBorderWidth;
-        }
-        else if (inWindowType == "post")
-        {
-            borderWidthPost = inBorderWidth;
-        }
-        else
-        {
-            THROW_INVALID_ARGUMENT_ERROR("input window type options are ['pre', 'post']");
-        }
+        CentroidDetector<dtype> detector(inWindowType, inBorderWidth);
 
         // generate the threshold
         dtype threshold = generateThreshold(inImageArray, inRate);
 
-        // apply the threshold to get xcds
-        NdArray<bool> xcds = applyThreshold(inImageArray, threshold);
-
-        // window around the xcds
-        if (borderWidthPre > 0)
-        {
-            xcds = windowExceedances(xcds, borderWidthPre);
-        }
-
-        // cluster the exceedances
-        std::vector<Cluster<dtype>> clusters = clusterPixels(inImageArray, xcds, borderWidthPost);
-
-        // centroid the clusters
-        return centroidClusters(clusters);
+        // threshold, window, cluster and centroid in one pass
+        return detector.detect(inImageArray, threshold);
     }
 } // namespace nc::imageProcessing
@@ -28,24 +28,225 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 #include "NumCpp/Core/DtypeInfo.hpp"
 #include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/ParallelFor.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Internal/StlAlgorithms.hpp"
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/NdArray.hpp"
 #include "NumCpp/Utils/essentiallyEqual.hpp"
 
 namespace nc::imageProcessing
 {
+    namespace detail
+    {
+        /// 8 and 16 bit integers are histogrammed with one bin per representable value
+        template<typename dtype>
+        constexpr bool is_small_integer_v =
+            std::is_integral_v<dtype> && !std::is_same_v<dtype, bool> && sizeof(dtype) <= sizeof(uint16);
+
+        /// chunks of an image are not split below this many pixels
+        constexpr uint32 MIN_HISTOGRAM_CHUNK = 1 << 18;
+
+        //============================================================================
+        // Method Description:
+        /// Counts the values of an 8 or 16 bit integer array into one bin per
+        /// representable value, bin 0 holding the lowest value. Chunks of the array are
+        /// counted into their own histograms across threads when NUMCPP_USE_MULTITHREAD
+        /// is defined.
+        ///
+        /// @param inImageArray
+        /// @param outCounts: resized and overwritten
+        ///
+        template<typename dtype>
+        void countValues(const NdArray<dtype>& inImageArray, std::vector<uint64>& outCounts)
+        {
+            static_assert(is_small_integer_v<dtype>, "countValues only supports 8 and 16 bit integers.");
+
+            constexpr auto   lowest  = static_cast<int32>(std::numeric_limits<dtype>::lowest());
+            constexpr uint32 numBins = static_cast<uint32>(std::numeric_limits<dtype>::max() - lowest + 1);
+
+            const dtype* const data      = inImageArray.data();
+            const uint32       numPixels = inImageArray.size();
+
+            uint32 numChunks = 1;
+#ifdef PARALLEL_ALGORITHMS_SUPPORTED
+            numChunks = std::max(std::min(std::thread::hardware_concurrency(), numPixels / MIN_HISTOGRAM_CHUNK), 1U);
+#endif
+            if (numChunks == 1)
+            {
+                outCounts.assign(numBins, 0);
+                for (uint32 i = 0; i < numPixels; ++i)
+                {
+                    ++outCounts[static_cast<uint32>(static_cast<int32>(data[i]) - lowest)];
+                }
+
+                return;
+            }
+
+            std::vector<std::vector<uint64>> chunkCounts(numChunks, std::vector<uint64>(numBins, 0));
+            parallel::parallelFor(numChunks,
+                                  [&](uint32 chunk)
+                                  {
+                                      const auto begin  = static_cast<uint64>(numPixels) * chunk / numChunks;
+                                      const auto end    = static_cast<uint64>(numPixels) * (chunk + 1) / numChunks;
+                                      auto&      counts = chunkCounts[chunk];
+                                      for (auto i = begin; i < end; ++i)
+                                      {
+                                          ++counts[static_cast<uint32>(static_cast<int32>(data[i]) - lowest)];
+                                      }
+                                  });
+
+            outCounts.assign(numBins, 0);
+            for (const auto& counts : chunkCounts)
+            {
+                for (uint32 bin = 0; bin < numBins; ++bin)
+                {
+                    outCounts[bin] += counts[bin];
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Calculates the threshold such that the input rate of pixels exceeds it from
+        /// a histogram with one bin per integer value in [inMinValue, inMaxValue]
+        ///
+        /// @param inCounts: the histogram, inCounts[0] holding inMinValue
+        /// @param inMinValue
+        /// @param inMaxValue
+        /// @param inNumPixels: the number of pixels counted
+        /// @param inRate
+        /// @return dtype
+        ///
+        template<typename dtype>
+        dtype thresholdFromHistogram(const uint64* inCounts,
+                                     int32         inMinValue,
+                                     int32         inMaxValue,
+                                     uint64        inNumPixels,
+                                     double        inRate)
+        {
+            if (utils::essentiallyEqual(inRate, 0.))
+            {
+                return static_cast<dtype>(inMaxValue);
+            }
+
+            if (utils::essentiallyEqual(inRate, 1.))
+            {
+                if (DtypeInfo<dtype>::isSigned())
+                {
+                    return static_cast<dtype>(inMinValue - 1);
+                }
+
+                return dtype{ 0 };
+            }
+
+            const auto histSize = static_cast<uint32>(inMaxValue - inMinValue + 1);
+
+            // integrate the normalized histogram from right to left to make a survival function (1 - CDF)
+            const auto                       dNumPixels = static_cast<double>(inNumPixels);
+            thread_local std::vector<double> survivalFunction;
+            survivalFunction.resize(histSize + 1);
+            survivalFunction[histSize] = 0.;
+            for (int32 i = histSize - 1; i > -1; --i)
+            {
+                double histValue    = static_cast<double>(inCounts[i]) / dNumPixels;
+                survivalFunction[i] = survivalFunction[i + 1] + histValue;
+            }
+
+            // binary search through the survival function to find the rate
+            uint32 indexLow  = 0;
+            uint32 indexHigh = histSize - 1;
+            uint32 index     = indexHigh / 2; // integer division
+
+            constexpr bool keepGoing = true;
+            while (keepGoing)
+            {
+                const double value = survivalFunction[index];
+                if (value < inRate)
+                {
+                    indexHigh = index;
+                }
+                else if (value > inRate)
+                {
+                    indexLow = index;
+                }
+                else
+                {
+                    const int32 thresh = static_cast<int32>(index) + inMinValue - 1;
+                    if (DtypeInfo<dtype>::isSigned())
+                    {
+                        return static_cast<dtype>(thresh);
+                    }
+
+                    return thresh < 0 ? 0 : static_cast<dtype>(thresh);
+                }
+
+                if (indexHigh - indexLow < 2)
+                {
+                    return static_cast<dtype>(static_cast<int32>(indexHigh) + inMinValue - 1);
+                }
+
+                index = indexLow + (indexHigh - indexLow) / 2;
+            }
+
+            // shouldn't ever get here but stop the compiler from throwing a warning
+            return static_cast<dtype>(histSize - 1);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Calculates the threshold such that the input rate of pixels exceeds it from
+        /// a histogram of countValues
+        ///
+        /// @param inCounts: one bin per representable value of dtype
+        /// @param inNumPixels: the number of pixels counted
+        /// @param inRate
+        /// @return dtype
+        ///
+        template<typename dtype>
+        dtype thresholdFromValueCounts(const std::vector<uint64>& inCounts, uint64 inNumPixels, double inRate)
+        {
+            constexpr auto lowest = static_cast<int32>(std::numeric_limits<dtype>::lowest());
+
+            const auto isOccupied = [](uint64 count) noexcept -> bool { return count > 0; };
+            const auto first      = std::find_if(inCounts.begin(), inCounts.end(), isOccupied);
+            const auto last       = std::find_if(inCounts.rbegin(), inCounts.rend(), isOccupied);
+            if (first == inCounts.end())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("no pixels have been counted.");
+            }
+
+            const auto minBin = static_cast<int32>(first - inCounts.begin());
+            const auto maxBin = static_cast<int32>(inCounts.rend() - last) - 1;
+            return thresholdFromHistogram<dtype>(inCounts.data() + minBin,
+                                                 minBin + lowest,
+                                                 maxBin + lowest,
+                                                 inNumPixels,
+                                                 inRate);
+        }
+    } // namespace detail
+
     //============================================================================
     // Method Description:
     /// Calculates a threshold such that the input rate of pixels
     /// exceeds the threshold. Really should only be used for integer
     /// input array values. If using floating point data, user beware...
     ///
+    /// 8 and 16 bit integer arrays are counted in a single pass into a
+    /// histogram with one bin per representable value; other types make
+    /// one pass for the range and one for the histogram. The histogram
+    /// buffers are reused between calls on the same thread.
+    ///
     /// @param inImageArray
     /// @param inRate
     /// @return dtype
@@ -60,83 +261,36 @@ namespace nc::imageProcessing
             THROW_INVALID_ARGUMENT_ERROR("input rate must be of the range [0, 1]");
         }
 
-        // first build a histogram
-        auto minValue = static_cast<int32>(std::floor(inImageArray.min().item()));
-        auto maxValue = static_cast<int32>(std::floor(inImageArray.max().item()));
-
-        if (utils::essentiallyEqual(inRate, 0.))
-        {
-            return static_cast<dtype>(maxValue);
-        }
-
-        if (utils::essentiallyEqual(inRate, 1.))
+        if (inImageArray.isempty())
         {
-            if (DtypeInfo<dtype>::isSigned())
-            {
-                return static_cast<dtype>(minValue - 1);
-            }
-
-            return dtype{ 0 };
+            THROW_INVALID_ARGUMENT_ERROR("input array must not be empty.");
         }
 
-        const auto histSize = static_cast<uint32>(maxValue - minValue + 1);
-
-        NdArray<double> histogram(1, histSize);
-        histogram.zeros();
-        for (auto intensity : inImageArray)
+        thread_local std::vector<uint64> histogram;
+        if constexpr (detail::is_small_integer_v<dtype>)
         {
-            const auto bin = static_cast<uint32>(static_cast<int32>(std::floor(intensity)) - minValue);
-            ++histogram[bin];
+            detail::countValues(inImageArray, histogram);
+            return detail::thresholdFromValueCounts<dtype>(histogram, inImageArray.size(), inRate);
         }
-
-        // integrate the normalized histogram from right to left to make a survival function (1 - CDF)
-        const auto      dNumPixels = static_cast<double>(inImageArray.size());
-        NdArray<double> survivalFunction(1, histSize + 1);
-        survivalFunction[-1] = 0.;
-        for (int32 i = histSize - 1; i > -1; --i)
+        else
         {
-            double histValue    = histogram[i] / dNumPixels;
-            survivalFunction[i] = survivalFunction[i + 1] + histValue;
-        }
+            // first build a histogram
+            const auto [minIter, maxIter] = stl_algorithms::minmax_element(inImageArray.cbegin(), inImageArray.cend());
+            const auto minValue           = static_cast<int32>(std::floor(*minIter));
+            const auto maxValue           = static_cast<int32>(std::floor(*maxIter));
 
-        // binary search through the survival function to find the rate
-        uint32 indexLow  = 0;
-        uint32 indexHigh = histSize - 1;
-        uint32 index     = indexHigh / 2; // integer division
-
-        constexpr bool keepGoing = true;
-        while (keepGoing)
-        {
-            const double value = survivalFunction[index];
-            if (value < inRate)
+            histogram.assign(static_cast<uint32>(maxValue - minValue + 1), 0);
+            for (auto intensity : inImageArray)
             {
-                indexHigh = index;
-            }
-            else if (value > inRate)
-            {
-                indexLow = index;
-            }
-            else
-            {
-                const int32 thresh = static_cast<int32>(index) + minValue - 1;
-                if (DtypeInfo<dtype>::isSigned())
-                {
-                    return static_cast<dtype>(thresh);
-                }
-
-                return thresh < 0 ? 0 : static_cast<dtype>(thresh);
+                const auto bin = static_cast<uint32>(static_cast<int32>(std::floor(intensity)) - minValue);
+                ++histogram[bin];
             }
 
-            if (indexHigh - indexLow < 2)
-            {
-                return static_cast<dtype>(static_cast<int32>(indexHigh) + minValue - 1);
-            }
-
-            index = indexLow + (indexHigh - indexLow) / 2;
+            return detail::thresholdFromHistogram<dtype>(histogram.data(),
+                                                         minValue,
+                                                         maxValue,
+                                                         inImageArray.size(),
+                                                         inRate);
         }
-
-        // shouldn't ever get here but stop the compiler from throwing a warning
-        return static_cast<dtype>(histSize - 1);
     }
-
 } // namespace nc::imageProcessing
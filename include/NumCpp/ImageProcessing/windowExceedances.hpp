@@ -51,11 +51,13 @@ namespace nc::imageProcessing
         const Shape   inShape = xcds.shape();
         for (uint8 border = 0; border < inBorderWidth; ++border)
         {
+            // each pass grows the window of the previous one by a pixel
+            const NdArray<bool> previous(xcds);
             for (int32 row = 0; row < static_cast<int32>(inShape.rows); ++row)
             {
                 for (int32 col = 0; col < static_cast<int32>(inShape.cols); ++col)
                 {
-                    if (inExceedances(row, col))
+                    if (previous(row, col))
                     {
                         xcds(std::max(row - 1, 0), std::max(col - 1, 0))                       = true;
                         xcds(std::max(row - 1, 0), col)                                        = true;
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "NumCpp/Linalg/cholesky.hpp"
+#include "NumCpp/Linalg/cholesky/Cholesky.hpp"
 #include "NumCpp/Linalg/det.hpp"
 #include "NumCpp/Linalg/eig.hpp"
 #include "NumCpp/Linalg/eigvals.hpp"
@@ -35,11 +36,14 @@
 #include "NumCpp/Linalg/hat.hpp"
 #include "NumCpp/Linalg/inv.hpp"
 #include "NumCpp/Linalg/lstsq.hpp"
+#include "NumCpp/Linalg/lu/LU.hpp"
 #include "NumCpp/Linalg/lu_decomposition.hpp"
 #include "NumCpp/Linalg/matrix_power.hpp"
 #include "NumCpp/Linalg/multi_dot.hpp"
 #include "NumCpp/Linalg/pinv.hpp"
 #include "NumCpp/Linalg/pivotLU_decomposition.hpp"
+#include "NumCpp/Linalg/qr/QR.hpp"
+#include "NumCpp/Linalg/slogdet.hpp"
 #include "NumCpp/Linalg/solve.hpp"
 #include "NumCpp/Linalg/svd.hpp"
 #include "NumCpp/Linalg/svdvals.hpp"
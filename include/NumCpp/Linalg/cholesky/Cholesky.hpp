@@ -0,0 +1,345 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Cholesky factorization with reusable solves and rank one updates
+///
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/Gemm.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/Functions/eye.hpp"
+#include "NumCpp/Linalg/lu/triangularSolve.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::linalg
+{
+    namespace detail
+    {
+        /// Column panel width of the blocked Cholesky factorization
+        constexpr uint32 CHOLESKY_BLOCK_SIZE = 64;
+
+        /// Rows of the trailing matrix updated per gemm::multiply call, bounds the workspace
+        constexpr uint32 CHOLESKY_UPDATE_ROWS = 256;
+
+        //============================================================================
+        // Method Description:
+        /// Cholesky factors a symmetric positive definite matrix in place, A = L * L.transpose(),
+        /// reading only its lower triangle. The columns are factored in panels of
+        /// CHOLESKY_BLOCK_SIZE, and the lower triangle of the trailing matrix is updated
+        /// with the cache blocked gemm::multiply.
+        ///
+        /// @param inOutMatrix: square matrix, overwritten with L and zeros above the diagonal
+        ///
+        /// @return false if the matrix is not positive definite, inOutMatrix is then unspecified
+        ///
+        inline bool choleskyFactor(NdArray<double>& inOutMatrix)
+        {
+            const uint32 n = inOutMatrix.numRows();
+            double*      a = inOutMatrix.data();
+
+            const auto element = [a, n](uint32 row, uint32 col) -> double&
+            { return a[static_cast<std::size_t>(row) * n + col]; };
+
+            std::vector<double> negL21;
+            std::vector<double> l21T;
+            std::vector<double> a22;
+
+            for (uint32 k0 = 0; k0 < n; k0 += CHOLESKY_BLOCK_SIZE)
+            {
+                const uint32 kEnd = std::min(k0 + CHOLESKY_BLOCK_SIZE, n);
+
+                // the panel, earlier panels have already been subtracted from it
+                for (uint32 k = k0; k < kEnd; ++k)
+                {
+                    const double* pivotRow = &element(k, 0);
+                    double        diagonal = pivotRow[k];
+                    for (uint32 col = k0; col < k; ++col)
+                    {
+                        diagonal -= pivotRow[col] * pivotRow[col];
+                    }
+
+                    if (!(diagonal > 0.))
+                    {
+                        return false;
+                    }
+
+                    element(k, k)                = std::sqrt(diagonal);
+                    const double inverseDiagonal = 1. / element(k, k);
+                    for (uint32 row = k + 1; row < n; ++row)
+                    {
+                        double* thisRow = &element(row, 0);
+                        double  value   = thisRow[k];
+                        for (uint32 col = k0; col < k; ++col)
+                        {
+                            value -= thisRow[col] * pivotRow[col];
+                        }
+                        thisRow[k] = value * inverseDiagonal;
+                    }
+                }
+
+                if (kEnd == n)
+                {
+                    break;
+                }
+
+                // lower triangle of A22 -= L21 * L21.transpose(), in row chunks so the workspace
+                // stays bounded
+                const uint32 panelWidth = kEnd - k0;
+                for (uint32 row0 = kEnd; row0 < n; row0 += CHOLESKY_UPDATE_ROWS)
+                {
+                    const uint32 numRows = std::min(CHOLESKY_UPDATE_ROWS, n - row0);
+                    const uint32 numCols = row0 + numRows - kEnd;
+
+                    negL21.resize(static_cast<std::size_t>(numRows) * panelWidth);
+                    a22.resize(static_cast<std::size_t>(numRows) * numCols);
+                    for (uint32 row = 0; row < numRows; ++row)
+                    {
+                        const double* l21Row = &element(row0 + row, k0);
+                        std::transform(l21Row,
+                                       l21Row + panelWidth,
+                                       negL21.begin() + static_cast<std::ptrdiff_t>(row) * panelWidth,
+                                       [](double value) { return -value; });
+                        std::copy_n(&element(row0 + row, kEnd),
+                                    numCols,
+                                    a22.begin() + static_cast<std::ptrdiff_t>(row) * numCols);
+                    }
+
+                    l21T.resize(static_cast<std::size_t>(panelWidth) * numCols);
+                    for (uint32 col = 0; col < numCols; ++col)
+                    {
+                        const double* l21Row = &element(kEnd + col, k0);
+                        for (uint32 k = 0; k < panelWidth; ++k)
+                        {
+                            l21T[static_cast<std::size_t>(k) * numCols + col] = l21Row[k];
+                        }
+                    }
+
+                    gemm::multiply(numRows, numCols, panelWidth, negL21.data(), l21T.data(), a22.data());
+
+                    for (uint32 row = 0; row < numRows; ++row)
+                    {
+                        std::copy_n(a22.begin() + static_cast<std::ptrdiff_t>(row) * numCols,
+                                    row0 + row + 1 - kEnd,
+                                    &element(row0 + row, kEnd));
+                    }
+                }
+            }
+
+            for (uint32 row = 0; row < n; ++row)
+            {
+                std::fill(&element(row, 0) + row + 1, &element(row, 0) + n, 0.);
+            }
+
+            return true;
+        }
+    } // namespace detail
+
+    // =============================================================================
+    // Class Description:
+    /// Cholesky factorization, A = L * L.transpose(), of a symmetric positive definite
+    /// matrix. The matrix is factored once, blocked and in place, and can then be solved
+    /// against any number of right hand sides in O(n^2) each. The factorization can be
+    /// kept current under rank one changes of A with update() and downdate(), also in O(n^2).
+    template<typename dtype>
+    class Cholesky
+    {
+    public:
+        STATIC_ASSERT_ARITHMETIC(dtype);
+
+        // =============================================================================
+        // Description:
+        /// Constructor, only the lower triangle of inMatrix is read
+        ///
+        /// @param inMatrix: symmetric positive definite matrix to factor
+        ///
+        explicit Cholesky(const NdArray<dtype>& inMatrix) :
+            l_(inMatrix.template astype<double>())
+        {
+            if (!inMatrix.shape().issquare())
+            {
+                THROW_RUNTIME_ERROR("Input matrix should be square.");
+            }
+
+            if (!detail::choleskyFactor(l_))
+            {
+                THROW_RUNTIME_ERROR("Matrix is not positive definite.");
+            }
+        }
+
+        // =============================================================================
+        // Description:
+        /// the lower triangular factor L
+        ///
+        /// @return NdArray
+        ///
+        const NdArray<double>& l() const noexcept
+        {
+            return l_;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the determinant of the matrix
+        ///
+        /// @return double
+        ///
+        double det() const
+        {
+            double determinant = 1.;
+            for (uint32 i = 0; i < l_.numRows(); ++i)
+            {
+                determinant *= l_(i, i) * l_(i, i);
+            }
+
+            return determinant;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the inverse of the matrix
+        ///
+        /// @return NdArray
+        ///
+        NdArray<double> inverse() const
+        {
+            return solve(eye<double>(l_.numRows()));
+        }
+
+        // =============================================================================
+        // Description:
+        /// Solves A X = B for every column of B at once
+        ///
+        /// @param inB: n x k right hand sides, or a flat array of size n
+        ///
+        /// @return NdArray with the shape of inB
+        ///
+        NdArray<double> solve(const NdArray<double>& inB) const
+        {
+            const uint32 n = l_.numRows();
+            if (inB.numRows() != n && !(inB.isflat() && inB.size() == n))
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input array b must have as many rows as the matrix.");
+            }
+
+            auto result = inB.copy();
+            if (result.numRows() != n)
+            {
+                result.reshape(n, 1);
+            }
+            const auto numRhs = result.numCols();
+
+            const auto& lower = l_;
+            detail::solveTriangular([&lower](uint32 row, uint32 col) { return lower(row, col); },
+                                    n,
+                                    true,
+                                    false,
+                                    result.data(),
+                                    numRhs);
+            detail::solveTriangular([&lower](uint32 row, uint32 col) { return lower(col, row); },
+                                    n,
+                                    false,
+                                    false,
+                                    result.data(),
+                                    numRhs);
+
+            result.reshape(inB.shape());
+            return result;
+        }
+
+        // =============================================================================
+        // Description:
+        /// Updates the factorization to that of A + x * x.transpose()
+        ///
+        /// @param inX: flat array of size n
+        ///
+        void update(const NdArray<double>& inX)
+        {
+            rankOne(inX, 1.);
+        }
+
+        // =============================================================================
+        // Description:
+        /// Downdates the factorization to that of A - x * x.transpose(). Throws if the result
+        /// would not be positive definite, in which case the factorization is left unchanged.
+        ///
+        /// @param inX: flat array of size n
+        ///
+        void downdate(const NdArray<double>& inX)
+        {
+            rankOne(inX, -1.);
+        }
+
+    private:
+        NdArray<double> l_{};
+
+        // =============================================================================
+        // Description:
+        /// rotates x into L one column at a time, on a copy so that a failed downdate leaves
+        /// the factorization untouched
+        ///
+        /// @param inX: flat array of size n
+        /// @param inSign: 1 to update, -1 to downdate
+        ///
+        void rankOne(const NdArray<double>& inX, double inSign)
+        {
+            const uint32 n = l_.numRows();
+            if (inX.size() != n || (inX.numRows() != 1 && inX.numCols() != 1))
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input array x must be flat with the size of the matrix.");
+            }
+
+            auto lower = l_.copy();
+            auto x     = inX.copy();
+            for (uint32 k = 0; k < n; ++k)
+            {
+                const double diagonal = lower(k, k);
+                const double squared  = diagonal * diagonal + inSign * x[k] * x[k];
+                if (!(squared > 0.))
+                {
+                    THROW_RUNTIME_ERROR("Matrix is not positive definite.");
+                }
+
+                const double radius = std::sqrt(squared);
+                const double c      = radius / diagonal;
+                const double s      = x[k] / diagonal;
+                lower(k, k)         = radius;
+                for (uint32 row = k + 1; row < n; ++row)
+                {
+                    lower(row, k) = (lower(row, k) + inSign * s * x[row]) / c;
+                    x[row]        = c * x[row] - s * lower(row, k);
+                }
+            }
+
+            l_ = std::move(lower);
+        }
+    };
+} // namespace nc::linalg
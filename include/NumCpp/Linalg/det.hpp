@@ -27,37 +27,140 @@
 ///
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "NumCpp/Core/Internal/Error.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
 #include "NumCpp/Core/Internal/TypeTraits.hpp"
 #include "NumCpp/Core/Shape.hpp"
 #include "NumCpp/Core/Types.hpp"
+#include "NumCpp/Linalg/lapack/Lapack.hpp"
+#include "NumCpp/Linalg/lu/luFactor.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::linalg
 {
     namespace detail
     {
+#ifdef __SIZEOF_INT128__
+        /// Products in the Bareiss elimination are formed twice as wide as the entries
+        __extension__ using BareissProduct = __int128;
+#else
+        using BareissProduct = int64;
+#endif
+
+        //============================================================================
+        // Method Description:
+        /// Exact determinant of an integer matrix by fraction free Bareiss elimination in
+        /// O(n^3). Every division is exact and every intermediate entry is a minor of the
+        /// matrix, so the result is exact as long as those minors fit in an int64.
+        ///
+        /// @param inArray: square matrix of order 2 or more
+        /// @return matrix determinant
+        ///
+        template<typename dtype>
+        int64 bareissDet(const NdArray<dtype>& inArray)
+        {
+            const uint32       order = inArray.numRows();
+            std::vector<int64> matrix(inArray.size());
+            std::transform(inArray.begin(),
+                           inArray.end(),
+                           matrix.begin(),
+                           [](dtype value) { return static_cast<int64>(value); });
+
+            const auto element = [&matrix, order](uint32 row, uint32 col) -> int64&
+            { return matrix[static_cast<std::size_t>(row) * order + col]; };
+
+            int64 sign          = 1;
+            int64 previousPivot = 1;
+            for (uint32 k = 0; k + 1 < order; ++k)
+            {
+                if (element(k, k) == 0)
+                {
+                    uint32 pivotRow = k + 1;
+                    while (pivotRow < order && element(pivotRow, k) == 0)
+                    {
+                        ++pivotRow;
+                    }
+
+                    if (pivotRow == order)
+                    {
+                        return 0;
+                    }
+
+                    std::swap_ranges(&element(k, 0), &element(k, 0) + order, &element(pivotRow, 0));
+                    sign = -sign;
+                }
+
+                const BareissProduct pivot = element(k, k);
+                for (uint32 row = k + 1; row < order; ++row)
+                {
+                    const BareissProduct multiplier = element(row, k);
+                    for (uint32 col = k + 1; col < order; ++col)
+                    {
+                        element(row, col) = static_cast<int64>(
+                            (element(row, col) * pivot - multiplier * element(k, col)) / previousPivot);
+                    }
+                }
+
+                previousPivot = element(k, k);
+            }
+
+            return sign * element(order - 1, order - 1);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Determinant from a blocked LU factorization with partial pivoting in O(n^3)
+        ///
+        /// @param inMatrix: square matrix
+        /// @return matrix determinant
+        ///
+        inline double luDet(NdArray<double> inMatrix)
+        {
+            std::vector<uint32> pivots;
+            if (luFactor(inMatrix, pivots))
+            {
+                return 0.;
+            }
+
+            double determinant = 1.;
+            for (uint32 i = 0; i < inMatrix.numRows(); ++i)
+            {
+                determinant *= inMatrix(i, i);
+                if (pivots[i] != i)
+                {
+                    determinant = -determinant;
+                }
+            }
+
+            return determinant;
+        }
+
         //============================================================================
         // Method Description:
         /// matrix determinant.
         ///
         /// @param inArray
-        /// @param order
         /// @return matrix determinant
         ///
         template<typename dtype>
-        auto det(const NdArray<dtype>& inArray, uint32 order)
-            -> std::conditional_t<std::is_integral_v<dtype>, int64, double>
+        auto det(const NdArray<dtype>& inArray) -> std::conditional_t<std::is_integral_v<dtype>, int64, double>
         {
             STATIC_ASSERT_ARITHMETIC(dtype);
 
             using ReturnType = std::conditional_t<std::is_integral_v<dtype>, int64, double>;
 
+            const uint32 order = inArray.numRows();
+            if (order == 0)
+            {
+                return ReturnType{ 1 };
+            }
+
             if (order == 1)
             {
                 return static_cast<ReturnType>(inArray.front());
@@ -87,40 +190,22 @@ namespace nc::linalg
                 return aei + bfg + cdh - ceg - bdi - afh;
             }
 
-            ReturnType     determinant = 0;
-            ReturnType     sign        = 1;
-            NdArray<dtype> submat(order - 1);
-
-            for (uint32 c = 0; c < order; ++c)
+            if constexpr (std::is_integral_v<dtype>)
             {
-                uint32 subi = 0;
-                for (uint32 i = 1; i < order; ++i)
-                {
-                    uint32 subj = 0;
-                    for (uint32 j = 0; j < order; ++j)
-                    {
-                        if (j == c)
-                        {
-                            continue;
-                        }
-
-                        submat(subi, subj++) = inArray(i, j);
-                    }
-                    ++subi;
-                }
-
-                determinant += (sign * static_cast<ReturnType>(inArray(0, c)) * det(submat, order - 1));
-                sign *= -1;
+                return bareissDet(inArray);
+            }
+            else
+            {
+                return luDet(inArray.template astype<double>());
             }
-
-            return determinant;
         }
     } // namespace detail
 
     //============================================================================
     // Method Description:
-    /// matrix determinant.
-    /// NOTE: can get verrrrry slow for large matrices (order > 10)
+    /// matrix determinant, O(n^3). Floating point determinants come from a blocked LU
+    /// factorization with partial pivoting, integer determinants from exact Bareiss
+    /// elimination.
     ///
     /// SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.linalg.det.html#scipy.linalg.det
     ///
@@ -138,6 +223,14 @@ namespace nc::linalg
             THROW_INVALID_ARGUMENT_ERROR("input array must be square.");
         }
 
-        return detail::det(inArray, inShape.rows);
+#ifdef NUMCPP_USE_LAPACK
+        // integer determinants keep the exact elimination
+        if constexpr (!std::is_integral_v<dtype>)
+        {
+            return lapack::det(inArray.template astype<double>());
+        }
+#endif
+
+        return detail::det(inArray);
     }
 } // namespace nc::linalg
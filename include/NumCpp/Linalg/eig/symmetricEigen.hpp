@@ -0,0 +1,622 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Eigen decomposition of real symmetric matrices by cyclic Jacobi, or by Householder
+/// tridiagonalization and the implicit QL iteration
+///
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/Linalg/svd/golubKahan.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::linalg::detail
+{
+    /// Largest order decomposed with cyclic Jacobi, larger matrices are tridiagonalized
+    constexpr uint32 JACOBI_MAX_ORDER = 8;
+
+    /// Jacobi sweeps before giving up, each sweep rotates every off diagonal pair once
+    constexpr uint32 JACOBI_MAX_SWEEPS = 50;
+
+    /// Implicit QL iterations allowed per eigen value before giving up
+    constexpr uint32 QL_MAX_ITERATIONS = 30;
+
+    /// Inverse iterations per eigen vector of the tridiagonal matrix
+    constexpr uint32 INVERSE_ITERATIONS = 3;
+
+    //============================================================================
+    // Method Description:
+    /// Cyclic Jacobi in the parallel (round robin) ordering, where every round rotates n / 2
+    /// disjoint pairs. A pair is skipped once its off diagonal element is below inTolerance
+    /// or negligible relative to its diagonal elements, and the sweeps stop when a whole
+    /// sweep is skipped.
+    ///
+    /// @param inOutMatrix: symmetric n x n matrix, overwritten with its diagonalization
+    /// @param inOutVt: the transposed eigen vectors, rotated from the identity, may be empty
+    /// @param inTolerance: off diagonal magnitude treated as zero
+    ///
+    inline void cyclicJacobi(NdArray<double>& inOutMatrix, NdArray<double>& inOutVt, double inTolerance)
+    {
+        const uint32 n       = inOutMatrix.numRows();
+        auto&        a       = inOutMatrix;
+        const uint32 players = n + n % 2;
+        const double epsilon = std::numeric_limits<double>::epsilon();
+
+        std::vector<uint32> seats(players);
+        std::iota(seats.begin(), seats.end(), 0);
+
+        const auto rotate = [&a, &inOutVt, n, inTolerance, epsilon](uint32 p, uint32 q)
+        {
+            const double apq = a(p, q);
+            const double app = a(p, p);
+            const double aqq = a(q, q);
+            if (!(std::abs(apq) > std::max(inTolerance, epsilon * std::sqrt(std::abs(app * aqq)))))
+            {
+                return false;
+            }
+
+            const double theta = (aqq - app) / (2. * apq);
+            const double t     = (theta >= 0. ? 1. : -1.) / (std::abs(theta) + std::hypot(theta, 1.));
+            const double c     = 1. / std::hypot(t, 1.);
+            const double s     = t * c;
+            const double tau   = s / (1. + c);
+
+            a(p, p) = app - t * apq;
+            a(q, q) = aqq + t * apq;
+            a(p, q) = 0.;
+            a(q, p) = 0.;
+            for (uint32 r = 0; r < n; ++r)
+            {
+                if (r == p || r == q)
+                {
+                    continue;
+                }
+
+                const double arp = a(r, p);
+                const double arq = a(r, q);
+                a(r, p)          = arp - s * (arq + tau * arp);
+                a(r, q)          = arq + s * (arp - tau * arq);
+                a(p, r)          = a(r, p);
+                a(q, r)          = a(r, q);
+            }
+
+            if (!inOutVt.isempty())
+            {
+                double* vp = &inOutVt(p, 0);
+                double* vq = &inOutVt(q, 0);
+                for (uint32 r = 0; r < n; ++r)
+                {
+                    const double valueP = vp[r];
+                    vp[r]               = c * valueP - s * vq[r];
+                    vq[r]               = s * valueP + c * vq[r];
+                }
+            }
+
+            return true;
+        };
+
+        for (uint32 sweep = 0; sweep < JACOBI_MAX_SWEEPS; ++sweep)
+        {
+            bool rotated = false;
+            for (uint32 round = 0; round + 1 < players; ++round)
+            {
+                for (uint32 i = 0; i < players / 2; ++i)
+                {
+                    const uint32 p = std::min(seats[i], seats[players - 1 - i]);
+                    const uint32 q = std::max(seats[i], seats[players - 1 - i]);
+                    if (q < n)
+                    {
+                        rotated = rotate(p, q) || rotated;
+                    }
+                }
+
+                // the first seat stays, everyone else moves one seat around the table
+                std::rotate(seats.begin() + 1, seats.end() - 1, seats.end());
+            }
+
+            if (!rotated)
+            {
+                return;
+            }
+        }
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Reduces a symmetric matrix to tridiagonal form with Householder reflections,
+    /// A = Q * T * Q.transpose(). Reflector k is stored in column k below the sub diagonal,
+    /// its leading one on the sub diagonal implied.
+    ///
+    /// @param inOutMatrix: symmetric n x n matrix, overwritten with the reflectors
+    /// @param outDiagonal: the diagonal of T
+    /// @param outSubDiagonal: the sub diagonal of T
+    ///
+    /// @return the reflector scales
+    ///
+    inline std::vector<double> tridiagonalize(NdArray<double>&     inOutMatrix,
+                                              std::vector<double>& outDiagonal,
+                                              std::vector<double>& outSubDiagonal)
+    {
+        const uint32 n = inOutMatrix.numRows();
+        auto&        a = inOutMatrix;
+        outDiagonal.assign(n, 0.);
+        outSubDiagonal.assign(n > 0 ? n - 1 : 0, 0.);
+
+        std::vector<double> tau(n > 1 ? n - 1 : 0, 0.);
+        std::vector<double> v(n);
+        std::vector<double> w(n);
+
+        for (uint32 k = 0; k + 1 < n; ++k)
+        {
+            tau[k] = householder(&a(k + 1, k), n - k - 1, n);
+            if (std::abs(tau[k]) > 0.)
+            {
+                // A22 = H * A22 * H as the symmetric rank two update A22 - v * w' - w * v'
+                const uint32 first = k + 1;
+                for (uint32 i = first; i < n; ++i)
+                {
+                    v[i] = i == first ? 1. : a(i, k);
+                }
+
+                for (uint32 row = first; row < n; ++row)
+                {
+                    const double* aRow = &a(row, 0);
+                    double        dot  = 0.;
+                    for (uint32 col = first; col < n; ++col)
+                    {
+                        dot += aRow[col] * v[col];
+                    }
+                    w[row] = tau[k] * dot;
+                }
+
+                double vTw = 0.;
+                for (uint32 i = first; i < n; ++i)
+                {
+                    vTw += v[i] * w[i];
+                }
+
+                const double halfTauVTw = tau[k] * vTw / 2.;
+                for (uint32 i = first; i < n; ++i)
+                {
+                    w[i] -= halfTauVTw * v[i];
+                }
+
+                for (uint32 row = first; row < n; ++row)
+                {
+                    double* aRow = &a(row, 0);
+                    for (uint32 col = first; col < n; ++col)
+                    {
+                        aRow[col] -= v[row] * w[col] + w[row] * v[col];
+                    }
+                }
+            }
+
+            outDiagonal[k]    = a(k, k);
+            outSubDiagonal[k] = a(k + 1, k);
+        }
+
+        if (n > 0)
+        {
+            outDiagonal[n - 1] = a(n - 1, n - 1);
+        }
+
+        return tau;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Eigen values of a symmetric tridiagonal matrix by the implicit QL iteration with
+    /// Wilkinson shifts. An off diagonal element is negligible below epsilon times the norm
+    /// of the matrix, the accuracy of the tridiagonalization, so that blocks of eigen values
+    /// near zero split. The rotations are applied to the rows of Zt, which are kept
+    /// transposed so that each rotation streams two contiguous rows.
+    ///
+    /// @param inOutDiagonal: the diagonal, overwritten with the unsorted eigen values
+    /// @param inOutSubDiagonal: the sub diagonal, destroyed
+    /// @param inOutZt: rotated in place, may be empty
+    ///
+    inline void tridiagonalQL(std::vector<double>& inOutDiagonal,
+                              std::vector<double>& inOutSubDiagonal,
+                              NdArray<double>&     inOutZt)
+    {
+        auto&        d       = inOutDiagonal;
+        auto&        e       = inOutSubDiagonal;
+        const auto   n       = static_cast<uint32>(d.size());
+        e.resize(n, 0.);
+
+        double norm = 0.;
+        for (uint32 i = 0; i < n; ++i)
+        {
+            norm = std::max(norm, std::abs(d[i]) + std::abs(e[i]) + (i > 0 ? std::abs(e[i - 1]) : 0.));
+        }
+        const double negligible = std::numeric_limits<double>::epsilon() * norm;
+
+        for (uint32 l = 0; l < n; ++l)
+        {
+            uint32 iterations = 0;
+            while (true)
+            {
+                uint32 m = l;
+                while (m + 1 < n && std::abs(e[m]) > negligible)
+                {
+                    ++m;
+                }
+
+                if (m == l)
+                {
+                    break;
+                }
+
+                if (++iterations > QL_MAX_ITERATIONS)
+                {
+                    THROW_RUNTIME_ERROR("Eigen decomposition did not converge.");
+                }
+
+                double g = (d[l + 1] - d[l]) / (2. * e[l]);
+                double r = std::hypot(g, 1.);
+                g        = d[m] - d[l] + e[l] / (g + (g >= 0. ? r : -r));
+
+                double s         = 1.;
+                double c         = 1.;
+                double p         = 0.;
+                bool   underflow = false;
+                for (uint32 i = m; i-- > l;)
+                {
+                    const double f = s * e[i];
+                    const double b = c * e[i];
+                    r              = std::hypot(f, g);
+                    e[i + 1]       = r;
+                    if (!(r > 0.))
+                    {
+                        // recover from underflow, the block splits at i
+                        d[i + 1] -= p;
+                        e[m]      = 0.;
+                        underflow = true;
+                        break;
+                    }
+
+                    s        = f / r;
+                    c        = g / r;
+                    g        = d[i + 1] - p;
+                    r        = (d[i] - g) * s + 2. * c * b;
+                    p        = s * r;
+                    d[i + 1] = g + p;
+                    g        = c * r - b;
+
+                    if (!inOutZt.isempty())
+                    {
+                        // columns i and i + 1 of Z are rows i and i + 1 of Zt
+                        rotateRows(inOutZt, i, i + 1, c, -s);
+                    }
+                }
+
+                if (!underflow)
+                {
+                    d[l] -= p;
+                    e[l]  = g;
+                    e[m]  = 0.;
+                }
+            }
+        }
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Eigen vectors of a symmetric tridiagonal matrix for the given eigen values by inverse
+    /// iteration. Each shifted matrix T - lambda * I is factored once with partial pivoting,
+    /// and vectors whose eigen values are close are reorthogonalized against each other.
+    ///
+    /// @param inDiagonal: the diagonal of T
+    /// @param inSubDiagonal: the sub diagonal of T
+    /// @param inEigenValues: eigen values of T
+    ///
+    /// @return the eigen vectors, the rows of a k x n array
+    ///
+    inline NdArray<double> tridiagonalInverseIteration(const std::vector<double>& inDiagonal,
+                                                       const std::vector<double>& inSubDiagonal,
+                                                       const std::vector<double>& inEigenValues)
+    {
+        const auto   n       = static_cast<uint32>(inDiagonal.size());
+        const auto   k       = static_cast<uint32>(inEigenValues.size());
+        const double epsilon = std::numeric_limits<double>::epsilon();
+
+        const auto sub = [&inSubDiagonal, n](uint32 i) { return i + 1 < n ? inSubDiagonal[i] : 0.; };
+
+        double norm = 0.;
+        for (uint32 i = 0; i < n; ++i)
+        {
+            norm = std::max(norm, std::abs(inDiagonal[i]) + std::abs(sub(i)) + (i > 0 ? std::abs(sub(i - 1)) : 0.));
+        }
+        const double tinyPivot      = std::max(epsilon * norm, std::numeric_limits<double>::min());
+        const double clusterSpacing = 1e-3 * norm;
+
+        NdArray<double>     vectors(k, n);
+        std::vector<double> u0(n);
+        std::vector<double> u1(n);
+        std::vector<double> u2(n);
+        std::vector<double> multipliers(n);
+        std::vector<char>   swapped(n);
+        std::vector<double> x(n);
+
+        for (uint32 j = 0; j < k; ++j)
+        {
+            const double lambda = inEigenValues[j];
+
+            // LU of T - lambda * I with partial pivoting, U has two super diagonals
+            double r0 = n > 0 ? inDiagonal[0] - lambda : 0.;
+            double r1 = n > 1 ? sub(0) : 0.;
+            for (uint32 i = 0; i + 1 < n; ++i)
+            {
+                const double n0 = sub(i);
+                const double n1 = inDiagonal[i + 1] - lambda;
+                const double n2 = sub(i + 1);
+
+                swapped[i] = std::abs(n0) > std::abs(r0);
+                if (swapped[i])
+                {
+                    u0[i] = n0;
+                    u1[i] = n1;
+                    u2[i] = n2;
+                    const double m = r0 / n0;
+                    multipliers[i] = m;
+                    r0             = r1 - m * n1;
+                    r1             = -m * n2;
+                }
+                else
+                {
+                    u0[i] = std::abs(r0) > 0. ? r0 : tinyPivot;
+                    u1[i] = r1;
+                    u2[i] = 0.;
+                    const double m = n0 / u0[i];
+                    multipliers[i] = m;
+                    r0             = n1 - m * r1;
+                    r1             = n2;
+                }
+            }
+            if (n > 0)
+            {
+                u0[n - 1] = std::abs(r0) > 0. ? r0 : tinyPivot;
+            }
+
+            // a fixed, well spread start vector
+            std::uint32_t state = 12345u + j;
+            for (auto& value : x)
+            {
+                state = state * 1664525u + 1013904223u;
+                value = static_cast<double>(state) / 4294967296. - 0.5;
+            }
+
+            for (uint32 iteration = 0; iteration < INVERSE_ITERATIONS; ++iteration)
+            {
+                for (uint32 i = 0; i + 1 < n; ++i)
+                {
+                    if (swapped[i])
+                    {
+                        std::swap(x[i], x[i + 1]);
+                    }
+                    x[i + 1] -= multipliers[i] * x[i];
+                }
+
+                for (uint32 i = n; i-- > 0;)
+                {
+                    double value = x[i];
+                    if (i + 1 < n)
+                    {
+                        value -= u1[i] * x[i + 1];
+                    }
+                    if (i + 2 < n)
+                    {
+                        value -= u2[i] * x[i + 2];
+                    }
+                    x[i] = value / u0[i];
+                }
+
+                // modified Gram-Schmidt against the vectors of nearby eigen values
+                for (uint32 other = 0; other < j; ++other)
+                {
+                    if (std::abs(inEigenValues[other] - lambda) > clusterSpacing)
+                    {
+                        continue;
+                    }
+
+                    const double* otherRow = &vectors(other, 0);
+                    const double  dot      = std::inner_product(x.begin(), x.end(), otherRow, 0.);
+                    for (uint32 i = 0; i < n; ++i)
+                    {
+                        x[i] -= dot * otherRow[i];
+                    }
+                }
+
+                const double scale = 1. / std::sqrt(std::inner_product(x.begin(), x.end(), x.begin(), 0.));
+                std::transform(x.begin(), x.end(), x.begin(), [scale](double value) { return value * scale; });
+            }
+
+            std::copy(x.begin(), x.end(), &vectors(j, 0));
+        }
+
+        return vectors;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Multiplies a matrix by Q = H(0) * H(1) * ... in place without forming Q, reflector k
+    /// is column k of the reflectors with its implied one at row k + offset
+    ///
+    /// @param reflectors: the Householder vectors
+    /// @param tau: the reflector scales
+    /// @param offset: row of reflector 0's leading one
+    /// @param inOutMatrix: n x k matrix, overwritten with Q * inOutMatrix
+    ///
+    inline void applyReflectors(const NdArray<double>&     reflectors,
+                                const std::vector<double>& tau,
+                                uint32                     offset,
+                                NdArray<double>&           inOutMatrix)
+    {
+        const uint32 n       = inOutMatrix.numRows();
+        const uint32 numCols = inOutMatrix.numCols();
+
+        std::vector<double> w(numCols);
+        for (auto k = static_cast<uint32>(tau.size()); k-- > 0;)
+        {
+            if (!(std::abs(tau[k]) > 0.))
+            {
+                continue;
+            }
+
+            const uint32 first = k + offset;
+            std::fill(w.begin(), w.end(), 0.);
+            for (uint32 row = first; row < n; ++row)
+            {
+                const double  v      = row == first ? 1. : reflectors(row, k);
+                const double* matRow = &inOutMatrix(row, 0);
+                for (uint32 col = 0; col < numCols; ++col)
+                {
+                    w[col] += v * matRow[col];
+                }
+            }
+
+            for (uint32 row = first; row < n; ++row)
+            {
+                const double v      = (row == first ? 1. : reflectors(row, k)) * tau[k];
+                double*      matRow = &inOutMatrix(row, 0);
+                for (uint32 col = 0; col < numCols; ++col)
+                {
+                    matRow[col] -= v * w[col];
+                }
+            }
+        }
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Eigen decomposition of a real symmetric matrix. Orders up to JACOBI_MAX_ORDER are
+    /// diagonalized with cyclic Jacobi. Larger matrices are tridiagonalized, their eigen
+    /// values found with the implicit QL iteration, and their eigen vectors either
+    /// accumulated through the QL rotations or, when only a few are wanted, found by
+    /// inverse iteration on the tridiagonal matrix and transformed back.
+    ///
+    /// @param inMatrix: symmetric n x n matrix
+    /// @param computeVectors: whether to compute the eigen vectors
+    /// @param numLargest: the number of largest eigen values wanted, 0 for all
+    /// @param inTolerance: off diagonal magnitude treated as zero by Jacobi
+    ///
+    /// @return eigen values (1 x k, descending) and eigen vectors (the n x k columns, empty
+    ///         unless computeVectors)
+    ///
+    inline std::pair<NdArray<double>, NdArray<double>>
+        symmetricEigen(NdArray<double> inMatrix, bool computeVectors, uint32 numLargest, double inTolerance)
+    {
+        const uint32 n = inMatrix.numRows();
+        const uint32 k = numLargest == 0 ? n : std::min(numLargest, n);
+
+        std::vector<double> values;
+        NdArray<double>     vectorsT;
+        if (n <= JACOBI_MAX_ORDER)
+        {
+            if (computeVectors)
+            {
+                vectorsT = NdArray<double>(n, n);
+                vectorsT.zeros();
+                for (uint32 i = 0; i < n; ++i)
+                {
+                    vectorsT(i, i) = 1.;
+                }
+            }
+
+            cyclicJacobi(inMatrix, vectorsT, inTolerance);
+            values.resize(n);
+            for (uint32 i = 0; i < n; ++i)
+            {
+                values[i] = inMatrix(i, i);
+            }
+        }
+        else
+        {
+            std::vector<double> subDiagonal;
+            const auto          tau = tridiagonalize(inMatrix, values, subDiagonal);
+
+            if (computeVectors && k == n)
+            {
+                vectorsT = accumulateReflectors(inMatrix, tau, 1).transpose();
+                tridiagonalQL(values, subDiagonal, vectorsT);
+            }
+            else
+            {
+                const auto diagonal    = values;
+                const auto offDiagonal = subDiagonal;
+                tridiagonalQL(values, subDiagonal, vectorsT);
+
+                if (computeVectors)
+                {
+                    std::sort(values.begin(), values.end(), std::greater<>());
+                    values.resize(k);
+
+                    // x = Q * y for each eigen vector y of T, Q applied one reflector at a time
+                    auto y = tridiagonalInverseIteration(diagonal, offDiagonal, values).transpose();
+                    applyReflectors(inMatrix, tau, 1, y);
+                    vectorsT = y.transpose();
+                }
+            }
+        }
+
+        // descending order
+        std::vector<uint32> order(values.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(),
+                         order.end(),
+                         [&values](uint32 i, uint32 j) { return values[i] > values[j]; });
+
+        NdArray<double> eigenValues(1, k);
+        NdArray<double> eigenVectors;
+        if (computeVectors)
+        {
+            eigenVectors = NdArray<double>(n, k);
+        }
+
+        for (uint32 col = 0; col < k; ++col)
+        {
+            eigenValues[col] = values[order[col]];
+            if (computeVectors)
+            {
+                for (uint32 row = 0; row < n; ++row)
+                {
+                    eigenVectors(row, col) = vectorsT(order[col], row);
+                }
+            }
+        }
+
+        return std::make_pair(eigenValues, eigenVectors);
+    }
+} // namespace nc::linalg::detail
@@ -23,36 +23,50 @@
 /// DEALINGS IN THE SOFTWARE.
 ///
 /// Description
-/// linear least squares
+/// eigen values of a real symmetric matrix
 ///
 #pragma once
 
+#include "NumCpp/Core/Internal/Error.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
-#include "NumCpp/Linalg/eig.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/Linalg/eig/symmetricEigen.hpp"
+#include "NumCpp/Linalg/lapack/Lapack.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::linalg
 {
     //============================================================================
     // Method Description:
-    /// Compute the eigen values of a real symmetric matrix.
+    /// Compute the eigen values of a real symmetric matrix. Shares the engine of eig, but
+    /// skips accumulating the eigen vectors.
     ///
     /// NumPy Reference:
     /// https://numpy.org/doc/stable/reference/generated/numpy.linalg.eigvals.html
     ///
     /// @param inA: Matrix for which the eigen values and will be computed, must be a real, symmetric MxM
     ///             array
-    /// @param inTolerance (default 1e-12)
+    /// @param inTolerance (default 1e-12), off diagonal magnitude treated as zero by Jacobi, unused when
+    ///                    NUMCPP_USE_LAPACK is defined
+    /// @param inNumLargest (default 0), the number of largest eigen values to compute, 0 for all
     ///
-    /// @return NdArray
+    /// @return NdArray eigen values (1xK, descending)
     ///
     template<typename dtype>
-    NdArray<double> eigvals(const NdArray<dtype>& inA, double inTolerance = 1e-12)
+    NdArray<double>
+        eigvals(const NdArray<dtype>& inA, [[maybe_unused]] double inTolerance = 1e-12, uint32 inNumLargest = 0)
     {
         STATIC_ASSERT_ARITHMETIC(dtype);
 
-        const auto& [eigenValues, _] = eig(inA, inTolerance);
+        if (!inA.issquare())
+        {
+            THROW_INVALID_ARGUMENT_ERROR("Input array must be square.");
+        }
 
-        return eigenValues;
+#ifdef NUMCPP_USE_LAPACK
+        return lapack::eigh(inA.template astype<double>(), false, inNumLargest).first;
+#else
+        return detail::symmetricEigen(inA.template astype<double>(), false, inNumLargest, inTolerance).first;
+#endif
     }
 } // namespace nc::linalg
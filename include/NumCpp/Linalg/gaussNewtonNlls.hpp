@@ -23,35 +23,50 @@
 /// DEALINGS IN THE SOFTWARE.
 ///
 /// Description
-/// The Gauss�Newton algorithm is used to solve non-linear least squares problems.
+/// The Gauss-Newton algorithm is used to solve non-linear least squares problems.
 /// It is a modification of Newton's method for finding a minimum of a function.
 ///
 /// https://en.wikipedia.org/wiki/Gauss%E2%80%93Newton_algorithm
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <functional>
+#include <numeric>
 #include <type_traits>
 #include <utility>
 
+#include "NumCpp/Core/Enums.hpp"
 #include "NumCpp/Core/Internal/Error.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
 #include "NumCpp/Core/Internal/TypeTraits.hpp"
 #include "NumCpp/Core/Shape.hpp"
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Functions/rms.hpp"
-#include "NumCpp/Linalg/inv.hpp"
+#include "NumCpp/Linalg/qr/QR.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::linalg
 {
     //============================================================================
     // Method Description:
-    /// The Gauss�Newton algorithm is used to solve non-linear least squares problems.
+    /// The Gauss-Newton algorithm is used to solve non-linear least squares problems.
     /// It is a modification of Newton's method for finding a minimum of a function.
     /// https://en.wikipedia.org/wiki/Gauss%E2%80%93Newton_algorithm
     ///
-    /// @param numIterations: the number of iterations to perform
+    /// Every step solves the linearized least squares problem J * delta = r with a column
+    /// pivoted QR factorization of the Jacobian rather than the normal equations, whose
+    /// storage is reused from one iteration to the next. The Levenberg-Marquardt method
+    /// instead solves [J; sqrt(lambda) * D] * delta = [r; 0], with D the largest column
+    /// norms of the Jacobian seen so far, and only takes steps that reduce the residuals:
+    /// lambda is divided by 10 after a step is taken and multiplied by 10 after a step is
+    /// rejected.
+    /// https://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm
+    ///
+    /// @param method: NllsMethod::GAUSS_NEWTON or NllsMethod::LEVENBERG_MARQUARDT
+    /// @param numIterations: the number of iterations to perform, rejected Levenberg-Marquardt
+    /// steps included
     /// @param coordinates: the coordinate values.  The shape needs to be [n x d], where d is
     /// the number of diminsions of the fit function (f(x) is one dimensional,
     /// f(x, y) is two dimensions, etc), and n is the number of observations
@@ -74,7 +89,8 @@ namespace nc::linalg
              std::enable_if_t<all_arithmetic_v<Params...>, int>  = 0,
              std::enable_if_t<all_same_v<dtype, Params...>, int> = 0>
     std::pair<NdArray<double>, double>
-        gaussNewtonNlls(const uint32                                                              numIterations,
+        gaussNewtonNlls(const NllsMethod                                                          method,
+                        const uint32                                                              numIterations,
                         const NdArray<dtype>&                                                     coordinates,
                         const NdArray<dtype>&                                                     measurements,
                         const std::function<dtype(const NdArray<dtype>&, const NdArray<dtype>&)>& function,
@@ -91,44 +107,157 @@ namespace nc::linalg
             THROW_INVALID_ARGUMENT_ERROR("coordinates number of rows, and measurements size must be the same.");
         }
 
+        constexpr uint32 numParams       = sizeof...(Params);
+        constexpr double INITIAL_DAMPING = 1e-3;
+        constexpr double DAMPING_FACTOR  = 10.;
+        const uint32     numMeasurements = coordinatesShape.rows;
+        const bool       marquardt       = method == NllsMethod::LEVENBERG_MARQUARDT;
+        const uint32     numDampingRows  = marquardt ? numParams : 0;
+        const auto       colSlice        = coordinates.cSlice();
+
         NdArray<double> beta = NdArray<dtype>({ initialGuess... }).template astype<double>().transpose();
-        NdArray<double> residuals(coordinatesShape.rows, 1);
-        NdArray<double> jacobian(coordinatesShape.rows, sizeof...(Params));
+        NdArray<double> deltaBeta(numParams, 1);
+        NdArray<double> trialBeta(numParams, 1);
+        NdArray<double> residuals(numMeasurements, 1);
+        NdArray<double> trialResiduals(numMeasurements, 1);
 
-        const auto colSlice = coordinates.cSlice();
-        for (uint32 iteration = 1; iteration <= numIterations; ++iteration)
+        // the least squares system, the Jacobian with the damping rows below it
+        NdArray<double> system(numMeasurements + numDampingRows, numParams);
+        NdArray<double> rhs(numMeasurements + numDampingRows, 1);
+        system.zeros();
+        rhs.zeros();
+
+        const auto computeResiduals = [&](const NdArray<double>& params, NdArray<double>& outResiduals)
         {
-            for (uint32 measIdx = 0; measIdx < coordinatesShape.rows; ++measIdx)
+            for (uint32 measIdx = 0; measIdx < numMeasurements; ++measIdx)
             {
                 const auto coordinate = coordinates(measIdx, colSlice);
 
-                residuals[measIdx] =
-                    static_cast<double>(measurements[measIdx]) - static_cast<double>(function(coordinate, beta));
+                outResiduals[measIdx] =
+                    static_cast<double>(measurements[measIdx]) - static_cast<double>(function(coordinate, params));
+            }
+
+            return std::inner_product(outResiduals.begin(), outResiduals.end(), outResiduals.begin(), 0.);
+        };
+
+        const auto computeJacobian = [&]()
+        {
+            for (uint32 measIdx = 0; measIdx < numMeasurements; ++measIdx)
+            {
+                const auto coordinate = coordinates(measIdx, colSlice);
 
-                for (uint32 paramIdx = 0; paramIdx < sizeof...(Params); ++paramIdx)
+                for (uint32 paramIdx = 0; paramIdx < numParams; ++paramIdx)
                 {
-                    const auto& derivative      = derivatives[paramIdx];
-                    jacobian(measIdx, paramIdx) = static_cast<double>(derivative(coordinate, beta));
+                    const auto& derivative    = derivatives[paramIdx];
+                    system(measIdx, paramIdx) = static_cast<double>(derivative(coordinate, beta));
                 }
             }
+        };
 
-            // perform the gauss-newton linear algebra
-            const auto jacobianT             = jacobian.transpose();
-            const auto jacobianPsuedoInverse = linalg::inv(jacobianT.dot(jacobian));
-            const auto intermediate          = jacobianPsuedoInverse.dot(jacobianT);
-            const auto deltaBeta             = intermediate.dot(residuals);
-            beta += deltaBeta;
-        }
+        QR<double>      qr(true);
+        NdArray<double> scale(1, numParams);
+        double          cost          = computeResiduals(beta, residuals);
+        double          damping       = INITIAL_DAMPING;
+        bool            jacobianStale = true;
+        scale.zeros();
 
-        // calculate the final rms of the residuals
-        for (uint32 measIdx = 0; measIdx < coordinatesShape.rows; ++measIdx)
+        for (uint32 iteration = 1; iteration <= numIterations; ++iteration)
         {
-            const auto coordinate = coordinates(measIdx, colSlice);
+            if (jacobianStale)
+            {
+                computeJacobian();
+                jacobianStale = false;
+            }
 
-            residuals[measIdx] =
-                static_cast<double>(measurements[measIdx]) - static_cast<double>(function(coordinate, beta));
+            std::copy(residuals.begin(), residuals.end(), rhs.begin());
+            if (marquardt)
+            {
+                for (uint32 paramIdx = 0; paramIdx < numParams; ++paramIdx)
+                {
+                    double norm = 0.;
+                    for (uint32 measIdx = 0; measIdx < numMeasurements; ++measIdx)
+                    {
+                        norm = std::hypot(norm, system(measIdx, paramIdx));
+                    }
+                    scale[paramIdx]                              = std::max(scale[paramIdx], norm);
+                    system(numMeasurements + paramIdx, paramIdx) = std::sqrt(damping) * scale[paramIdx];
+                }
+            }
+
+            // perform the gauss-newton linear algebra
+            qr.refactor(system);
+            qr.lstsq(rhs, deltaBeta);
+
+            if (!marquardt)
+            {
+                beta += deltaBeta;
+                computeResiduals(beta, residuals);
+                jacobianStale = true;
+                continue;
+            }
+
+            std::transform(beta.begin(), beta.end(), deltaBeta.begin(), trialBeta.begin(), std::plus<>());
+            const double trialCost = computeResiduals(trialBeta, trialResiduals);
+            if (trialCost < cost)
+            {
+                std::swap(beta, trialBeta);
+                cost = trialCost;
+                std::swap(residuals, trialResiduals);
+                jacobianStale = true;
+                damping /= DAMPING_FACTOR;
+            }
+            else
+            {
+                damping *= DAMPING_FACTOR;
+            }
         }
 
         return std::make_pair(beta.flatten(), rms(residuals).item());
     }
+
+    //============================================================================
+    // Method Description:
+    /// The Gauss-Newton algorithm is used to solve non-linear least squares problems.
+    /// It is a modification of Newton's method for finding a minimum of a function.
+    /// https://en.wikipedia.org/wiki/Gauss%E2%80%93Newton_algorithm
+    ///
+    /// @param numIterations: the number of iterations to perform
+    /// @param coordinates: the coordinate values.  The shape needs to be [n x d], where d is
+    /// the number of diminsions of the fit function (f(x) is one dimensional,
+    /// f(x, y) is two dimensions, etc), and n is the number of observations
+    /// that are being fit to.
+    /// @param measurements: the measured values that are being fit
+    /// @param function: a std::function of the function that is being fit. The function takes as
+    /// inputs an NdArray of a single set of the coordinate values, and an NdArray
+    /// of the current values of the fit parameters
+    /// @param derivatives: array of std::functions to calculate the function
+    /// derivatives. The function that is being fit. The function takes as
+    /// inputs an NdArray of a single set of the coordinate values, and an NdArray
+    /// of the current values of the fit parameters
+    /// @param initialGuess: the initial guess of the parameters to be solved for
+    ///
+    /// @return std::pair of NdArray of solved parameter values, and rms of the residuals value
+    ///
+    template<typename dtype,
+             typename... Params,
+             std::enable_if_t<std::is_arithmetic_v<dtype>, int>  = 0,
+             std::enable_if_t<all_arithmetic_v<Params...>, int>  = 0,
+             std::enable_if_t<all_same_v<dtype, Params...>, int> = 0>
+    std::pair<NdArray<double>, double>
+        gaussNewtonNlls(const uint32                                                              numIterations,
+                        const NdArray<dtype>&                                                     coordinates,
+                        const NdArray<dtype>&                                                     measurements,
+                        const std::function<dtype(const NdArray<dtype>&, const NdArray<dtype>&)>& function,
+                        const std::array<std::function<dtype(const NdArray<dtype>&, const NdArray<dtype>&)>,
+                                         sizeof...(Params)>&                                      derivatives,
+                        Params... initialGuess)
+    {
+        return gaussNewtonNlls(NllsMethod::GAUSS_NEWTON,
+                               numIterations,
+                               coordinates,
+                               measurements,
+                               function,
+                               derivatives,
+                               initialGuess...);
+    }
 } // namespace nc::linalg
@@ -36,6 +36,7 @@
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Functions/zeros.hpp"
 #include "NumCpp/Linalg/det.hpp"
+#include "NumCpp/Linalg/lapack/Lapack.hpp"
 #include "NumCpp/NdArray.hpp"
 #include "NumCpp/Utils/essentiallyEqual.hpp"
 
@@ -61,6 +62,9 @@ namespace nc::linalg
             THROW_INVALID_ARGUMENT_ERROR("input array must be square.");
         }
 
+#ifdef NUMCPP_USE_LAPACK
+        return lapack::inv(inArray.template astype<double>());
+#else
         NdArray<double> inArrayDouble = inArray.template astype<double>();
         NdArray<int>    incidence     = nc::zeros<int>(inShape);
 
@@ -128,5 +132,6 @@ namespace nc::linalg
         }
 
         return result;
+#endif
     }
 } // namespace nc::linalg
@@ -0,0 +1,565 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Optional LAPACK backend for the linalg routines, enabled with NUMCPP_USE_LAPACK
+///
+#pragma once
+
+#ifdef NUMCPP_USE_LAPACK
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::linalg::lapack
+{
+    namespace detail
+    {
+        /// LAPACK integer, the LP64 interface
+        using Integer = int;
+
+        // The Fortran routines are called directly so only a LAPACK library is needed, not the
+        // LAPACKE headers. Character arguments carry the trailing hidden length that gfortran expects.
+        extern "C"
+        {
+            void dgetrf_(const Integer* m,
+                         const Integer* n,
+                         double*        a,
+                         const Integer* lda,
+                         Integer*       ipiv,
+                         Integer*       info);
+
+            void dgetrs_(const char*    trans,
+                         const Integer* n,
+                         const Integer* nrhs,
+                         const double*  a,
+                         const Integer* lda,
+                         const Integer* ipiv,
+                         double*        b,
+                         const Integer* ldb,
+                         Integer*       info,
+                         std::size_t    transLength);
+
+            void dgetri_(const Integer* n,
+                         double*        a,
+                         const Integer* lda,
+                         const Integer* ipiv,
+                         double*        work,
+                         const Integer* lwork,
+                         Integer*       info);
+
+            void dpotrf_(const char*    uplo,
+                         const Integer* n,
+                         double*        a,
+                         const Integer* lda,
+                         Integer*       info,
+                         std::size_t    uploLength);
+
+            void dgesdd_(const char*    jobz,
+                         const Integer* m,
+                         const Integer* n,
+                         double*        a,
+                         const Integer* lda,
+                         double*        s,
+                         double*        u,
+                         const Integer* ldu,
+                         double*        vt,
+                         const Integer* ldvt,
+                         double*        work,
+                         const Integer* lwork,
+                         Integer*       iwork,
+                         Integer*       info,
+                         std::size_t    jobzLength);
+
+            void dsyevd_(const char*    jobz,
+                         const char*    uplo,
+                         const Integer* n,
+                         double*        a,
+                         const Integer* lda,
+                         double*        w,
+                         double*        work,
+                         const Integer* lwork,
+                         Integer*       iwork,
+                         const Integer* liwork,
+                         Integer*       info,
+                         std::size_t    jobzLength,
+                         std::size_t    uploLength);
+
+            void dgelsy_(const Integer* m,
+                         const Integer* n,
+                         const Integer* nrhs,
+                         double*        a,
+                         const Integer* lda,
+                         double*        b,
+                         const Integer* ldb,
+                         Integer*       jpvt,
+                         const double*  rcond,
+                         Integer*       rank,
+                         double*        work,
+                         const Integer* lwork,
+                         Integer*       info);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Throws if a LAPACK routine reported an illegal argument
+        ///
+        /// @param info: the info output of the routine
+        /// @param routine: name of the routine
+        ///
+        inline void checkArguments(Integer info, const std::string& routine)
+        {
+            if (info < 0)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("argument " + std::to_string(-info) + " of " + routine + " is invalid.");
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// LU factors a square matrix in place with partial pivoting. A row-major NdArray
+        /// is the transpose of what LAPACK sees, which is factored instead; it has the same
+        /// determinant and the transposed inverse.
+        ///
+        /// @param inOutMatrix: square matrix, overwritten with the factors
+        /// @param outPivots: one based row interchanges
+        ///
+        /// @return true if the matrix is singular
+        ///
+        inline bool luFactor(NdArray<double>& inOutMatrix, std::vector<Integer>& outPivots)
+        {
+            const auto n   = static_cast<Integer>(inOutMatrix.numRows());
+            const auto lda = std::max(n, 1);
+            outPivots.resize(static_cast<std::size_t>(n));
+
+            Integer info = 0;
+            dgetrf_(&n, &n, inOutMatrix.data(), &lda, outPivots.data(), &info);
+            checkArguments(info, "dgetrf");
+
+            return info > 0;
+        }
+    } // namespace detail
+
+    //============================================================================
+    // Method Description:
+    /// Determinant through an LU factorization
+    ///
+    /// @param inMatrix: square matrix
+    ///
+    /// @return determinant
+    ///
+    inline double det(NdArray<double> inMatrix)
+    {
+        std::vector<detail::Integer> pivots;
+        detail::luFactor(inMatrix, pivots);
+
+        double determinant = 1.;
+        for (uint32 i = 0; i < inMatrix.numRows(); ++i)
+        {
+            determinant *= inMatrix(i, i);
+            if (pivots[i] != static_cast<detail::Integer>(i + 1))
+            {
+                determinant = -determinant;
+            }
+        }
+
+        return determinant;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Inverse through an LU factorization
+    ///
+    /// @param inMatrix: square matrix
+    ///
+    /// @return inverse
+    ///
+    inline NdArray<double> inv(NdArray<double> inMatrix)
+    {
+        std::vector<detail::Integer> pivots;
+        if (detail::luFactor(inMatrix, pivots))
+        {
+            THROW_RUNTIME_ERROR("Matrix is singular.");
+        }
+
+        const auto      n         = static_cast<detail::Integer>(inMatrix.numRows());
+        const auto      lda       = std::max(n, 1);
+        detail::Integer workQuery = -1;
+        double          workSize  = 0.;
+        detail::Integer info      = 0;
+        detail::dgetri_(&n, inMatrix.data(), &lda, pivots.data(), &workSize, &workQuery, &info);
+        detail::checkArguments(info, "dgetri");
+
+        const auto          lwork = std::max(static_cast<detail::Integer>(workSize), 1);
+        std::vector<double> work(static_cast<std::size_t>(lwork));
+        detail::dgetri_(&n, inMatrix.data(), &lda, pivots.data(), work.data(), &lwork, &info);
+        detail::checkArguments(info, "dgetri");
+
+        return inMatrix;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Solves A x = b through an LU factorization
+    ///
+    /// @param inA: square matrix
+    /// @param inB: right hand side, one value per row of A
+    ///
+    /// @return x, shaped like inB
+    ///
+    inline NdArray<double> solve(NdArray<double> inA, NdArray<double> inB)
+    {
+        std::vector<detail::Integer> pivots;
+        if (detail::luFactor(inA, pivots))
+        {
+            THROW_RUNTIME_ERROR("Matrix is singular.");
+        }
+
+        // the factors are of A^T, so solve the transposed system
+        constexpr char            TRANSPOSE = 'T';
+        constexpr detail::Integer NRHS      = 1;
+        const auto                n         = static_cast<detail::Integer>(inA.numRows());
+        const auto                lda       = std::max(n, 1);
+        detail::Integer           info      = 0;
+        detail::dgetrs_(&TRANSPOSE, &n, &NRHS, inA.data(), &lda, pivots.data(), inB.data(), &lda, &info, 1);
+        detail::checkArguments(info, "dgetrs");
+
+        return inB;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Lower triangular Cholesky factor. LAPACK's upper factor of the transpose is the
+    /// row-major lower factor.
+    ///
+    /// @param inMatrix: symmetric positive definite matrix
+    ///
+    /// @return L such that L * L^T = inMatrix
+    ///
+    inline NdArray<double> cholesky(NdArray<double> inMatrix)
+    {
+        constexpr char  UPPER = 'U';
+        const auto      n     = static_cast<detail::Integer>(inMatrix.numRows());
+        const auto      lda   = std::max(n, 1);
+        detail::Integer info  = 0;
+        detail::dpotrf_(&UPPER, &n, inMatrix.data(), &lda, &info, 1);
+        detail::checkArguments(info, "dpotrf");
+        if (info > 0)
+        {
+            THROW_RUNTIME_ERROR("Matrix is not positive definite.");
+        }
+
+        for (uint32 row = 0; row < inMatrix.numRows(); ++row)
+        {
+            for (uint32 col = row + 1; col < inMatrix.numCols(); ++col)
+            {
+                inMatrix(row, col) = 0.;
+            }
+        }
+
+        return inMatrix;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Singular value decomposition A = U * diag(s) * V^T by divide and conquer.
+    /// LAPACK decomposes A^T = U' * diag(s) * V'^T, so U is V' and V is U'.
+    ///
+    /// @param inMatrix: m x n matrix
+    /// @param outU: m x m, m x min(m, n) when thin, empty for values only
+    /// @param outS: 1 x min(m, n), descending
+    /// @param outV: n x n, n x min(m, n) when thin, empty for values only
+    /// @param inMode: the singular vectors to compute
+    ///
+    inline void svd(NdArray<double>  inMatrix,
+                    NdArray<double>& outU,
+                    NdArray<double>& outS,
+                    NdArray<double>& outV,
+                    SVDMode          inMode = SVDMode::FULL)
+    {
+        const auto m = inMatrix.numRows();
+        const auto n = inMatrix.numCols();
+        const auto k = std::min(m, n);
+
+        // LAPACK's view of the row-major m x n matrix is n x m
+        const auto rows = static_cast<detail::Integer>(n);
+        const auto cols = static_cast<detail::Integer>(m);
+        const auto lda  = std::max(rows, 1);
+
+        char jobz   = 'A';
+        auto uPrime = NdArray<double>(n, n);
+        outU        = NdArray<double>(m, m);
+        if (inMode == SVDMode::THIN)
+        {
+            jobz   = 'S';
+            uPrime = NdArray<double>(k, n);
+            outU   = NdArray<double>(m, k);
+        }
+        else if (inMode == SVDMode::VALUES)
+        {
+            jobz   = 'N';
+            uPrime = NdArray<double>(1, 1);
+            outU   = NdArray<double>(1, 1);
+        }
+        outS = NdArray<double>(1, k);
+
+        const auto ldu  = inMode == SVDMode::VALUES ? static_cast<detail::Integer>(1) : lda;
+        const auto ldvt = std::max(static_cast<detail::Integer>(inMode == SVDMode::THIN ? k : m), 1);
+
+        std::vector<detail::Integer> iwork(8 * static_cast<std::size_t>(k));
+        detail::Integer              workQuery = -1;
+        double                       workSize  = 0.;
+        detail::Integer              info      = 0;
+        detail::dgesdd_(&jobz,
+                        &rows,
+                        &cols,
+                        inMatrix.data(),
+                        &lda,
+                        outS.data(),
+                        uPrime.data(),
+                        &ldu,
+                        outU.data(),
+                        &ldvt,
+                        &workSize,
+                        &workQuery,
+                        iwork.data(),
+                        &info,
+                        1);
+        detail::checkArguments(info, "dgesdd");
+
+        const auto          lwork = std::max(static_cast<detail::Integer>(workSize), 1);
+        std::vector<double> work(static_cast<std::size_t>(lwork));
+        detail::dgesdd_(&jobz,
+                        &rows,
+                        &cols,
+                        inMatrix.data(),
+                        &lda,
+                        outS.data(),
+                        uPrime.data(),
+                        &ldu,
+                        outU.data(),
+                        &ldvt,
+                        work.data(),
+                        &lwork,
+                        iwork.data(),
+                        &info,
+                        1);
+        detail::checkArguments(info, "dgesdd");
+        if (info > 0)
+        {
+            THROW_RUNTIME_ERROR("SVD did not converge.");
+        }
+
+        if (inMode == SVDMode::VALUES)
+        {
+            outU = NdArray<double>{};
+            outV = NdArray<double>{};
+            return;
+        }
+
+        // V'^T in column-major order is V' in row-major order, U' needs the transpose
+        outV = uPrime.transpose();
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Eigen values and vectors of a real symmetric matrix by divide and conquer
+    ///
+    /// @param inMatrix: symmetric n x n matrix
+    /// @param computeVectors: whether to compute the eigen vectors
+    /// @param numLargest: the number of largest eigen values returned, 0 for all
+    ///
+    /// @return eigen values (1 x k, descending) and eigen vectors (the n x k columns, empty
+    ///         unless computeVectors)
+    ///
+    inline std::pair<NdArray<double>, NdArray<double>>
+        eigh(NdArray<double> inMatrix, bool computeVectors = true, uint32 numLargest = 0)
+    {
+        const auto n     = inMatrix.numRows();
+        const auto k     = numLargest == 0 ? n : std::min(numLargest, n);
+        const auto order = static_cast<detail::Integer>(n);
+        const auto lda   = std::max(order, 1);
+
+        auto                eigenValues = NdArray<double>(1, k);
+        std::vector<double> ascending(n);
+
+        const char      VECTORS         = computeVectors ? 'V' : 'N';
+        constexpr char  LOWER           = 'L';
+        detail::Integer workQuery       = -1;
+        double          workSize        = 0.;
+        detail::Integer integerWorkSize = 0;
+        detail::Integer info            = 0;
+        detail::dsyevd_(&VECTORS,
+                        &LOWER,
+                        &order,
+                        inMatrix.data(),
+                        &lda,
+                        ascending.data(),
+                        &workSize,
+                        &workQuery,
+                        &integerWorkSize,
+                        &workQuery,
+                        &info,
+                        1,
+                        1);
+        detail::checkArguments(info, "dsyevd");
+
+        const auto                   lwork  = std::max(static_cast<detail::Integer>(workSize), 1);
+        const auto                   liwork = std::max(integerWorkSize, 1);
+        std::vector<double>          work(static_cast<std::size_t>(lwork));
+        std::vector<detail::Integer> iwork(static_cast<std::size_t>(liwork));
+        detail::dsyevd_(&VECTORS,
+                        &LOWER,
+                        &order,
+                        inMatrix.data(),
+                        &lda,
+                        ascending.data(),
+                        work.data(),
+                        &lwork,
+                        iwork.data(),
+                        &liwork,
+                        &info,
+                        1,
+                        1);
+        detail::checkArguments(info, "dsyevd");
+        if (info > 0)
+        {
+            THROW_RUNTIME_ERROR("Eigen decomposition did not converge.");
+        }
+
+        // the eigen vectors are the column-major columns, which are the rows of inMatrix
+        NdArray<double> eigenVectors;
+        if (computeVectors)
+        {
+            eigenVectors = NdArray<double>(n, k);
+        }
+
+        for (uint32 col = 0; col < k; ++col)
+        {
+            const auto source = n - 1 - col;
+            eigenValues[col]  = ascending[source];
+            for (uint32 row = 0; row < n && computeVectors; ++row)
+            {
+                eigenVectors(row, col) = inMatrix(source, row);
+            }
+        }
+
+        return std::make_pair(eigenValues, eigenVectors);
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Minimum norm least squares solution of A X = B through a complete orthogonal
+    /// factorization of A with column pivoting
+    ///
+    /// @param inA: m x n coefficient matrix
+    /// @param inB: m x k right hand sides
+    ///
+    /// @return X, n x k
+    ///
+    inline NdArray<double> lstsq(const NdArray<double>& inA, const NdArray<double>& inB)
+    {
+        const auto m    = inA.numRows();
+        const auto n    = inA.numCols();
+        const auto nrhs = inB.numCols();
+
+        // the transpose of the row-major A is column-major A, and B is copied into a column-major
+        // block tall enough to hold X
+        auto       a    = inA.transpose();
+        const auto rows = static_cast<detail::Integer>(m);
+        const auto cols = static_cast<detail::Integer>(n);
+        const auto k    = static_cast<detail::Integer>(nrhs);
+        const auto lda  = std::max(rows, 1);
+        const auto ldb  = std::max({ rows, cols, 1 });
+
+        std::vector<double> b(static_cast<std::size_t>(ldb) * nrhs, 0.);
+        for (uint32 col = 0; col < nrhs; ++col)
+        {
+            for (uint32 row = 0; row < m; ++row)
+            {
+                b[static_cast<std::size_t>(col) * ldb + row] = inB(row, col);
+            }
+        }
+
+        std::vector<detail::Integer> pivots(n, 0);
+        const double                 rcond     = std::max(m, n) * std::numeric_limits<double>::epsilon();
+        detail::Integer              rank      = 0;
+        detail::Integer              workQuery = -1;
+        double                       workSize  = 0.;
+        detail::Integer              info      = 0;
+        detail::dgelsy_(&rows,
+                        &cols,
+                        &k,
+                        a.data(),
+                        &lda,
+                        b.data(),
+                        &ldb,
+                        pivots.data(),
+                        &rcond,
+                        &rank,
+                        &workSize,
+                        &workQuery,
+                        &info);
+        detail::checkArguments(info, "dgelsy");
+
+        const auto          lwork = std::max(static_cast<detail::Integer>(workSize), 1);
+        std::vector<double> work(static_cast<std::size_t>(lwork));
+        detail::dgelsy_(&rows,
+                        &cols,
+                        &k,
+                        a.data(),
+                        &lda,
+                        b.data(),
+                        &ldb,
+                        pivots.data(),
+                        &rcond,
+                        &rank,
+                        work.data(),
+                        &lwork,
+                        &info);
+        detail::checkArguments(info, "dgelsy");
+
+        auto x = NdArray<double>(n, nrhs);
+        for (uint32 row = 0; row < n; ++row)
+        {
+            for (uint32 col = 0; col < nrhs; ++col)
+            {
+                x(row, col) = b[static_cast<std::size_t>(col) * ldb + row];
+            }
+        }
+
+        return x;
+    }
+} // namespace nc::linalg::lapack
+
+#endif // #ifdef NUMCPP_USE_LAPACK
@@ -28,7 +28,8 @@
 #pragma once
 
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
-#include "NumCpp/Linalg/svd/SVD.hpp"
+#include "NumCpp/Linalg/lapack/Lapack.hpp"
+#include "NumCpp/Linalg/qr/QR.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::linalg
@@ -42,7 +43,10 @@ namespace nc::linalg
     /// be less than, equal to, or greater than its number of
     /// linearly independent columns). If a is square and of
     /// full rank, then x (but for round-off error) is the
-    /// "exact" solution of the equation.
+    /// "exact" solution of the equation. The solution of minimum
+    /// norm is returned when a is rank deficient or the system is
+    /// under determined. Computed from the column pivoted QR
+    /// factorization of a, so every column of b is solved at once.
     ///
     /// SciPy Reference:
     /// https://docs.scipy.org/doc/scipy/reference/generated/scipy.linalg.lstsq.html#scipy.linalg.lstsq
@@ -71,24 +75,16 @@ namespace nc::linalg
             THROW_INVALID_ARGUMENT_ERROR("Invalid matrix dimensions");
         }
 
-        SVD svd(inA.template astype<double>());
-
+        auto b = inB.template astype<double>();
         if (bIsFlat)
         {
-            return svd.lstsq(inB.template astype<double>());
-        }
-
-        const auto bCast     = inB.template astype<double>();
-        const auto bRowSlice = bCast.rSlice();
-
-        auto       result         = NdArray<double>(aShape.cols, bShape.cols);
-        const auto resultRowSlice = result.rSlice();
-
-        for (uint32 col = 0; col < bShape.cols; ++col)
-        {
-            result.put(resultRowSlice, col, svd.lstsq(bCast(bRowSlice, col)));
+            b.reshape(bShape.size(), 1);
         }
 
-        return result;
+#ifdef NUMCPP_USE_LAPACK
+        return lapack::lstsq(inA.template astype<double>(), b);
+#else
+        return QR<dtype>(inA, true).lstsq(b);
+#endif
     }
 } // namespace nc::linalg
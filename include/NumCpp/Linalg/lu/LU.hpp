@@ -0,0 +1,259 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// LU factorization with reusable solves
+///
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/Functions/eye.hpp"
+#include "NumCpp/Linalg/lu/luFactor.hpp"
+#include "NumCpp/Linalg/lu/triangularSolve.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::linalg
+{
+    // =============================================================================
+    // Class Description:
+    /// LU factorization with partial pivoting, PA = LU, of a square matrix. The matrix is
+    /// factored once, in place and blocked, and can then be solved against any number of
+    /// right hand sides in O(n^2) each.
+    template<typename dtype>
+    class LU
+    {
+    public:
+        STATIC_ASSERT_ARITHMETIC(dtype);
+
+        // =============================================================================
+        // Description:
+        /// Constructor
+        ///
+        /// @param inMatrix: square matrix to factor
+        ///
+        explicit LU(const NdArray<dtype>& inMatrix) :
+            factors_(inMatrix.template astype<double>())
+        {
+            if (!inMatrix.shape().issquare())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input matrix must be square.");
+            }
+
+            singular_ = detail::luFactor(factors_, pivots_);
+        }
+
+        // =============================================================================
+        // Description:
+        /// L below the diagonal, with its unit diagonal implied, and U on and above it
+        ///
+        /// @return NdArray
+        ///
+        const NdArray<double>& factors() const noexcept
+        {
+            return factors_;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the row interchanges, at step k row k was swapped with row pivots()[k]
+        ///
+        /// @return std::vector
+        ///
+        const std::vector<uint32>& pivots() const noexcept
+        {
+            return pivots_;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the unit lower triangular factor
+        ///
+        /// @return NdArray
+        ///
+        NdArray<double> l() const
+        {
+            const uint32    n = factors_.numRows();
+            NdArray<double> lower(n, n);
+            for (uint32 row = 0; row < n; ++row)
+            {
+                for (uint32 col = 0; col < n; ++col)
+                {
+                    lower(row, col) = col < row ? factors_(row, col) : (col == row ? 1. : 0.);
+                }
+            }
+
+            return lower;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the upper triangular factor
+        ///
+        /// @return NdArray
+        ///
+        NdArray<double> u() const
+        {
+            const uint32    n = factors_.numRows();
+            NdArray<double> upper(n, n);
+            for (uint32 row = 0; row < n; ++row)
+            {
+                for (uint32 col = 0; col < n; ++col)
+                {
+                    upper(row, col) = col >= row ? factors_(row, col) : 0.;
+                }
+            }
+
+            return upper;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the permutation matrix P of PA = LU
+        ///
+        /// @return NdArray
+        ///
+        NdArray<double> p() const
+        {
+            auto permutation = eye<double>(factors_.numRows());
+            permute(permutation);
+            return permutation;
+        }
+
+        // =============================================================================
+        // Description:
+        /// whether the matrix is singular
+        ///
+        /// @return bool
+        ///
+        bool issingular() const noexcept
+        {
+            return singular_;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the determinant of the matrix
+        ///
+        /// @return double
+        ///
+        double det() const
+        {
+            if (singular_)
+            {
+                return 0.;
+            }
+
+            double determinant = 1.;
+            for (uint32 i = 0; i < factors_.numRows(); ++i)
+            {
+                determinant *= factors_(i, i);
+                if (pivots_[i] != i)
+                {
+                    determinant = -determinant;
+                }
+            }
+
+            return determinant;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the inverse of the matrix
+        ///
+        /// @return NdArray
+        ///
+        NdArray<double> inverse() const
+        {
+            return solve(eye<double>(factors_.numRows()));
+        }
+
+        // =============================================================================
+        // Description:
+        /// Solves A X = B for every column of B at once
+        ///
+        /// @param inB: n x k right hand sides, or a flat array of size n
+        ///
+        /// @return NdArray with the shape of inB
+        ///
+        NdArray<double> solve(const NdArray<double>& inB) const
+        {
+            const uint32 n = factors_.numRows();
+            if (inB.numRows() != n && !(inB.isflat() && inB.size() == n))
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input array b must have as many rows as the matrix.");
+            }
+
+            if (singular_)
+            {
+                THROW_RUNTIME_ERROR("matrix is singular.");
+            }
+
+            auto result = inB.copy();
+            if (result.numRows() != n)
+            {
+                result.reshape(n, 1);
+            }
+            const auto numRhs = result.numCols();
+
+            permute(result);
+
+            const auto& factors = factors_;
+            const auto  element = [&factors](uint32 row, uint32 col) { return factors(row, col); };
+            detail::solveTriangular(element, n, true, true, result.data(), numRhs);
+            detail::solveTriangular(element, n, false, false, result.data(), numRhs);
+
+            result.reshape(inB.shape());
+            return result;
+        }
+
+    private:
+        NdArray<double>     factors_{};
+        std::vector<uint32> pivots_{};
+        bool                singular_{ false };
+
+        // =============================================================================
+        // Description:
+        /// applies the row interchanges to the rows of inOutArray
+        ///
+        /// @param inOutArray
+        ///
+        void permute(NdArray<double>& inOutArray) const
+        {
+            const uint32 numCols = inOutArray.numCols();
+            for (uint32 row = 0; row < factors_.numRows(); ++row)
+            {
+                if (pivots_[row] != row)
+                {
+                    std::swap_ranges(&inOutArray(row, 0), &inOutArray(row, 0) + numCols, &inOutArray(pivots_[row], 0));
+                }
+            }
+        }
+    };
+} // namespace nc::linalg
@@ -0,0 +1,188 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Blocked LU factorization with partial pivoting
+///
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/Gemm.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::linalg::detail
+{
+    /// Column panel width of the blocked LU factorization
+    constexpr uint32 LU_BLOCK_SIZE = 64;
+
+    /// Rows of the trailing matrix updated per gemm::multiply call, bounds the workspace
+    constexpr uint32 LU_UPDATE_ROWS = 256;
+
+    //============================================================================
+    // Method Description:
+    /// LU factors a square matrix in place with partial pivoting, PA = LU. The columns are
+    /// factored in panels of LU_BLOCK_SIZE: each panel is eliminated unblocked, the block
+    /// row to its right is solved against the panel's unit lower triangle, and the trailing
+    /// matrix is updated with the cache blocked gemm::multiply, which is where O(n^3) of
+    /// the work is done. A column without a nonzero pivot is left as is, so the
+    /// factorization of a singular matrix still completes with a zero on the diagonal.
+    ///
+    /// @param inOutMatrix: square matrix, overwritten with L below the diagonal (its unit
+    ///                     diagonal is implied) and U on and above it
+    /// @param outPivots: at step k row k was swapped with row outPivots[k]
+    ///
+    /// @return true if the matrix is singular
+    ///
+    inline bool luFactor(NdArray<double>& inOutMatrix, std::vector<uint32>& outPivots)
+    {
+        if (!inOutMatrix.shape().issquare())
+        {
+            THROW_INVALID_ARGUMENT_ERROR("input matrix must be square.");
+        }
+
+        const uint32 n        = inOutMatrix.numRows();
+        double*      a        = inOutMatrix.data();
+        bool         singular = false;
+        outPivots.resize(n);
+
+        const auto element = [a, n](uint32 row, uint32 col) -> double&
+        { return a[static_cast<std::size_t>(row) * n + col]; };
+
+        std::vector<double> negL21;
+        std::vector<double> u12;
+        std::vector<double> a22;
+
+        for (uint32 k0 = 0; k0 < n; k0 += LU_BLOCK_SIZE)
+        {
+            const uint32 kEnd = std::min(k0 + LU_BLOCK_SIZE, n);
+
+            // unblocked elimination of the panel, rows are swapped across the whole matrix
+            for (uint32 k = k0; k < kEnd; ++k)
+            {
+                uint32 pivot    = k;
+                double maxValue = std::abs(element(k, k));
+                for (uint32 row = k + 1; row < n; ++row)
+                {
+                    const double value = std::abs(element(row, k));
+                    if (value > maxValue)
+                    {
+                        maxValue = value;
+                        pivot    = row;
+                    }
+                }
+
+                outPivots[k] = pivot;
+                if (!(maxValue > 0.))
+                {
+                    singular = true;
+                    continue;
+                }
+
+                if (pivot != k)
+                {
+                    std::swap_ranges(&element(k, 0), &element(k, 0) + n, &element(pivot, 0));
+                }
+
+                // dividing rather than scaling by the reciprocal keeps the multiplier of a row
+                // equal to the pivot row at exactly one, so that duplicated rows cancel to zero
+                const double pivotValue = element(k, k);
+                for (uint32 row = k + 1; row < n; ++row)
+                {
+                    const double* pivotRow = &element(k, 0);
+                    double*       thisRow  = &element(row, 0);
+                    thisRow[k] /= pivotValue;
+                    const double multiplier = thisRow[k];
+                    for (uint32 col = k + 1; col < kEnd; ++col)
+                    {
+                        thisRow[col] -= multiplier * pivotRow[col];
+                    }
+                }
+            }
+
+            if (kEnd == n)
+            {
+                break;
+            }
+
+            // U12 = L11^-1 * A12
+            const uint32 numCols = n - kEnd;
+            for (uint32 k = k0; k < kEnd; ++k)
+            {
+                const double* pivotRow = &element(k, kEnd);
+                for (uint32 row = k + 1; row < kEnd; ++row)
+                {
+                    const double multiplier = element(row, k);
+                    double*      thisRow    = &element(row, kEnd);
+                    for (uint32 col = 0; col < numCols; ++col)
+                    {
+                        thisRow[col] -= multiplier * pivotRow[col];
+                    }
+                }
+            }
+
+            // A22 -= L21 * U12, in row chunks so the workspace stays bounded
+            const uint32 panelWidth = kEnd - k0;
+            u12.resize(static_cast<std::size_t>(panelWidth) * numCols);
+            for (uint32 k = 0; k < panelWidth; ++k)
+            {
+                std::copy_n(&element(k0 + k, kEnd), numCols, u12.begin() + static_cast<std::ptrdiff_t>(k) * numCols);
+            }
+
+            for (uint32 row0 = kEnd; row0 < n; row0 += LU_UPDATE_ROWS)
+            {
+                const uint32 numRows = std::min(LU_UPDATE_ROWS, n - row0);
+                negL21.resize(static_cast<std::size_t>(numRows) * panelWidth);
+                a22.resize(static_cast<std::size_t>(numRows) * numCols);
+                for (uint32 row = 0; row < numRows; ++row)
+                {
+                    const double* l21Row = &element(row0 + row, k0);
+                    std::transform(l21Row,
+                                   l21Row + panelWidth,
+                                   negL21.begin() + static_cast<std::ptrdiff_t>(row) * panelWidth,
+                                   [](double value) { return -value; });
+                    std::copy_n(&element(row0 + row, kEnd),
+                                numCols,
+                                a22.begin() + static_cast<std::ptrdiff_t>(row) * numCols);
+                }
+
+                gemm::multiply(numRows, numCols, panelWidth, negL21.data(), u12.data(), a22.data());
+
+                for (uint32 row = 0; row < numRows; ++row)
+                {
+                    std::copy_n(a22.begin() + static_cast<std::ptrdiff_t>(row) * numCols,
+                                numCols,
+                                &element(row0 + row, kEnd));
+                }
+            }
+        }
+
+        return singular;
+    }
+} // namespace nc::linalg::detail
@@ -0,0 +1,134 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Blocked triangular solves with multiple right hand sides
+///
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Gemm.hpp"
+#include "NumCpp/Core/Types.hpp"
+
+namespace nc::linalg::detail
+{
+    /// Rows of the right hand sides solved per diagonal block
+    constexpr uint32 TRIANGULAR_BLOCK_SIZE = 64;
+
+    //============================================================================
+    // Method Description:
+    /// Solves T X = B in place for a triangular T and a row-major n x numRhs B. The
+    /// diagonal blocks of T are solved with row operations on whole rows of B, and the
+    /// rows not yet solved are updated with one gemm::multiply per block, which streams
+    /// B through the cache once per block instead of once per row.
+    ///
+    /// @param triangle: triangle(row, col) returns element (row, col) of T, only the
+    ///                  triangle selected by lower is read
+    /// @param n: the order of T
+    /// @param lower: whether T is lower or upper triangular
+    /// @param unitDiagonal: whether the diagonal of T is implied to be ones
+    /// @param b: the right hand sides, overwritten with X
+    /// @param numRhs: the number of right hand sides
+    ///
+    template<typename Triangle>
+    void solveTriangular(const Triangle& triangle, uint32 n, bool lower, bool unitDiagonal, double* b, uint32 numRhs)
+    {
+        if (n == 0 || numRhs == 0)
+        {
+            return;
+        }
+
+        const auto rowOf = [b, numRhs](uint32 row) { return b + static_cast<std::size_t>(row) * numRhs; };
+
+        const auto solveRow = [&](uint32 row, uint32 first, uint32 last)
+        {
+            double* thisRow = rowOf(row);
+            for (uint32 col = first; col < last; ++col)
+            {
+                const double  factor   = triangle(row, col);
+                const double* otherRow = rowOf(col);
+                for (uint32 rhs = 0; rhs < numRhs; ++rhs)
+                {
+                    thisRow[rhs] -= factor * otherRow[rhs];
+                }
+            }
+
+            if (!unitDiagonal)
+            {
+                const double inverseDiagonal = 1. / triangle(row, row);
+                for (uint32 rhs = 0; rhs < numRhs; ++rhs)
+                {
+                    thisRow[rhs] *= inverseDiagonal;
+                }
+            }
+        };
+
+        std::vector<double> packed;
+        const uint32        numBlocks = (n + TRIANGULAR_BLOCK_SIZE - 1) / TRIANGULAR_BLOCK_SIZE;
+        for (uint32 block = 0; block < numBlocks; ++block)
+        {
+            // lower triangles are solved top down, upper triangles bottom up
+            const uint32 blockIndex = lower ? block : numBlocks - 1 - block;
+            const uint32 first      = blockIndex * TRIANGULAR_BLOCK_SIZE;
+            const uint32 last       = std::min(first + TRIANGULAR_BLOCK_SIZE, n);
+            const uint32 blockSize  = last - first;
+
+            if (lower)
+            {
+                for (uint32 row = first; row < last; ++row)
+                {
+                    solveRow(row, first, row);
+                }
+            }
+            else
+            {
+                for (uint32 row = last; row-- > first;)
+                {
+                    solveRow(row, row + 1, last);
+                }
+            }
+
+            // the rows still to be solved lose the contribution of this block
+            const uint32 updateFirst = lower ? last : 0;
+            const uint32 updateRows  = lower ? n - last : first;
+            if (updateRows == 0)
+            {
+                continue;
+            }
+
+            packed.resize(static_cast<std::size_t>(updateRows) * blockSize);
+            for (uint32 row = 0; row < updateRows; ++row)
+            {
+                for (uint32 col = 0; col < blockSize; ++col)
+                {
+                    packed[static_cast<std::size_t>(row) * blockSize + col] = -triangle(updateFirst + row, first + col);
+                }
+            }
+
+            gemm::multiply(updateRows, numRhs, blockSize, packed.data(), rowOf(first), rowOf(updateFirst));
+        }
+    }
+} // namespace nc::linalg::detail
@@ -29,6 +29,7 @@
 
 #include <string>
 
+#include "NumCpp/Core/Enums.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Linalg/svd/SVD.hpp"
@@ -50,6 +51,6 @@ namespace nc::linalg
     {
         STATIC_ASSERT_ARITHMETIC_OR_COMPLEX(dtype);
 
-        return SVD{ inArray }.pinv();
+        return SVD{ inArray, SVDMode::THIN }.pinv();
     }
 } // namespace nc::linalg
@@ -0,0 +1,922 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Householder QR factorization with reusable least squares solves
+///
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/Gemm.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/Functions/eye.hpp"
+#include "NumCpp/Linalg/lu/triangularSolve.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::linalg
+{
+    namespace detail
+    {
+        /// Column panel width of the blocked QR factorization
+        constexpr uint32 QR_BLOCK_SIZE = 32;
+    } // namespace detail
+
+    // =============================================================================
+    // Class Description:
+    /// Householder QR factorization, A = Q * R, of an m x n matrix. The columns are factored
+    /// in panels whose reflectors are accumulated into the compact WY form
+    /// I - V * T * V.transpose(), so that both the trailing matrix and any right hand sides
+    /// are updated with the cache blocked gemm::multiply rather than one reflector at a time.
+    /// With column pivoting, A * P = Q * R, the column of largest remaining norm is moved
+    /// to the front at every step, so the diagonal of R decreases in magnitude and reveals
+    /// the numerical rank; the trailing matrix is then updated one reflector at a time.
+    /// The workspace of the factorization is kept between calls and that of the const
+    /// member functions is per thread, so that refactor() and the solves into caller
+    /// provided arrays do not allocate once sized for a shape.
+    template<typename dtype>
+    class QR
+    {
+    public:
+        STATIC_ASSERT_ARITHMETIC(dtype);
+
+        // =============================================================================
+        // Description:
+        /// Constructor, an empty factorization for refactor() to fill
+        ///
+        /// @param inPivoting: whether to pivot the columns, default false
+        ///
+        explicit QR(bool inPivoting = false) noexcept :
+            pivoting_(inPivoting)
+        {
+        }
+
+        // =============================================================================
+        // Description:
+        /// Constructor
+        ///
+        /// @param inMatrix: matrix to factor
+        /// @param inPivoting: whether to pivot the columns, default false
+        ///
+        explicit QR(const NdArray<dtype>& inMatrix, bool inPivoting = false) :
+            factors_(inMatrix.template astype<double>()),
+            pivoting_(inPivoting)
+        {
+            factor();
+        }
+
+        // =============================================================================
+        // Description:
+        /// Factors another matrix, reusing the storage and workspace of the current
+        /// factorization when the shapes match, for iterative solvers that refactor a matrix
+        /// every iteration
+        ///
+        /// @param inMatrix: matrix to factor
+        ///
+        void refactor(const NdArray<dtype>& inMatrix)
+        {
+            if (inMatrix.shape() == factors_.shape())
+            {
+                std::transform(inMatrix.begin(),
+                               inMatrix.end(),
+                               factors_.begin(),
+                               [](dtype value) { return static_cast<double>(value); });
+            }
+            else
+            {
+                factors_ = inMatrix.template astype<double>();
+            }
+
+            factor();
+        }
+
+        // =============================================================================
+        // Description:
+        /// R on and above the diagonal and the Householder vectors below it, whose leading
+        /// ones are implied
+        ///
+        /// @return NdArray
+        ///
+        const NdArray<double>& factors() const noexcept
+        {
+            return factors_;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the column interchanges, column j of A * P is column permutation()[j] of A
+        ///
+        /// @return std::vector
+        ///
+        const std::vector<uint32>& permutation() const noexcept
+        {
+            return permutation_;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the permutation matrix P of A * P = Q * R, the identity without pivoting
+        ///
+        /// @return NdArray
+        ///
+        NdArray<double> p() const
+        {
+            const auto      numCols = static_cast<uint32>(permutation_.size());
+            NdArray<double> result(numCols, numCols);
+            result.zeros();
+            for (uint32 col = 0; col < numCols; ++col)
+            {
+                result(permutation_[col], col) = 1.;
+            }
+
+            return result;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the numerical rank, the number of diagonal elements of R larger than
+        /// max(m, n) * epsilon times the largest, only reliable with column pivoting
+        ///
+        /// @return uint32
+        ///
+        uint32 rank() const
+        {
+            const auto k = static_cast<uint32>(tau_.size());
+
+            double maxDiagonal = 0.;
+            for (uint32 i = 0; i < k; ++i)
+            {
+                maxDiagonal = std::max(maxDiagonal, std::abs(factors_(i, i)));
+            }
+
+            const double tolerance = maxDiagonal * std::max(factors_.numRows(), factors_.numCols()) *
+                                     std::numeric_limits<double>::epsilon();
+            uint32       result    = 0;
+            for (uint32 i = 0; i < k; ++i)
+            {
+                result += std::abs(factors_(i, i)) > tolerance ? 1 : 0;
+            }
+
+            return result;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the reduced orthonormal factor, m x min(m, n)
+        ///
+        /// @return NdArray
+        ///
+        NdArray<double> q() const
+        {
+            const uint32    numRows = factors_.numRows();
+            const uint32    k       = std::min(numRows, factors_.numCols());
+            NdArray<double> result(numRows, k);
+            result.zeros();
+            for (uint32 i = 0; i < k; ++i)
+            {
+                result(i, i) = 1.;
+            }
+
+            applyQ(result);
+            return result;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the reduced upper triangular factor, min(m, n) x n
+        ///
+        /// @return NdArray
+        ///
+        NdArray<double> r() const
+        {
+            const uint32    numCols = factors_.numCols();
+            const uint32    k       = std::min(factors_.numRows(), numCols);
+            NdArray<double> result(k, numCols);
+            for (uint32 row = 0; row < k; ++row)
+            {
+                for (uint32 col = 0; col < numCols; ++col)
+                {
+                    result(row, col) = col >= row ? factors_(row, col) : 0.;
+                }
+            }
+
+            return result;
+        }
+
+        // =============================================================================
+        // Description:
+        /// Overwrites B with Q.transpose() * B, where Q is the full m x m orthogonal factor
+        ///
+        /// @param inOutB: m x k array
+        ///
+        void applyQTranspose(NdArray<double>& inOutB) const
+        {
+            checkRows(inOutB);
+            for (uint32 panel = 0; panel < panelFirst_.size(); ++panel)
+            {
+                applyPanel(panel, true, inOutB.data(), inOutB.numCols());
+            }
+        }
+
+        // =============================================================================
+        // Description:
+        /// Overwrites B with Q * B, where Q is the full m x m orthogonal factor
+        ///
+        /// @param inOutB: m x k array
+        ///
+        void applyQ(NdArray<double>& inOutB) const
+        {
+            checkRows(inOutB);
+            for (auto panel = static_cast<uint32>(panelFirst_.size()); panel-- > 0;)
+            {
+                applyPanel(panel, false, inOutB.data(), inOutB.numCols());
+            }
+        }
+
+        // =============================================================================
+        // Description:
+        /// the determinant of a square matrix
+        ///
+        /// @return double
+        ///
+        double det() const
+        {
+            if (!factors_.shape().issquare())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input matrix must be square.");
+            }
+
+            double determinant = 1.;
+            for (uint32 i = 0; i < factors_.numRows(); ++i)
+            {
+                determinant *= factors_(i, i);
+
+                // every nontrivial Householder reflector has determinant -1
+                if (tau_[i] > 0.)
+                {
+                    determinant = -determinant;
+                }
+            }
+
+            // and so does every column interchange, one fewer per cycle than its length
+            std::vector<bool> visited(permutation_.size(), false);
+            for (uint32 start = 0; start < permutation_.size(); ++start)
+            {
+                for (uint32 col = permutation_[start]; !visited[start] && col != start; col = permutation_[col])
+                {
+                    visited[col] = true;
+                    determinant  = -determinant;
+                }
+                visited[start] = true;
+            }
+
+            return determinant;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the inverse of a square matrix
+        ///
+        /// @return NdArray
+        ///
+        NdArray<double> inverse() const
+        {
+            if (!factors_.shape().issquare())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input matrix must be square.");
+            }
+
+            return solve(eye<double>(factors_.numRows()));
+        }
+
+        // =============================================================================
+        // Description:
+        /// Solves the least squares problem min ||A X - B|| for every column of B at once,
+        /// which is the exact solution when A is square. Requires m >= n and A of full
+        /// column rank, see lstsq() for rank deficient and under determined systems.
+        ///
+        /// @param inB: m x k right hand sides, or a flat array of size m
+        ///
+        /// @return NdArray n x k, or flat of size n when inB is flat
+        ///
+        NdArray<double> solve(const NdArray<double>& inB) const
+        {
+            NdArray<double> result;
+            solve(inB, result);
+            return result;
+        }
+
+        // =============================================================================
+        // Description:
+        /// solve() into a caller provided array, whose storage is reused when it already
+        /// has the size of the solution
+        ///
+        /// @param inB: m x k right hand sides, or a flat array of size m
+        /// @param outX: the solution, n x k, or flat of size n when inB is flat
+        ///
+        void solve(const NdArray<double>& inB, NdArray<double>& outX) const
+        {
+            const uint32 numRows = factors_.numRows();
+            const uint32 numCols = factors_.numCols();
+            if (numRows < numCols)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input matrix must have at least as many rows as columns.");
+            }
+
+            checkRhs(inB);
+
+            double maxDiagonal = 0.;
+            for (uint32 i = 0; i < numCols; ++i)
+            {
+                maxDiagonal = std::max(maxDiagonal, std::abs(factors_(i, i)));
+            }
+
+            const double tolerance = maxDiagonal * numRows * std::numeric_limits<double>::epsilon();
+            for (uint32 i = 0; i < numCols; ++i)
+            {
+                if (!(std::abs(factors_(i, i)) > tolerance))
+                {
+                    THROW_RUNTIME_ERROR("matrix is rank deficient.");
+                }
+            }
+
+            const Shape solutionShape = solutionShapeFor(inB);
+            const auto& qTb           = loadRhs(inB);
+
+            const uint32 numRhs = qTb.numCols();
+            resize(outX, numCols, numRhs);
+            std::copy_n(qTb.data(), outX.size(), outX.data());
+
+            const auto& factors = factors_;
+            detail::solveTriangular([&factors](uint32 row, uint32 col) { return factors(row, col); },
+                                    numCols,
+                                    false,
+                                    false,
+                                    outX.data(),
+                                    numRhs);
+            unpermute(outX);
+            outX.reshape(solutionShape);
+        }
+
+        // =============================================================================
+        // Description:
+        /// Solves the least squares problem min ||A X - B|| for every column of B at once,
+        /// returning the solution of minimum norm when the system is under determined or A
+        /// is rank deficient. The leading rank() rows of R, [R11 R12], are factored once
+        /// more from the right into a triangle and an orthogonal matrix, the complete
+        /// orthogonal decomposition, so use the pivoted factorization when A may be rank
+        /// deficient.
+        ///
+        /// @param inB: m x k right hand sides, or a flat array of size m
+        ///
+        /// @return NdArray n x k, or flat of size n when inB is flat
+        ///
+        NdArray<double> lstsq(const NdArray<double>& inB) const
+        {
+            NdArray<double> result;
+            lstsq(inB, result);
+            return result;
+        }
+
+        // =============================================================================
+        // Description:
+        /// lstsq() into a caller provided array, whose storage is reused when it already
+        /// has the size of the solution
+        ///
+        /// @param inB: m x k right hand sides, or a flat array of size m
+        /// @param outX: the solution, n x k, or flat of size n when inB is flat
+        ///
+        void lstsq(const NdArray<double>& inB, NdArray<double>& outX) const
+        {
+            const uint32 numCols = factors_.numCols();
+            const uint32 r       = rank();
+            if (r == numCols)
+            {
+                solve(inB, outX);
+                return;
+            }
+
+            checkRhs(inB);
+            const Shape solutionShape = solutionShapeFor(inB);
+            const auto& qTb           = loadRhs(inB);
+
+            // [R11 R12].transpose() = Z * S, so [R11 R12] * y = c is S.transpose() * Z.transpose() * y = c
+            // and its minimum norm solution is y = Z * [S.transpose()^-1 * c, 0]
+            const uint32 numRhs = qTb.numCols();
+            resize(outX, numCols, numRhs);
+            outX.zeros();
+            if (r > 0)
+            {
+                // the complete orthogonal factor, per thread so that its workspace is reused
+                thread_local NdArray<double> leadingT;
+                thread_local QR<double>      complete;
+
+                resize(leadingT, numCols, r);
+                for (uint32 row = 0; row < r; ++row)
+                {
+                    for (uint32 col = 0; col < numCols; ++col)
+                    {
+                        leadingT(col, row) = col >= row ? factors_(row, col) : 0.;
+                    }
+                }
+                complete.refactor(leadingT);
+
+                const auto& s = complete.factors();
+                std::copy_n(qTb.data(), static_cast<std::size_t>(r) * numRhs, outX.data());
+                detail::solveTriangular([&s](uint32 row, uint32 col) { return s(col, row); },
+                                        r,
+                                        true,
+                                        false,
+                                        outX.data(),
+                                        numRhs);
+                complete.applyQ(outX);
+            }
+            unpermute(outX);
+            outX.reshape(solutionShape);
+        }
+
+    private:
+        NdArray<double>                  factors_{};
+        bool                             pivoting_{ false };
+        std::vector<uint32>              permutation_{};
+        std::vector<double>              tau_{};
+        std::vector<uint32>              panelFirst_{};
+        std::vector<std::vector<double>> panelT_{};
+
+        // factorization workspace
+        std::vector<double> reflectorWork_{};
+        std::vector<double> columnNorms_{};
+        std::vector<double> referenceNorms_{};
+        std::vector<double> gram_{};
+        std::vector<double> gramRow_{};
+
+        // =============================================================================
+        // Description:
+        /// gives an array the shape numRows x numCols, reallocating only when its size changes
+        ///
+        /// @param inOutArray
+        /// @param numRows
+        /// @param numCols
+        ///
+        static void resize(NdArray<double>& inOutArray, uint32 numRows, uint32 numCols)
+        {
+            if (inOutArray.size() != numRows * numCols)
+            {
+                inOutArray = NdArray<double>(numRows, numCols);
+            }
+            else
+            {
+                inOutArray.reshape(numRows, numCols);
+            }
+        }
+
+        // =============================================================================
+        // Description:
+        /// throws unless the right hand sides have as many rows as the factored matrix
+        ///
+        /// @param inB
+        ///
+        void checkRhs(const NdArray<double>& inB) const
+        {
+            const uint32 numRows = factors_.numRows();
+            if (inB.numRows() != numRows && !(inB.isflat() && inB.size() == numRows))
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input array b must have as many rows as the matrix.");
+            }
+        }
+
+        // =============================================================================
+        // Description:
+        /// the shape of the solution for the right hand sides inB
+        ///
+        /// @param inB
+        /// @return Shape
+        ///
+        Shape solutionShapeFor(const NdArray<double>& inB) const
+        {
+            const uint32 numCols = factors_.numCols();
+            if (inB.numRows() == factors_.numRows())
+            {
+                return { numCols, inB.numCols() };
+            }
+
+            return inB.numRows() == 1 ? Shape(1, numCols) : Shape(numCols, 1);
+        }
+
+        // =============================================================================
+        // Description:
+        /// copies the right hand sides into the per thread m x k workspace and applies
+        /// Q.transpose()
+        ///
+        /// @param inB: m x k array, or a flat array of size m
+        /// @return Q.transpose() * B, valid until the next call on the same thread
+        ///
+        const NdArray<double>& loadRhs(const NdArray<double>& inB) const
+        {
+            thread_local NdArray<double> qTb;
+
+            const uint32 numRows = factors_.numRows();
+            resize(qTb, numRows, inB.size() / std::max(numRows, 1u));
+            std::copy(inB.begin(), inB.end(), qTb.begin());
+            applyQTranspose(qTb);
+            return qTb;
+        }
+
+        // =============================================================================
+        // Description:
+        /// throws unless inArray has as many rows as the factored matrix
+        ///
+        /// @param inArray
+        ///
+        void checkRows(const NdArray<double>& inArray) const
+        {
+            if (inArray.numRows() != factors_.numRows())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("input array must have as many rows as the matrix.");
+            }
+        }
+
+        // =============================================================================
+        // Description:
+        /// reorders the rows of a solution of the pivoted system A * P, y, into x = P * y
+        ///
+        /// @param inOutSolution: n x k array
+        ///
+        void unpermute(NdArray<double>& inOutSolution) const
+        {
+            if (!pivoting_)
+            {
+                return;
+            }
+
+            thread_local std::vector<double> unpermuted;
+
+            const auto numRhs = inOutSolution.numCols();
+            unpermuted.assign(inOutSolution.begin(), inOutSolution.end());
+            for (uint32 row = 0; row < permutation_.size(); ++row)
+            {
+                std::copy_n(unpermuted.begin() + static_cast<std::ptrdiff_t>(row) * numRhs,
+                            numRhs,
+                            &inOutSolution(permutation_[row], 0));
+            }
+        }
+
+        // =============================================================================
+        // Description:
+        /// factors the matrix in place, one panel at a time
+        ///
+        void factor()
+        {
+            const uint32 numRows = factors_.numRows();
+            const uint32 numCols = factors_.numCols();
+            const uint32 k       = std::min(numRows, numCols);
+            double*      a       = factors_.data();
+            tau_.assign(k, 0.);
+            panelFirst_.clear();
+            panelT_.resize((k + detail::QR_BLOCK_SIZE - 1) / detail::QR_BLOCK_SIZE);
+            permutation_.resize(numCols);
+            std::iota(permutation_.begin(), permutation_.end(), 0);
+
+            // with pivoting every reflection updates all of the remaining columns at once, so
+            // that their norms are current when the next pivot is chosen
+            auto& w = reflectorWork_;
+            w.resize(pivoting_ ? numCols : detail::QR_BLOCK_SIZE);
+            if (pivoting_)
+            {
+                columnNorms_.assign(numCols, 0.);
+                for (uint32 row = 0; row < numRows; ++row)
+                {
+                    const double* aRow = a + static_cast<std::size_t>(row) * numCols;
+                    for (uint32 col = 0; col < numCols; ++col)
+                    {
+                        columnNorms_[col] += aRow[col] * aRow[col];
+                    }
+                }
+                std::transform(columnNorms_.begin(),
+                               columnNorms_.end(),
+                               columnNorms_.begin(),
+                               [](double value) { return std::sqrt(value); });
+                referenceNorms_ = columnNorms_;
+            }
+
+            for (uint32 first = 0; first < k; first += detail::QR_BLOCK_SIZE)
+            {
+                const uint32 last       = std::min(first + detail::QR_BLOCK_SIZE, k);
+                const uint32 updateLast = pivoting_ ? numCols : last;
+
+                // unblocked Householder reflections of the panel columns, each applied to
+                // the rest of the panel with two passes over the rows
+                for (uint32 col = first; col < last; ++col)
+                {
+                    if (pivoting_)
+                    {
+                        pivot(col);
+                    }
+
+                    reflect(col);
+                    const uint32 numOthers = updateLast - col - 1;
+                    if (!(tau_[col] > 0.) || numOthers == 0)
+                    {
+                        continue;
+                    }
+
+                    // w = tau * v.transpose() * A(col:, col + 1:updateLast)
+                    std::fill_n(w.begin(), numOthers, 0.);
+                    for (uint32 row = col; row < numRows; ++row)
+                    {
+                        const double  v    = row == col ? 1. : a[static_cast<std::size_t>(row) * numCols + col];
+                        const double* aRow = a + static_cast<std::size_t>(row) * numCols + col + 1;
+                        for (uint32 other = 0; other < numOthers; ++other)
+                        {
+                            w[other] += v * aRow[other];
+                        }
+                    }
+                    const double tau = tau_[col];
+                    std::transform(w.begin(),
+                                   w.begin() + numOthers,
+                                   w.begin(),
+                                   [tau](double value) { return value * tau; });
+
+                    for (uint32 row = col; row < numRows; ++row)
+                    {
+                        const double v    = row == col ? 1. : a[static_cast<std::size_t>(row) * numCols + col];
+                        double*      aRow = a + static_cast<std::size_t>(row) * numCols + col + 1;
+                        for (uint32 other = 0; other < numOthers; ++other)
+                        {
+                            aRow[other] -= v * w[other];
+                        }
+                    }
+                }
+
+                panelFirst_.push_back(first);
+                formT(first, last, panelT_[panelFirst_.size() - 1]);
+
+                if (updateLast < numCols)
+                {
+                    const auto panel = static_cast<uint32>(panelFirst_.size() - 1);
+                    applyPanel(panel, true, &factors_(0, last), numCols - last, numCols);
+                }
+            }
+        }
+
+        // =============================================================================
+        // Description:
+        /// Downdates the norms of the remaining columns below row col, then swaps the one
+        /// of largest norm into column col. A norm that has lost too many digits to
+        /// cancellation is recomputed from the column.
+        ///
+        /// @param col
+        ///
+        void pivot(uint32 col)
+        {
+            auto& norms          = columnNorms_;
+            auto& referenceNorms = referenceNorms_;
+
+            const uint32 numRows = factors_.numRows();
+            const uint32 numCols = factors_.numCols();
+            const double limit   = std::sqrt(std::numeric_limits<double>::epsilon());
+
+            for (uint32 other = col; other < numCols && col > 0; ++other)
+            {
+                if (!(norms[other] > 0.))
+                {
+                    continue;
+                }
+
+                // the row just factored no longer counts toward the norm
+                const double ratio     = std::abs(factors_(col - 1, other)) / norms[other];
+                const double remaining = std::max(0., (1. - ratio) * (1. + ratio));
+                const double relative  = norms[other] / referenceNorms[other];
+                if (remaining * relative * relative > limit)
+                {
+                    norms[other] *= std::sqrt(remaining);
+                }
+                else
+                {
+                    double norm = 0.;
+                    for (uint32 row = col; row < numRows; ++row)
+                    {
+                        norm = std::hypot(norm, factors_(row, other));
+                    }
+                    norms[other]          = norm;
+                    referenceNorms[other] = norm;
+                }
+            }
+
+            const auto best = static_cast<uint32>(
+                std::max_element(norms.begin() + col, norms.end()) - norms.begin());
+            if (best != col)
+            {
+                for (uint32 row = 0; row < numRows; ++row)
+                {
+                    std::swap(factors_(row, col), factors_(row, best));
+                }
+                std::swap(norms[col], norms[best]);
+                std::swap(referenceNorms[col], referenceNorms[best]);
+                std::swap(permutation_[col], permutation_[best]);
+            }
+        }
+
+        // =============================================================================
+        // Description:
+        /// replaces column col below the diagonal with a Householder vector that zeros it
+        ///
+        /// @param col
+        ///
+        void reflect(uint32 col)
+        {
+            const uint32 numRows = factors_.numRows();
+            double       norm    = 0.;
+            for (uint32 row = col + 1; row < numRows; ++row)
+            {
+                norm = std::hypot(norm, factors_(row, col));
+            }
+
+            const double alpha = factors_(col, col);
+            if (!(norm > 0.))
+            {
+                tau_[col] = 0.;
+                return;
+            }
+
+            const double beta  = alpha >= 0. ? -std::hypot(alpha, norm) : std::hypot(alpha, norm);
+            tau_[col]          = (beta - alpha) / beta;
+            const double scale = 1. / (alpha - beta);
+            for (uint32 row = col + 1; row < numRows; ++row)
+            {
+                factors_(row, col) *= scale;
+            }
+            factors_(col, col) = beta;
+        }
+
+        // =============================================================================
+        // Description:
+        /// the upper triangular T of the panel's compact WY form, H(first) ... H(last - 1) =
+        /// I - V * T * V.transpose()
+        ///
+        /// @param first: first column of the panel
+        /// @param last: one past the last column of the panel
+        /// @param outT: row major T
+        ///
+        void formT(uint32 first, uint32 last, std::vector<double>& outT)
+        {
+            const uint32 numRows = factors_.numRows();
+            const uint32 width   = last - first;
+            auto&        t       = outT;
+            auto&        gram    = gram_;
+            auto&        v       = gramRow_;
+            t.assign(static_cast<std::size_t>(width) * width, 0.);
+            gram.assign(static_cast<std::size_t>(width) * width, 0.);
+            v.resize(width);
+
+            // gram = V.transpose() * V, upper triangle, in one pass over the rows
+            for (uint32 row = first; row < numRows; ++row)
+            {
+                const uint32 numV = std::min(row - first + 1, width);
+                for (uint32 j = 0; j < numV; ++j)
+                {
+                    v[j] = first + j == row ? 1. : factors_(row, first + j);
+                }
+
+                for (uint32 i = 0; i < numV; ++i)
+                {
+                    double* gramRow = &gram[static_cast<std::size_t>(i) * width];
+                    for (uint32 j = i + 1; j < numV; ++j)
+                    {
+                        gramRow[j] += v[i] * v[j];
+                    }
+                }
+            }
+
+            for (uint32 j = 0; j < width; ++j)
+            {
+                // T(0:j, j) = -tau(j) * T(0:j, 0:j) * V(:, 0:j).transpose() * V(:, j)
+                for (uint32 i = 0; i < j; ++i)
+                {
+                    const double* tRow  = &t[static_cast<std::size_t>(i) * width];
+                    double        value = 0.;
+                    for (uint32 p = i; p < j; ++p)
+                    {
+                        value += tRow[p] * gram[static_cast<std::size_t>(p) * width + j];
+                    }
+                    t[static_cast<std::size_t>(i) * width + j] = -tau_[first + j] * value;
+                }
+                t[static_cast<std::size_t>(j) * width + j] = tau_[first + j];
+            }
+        }
+
+        // =============================================================================
+        // Description:
+        /// applies a panel's block reflector I - V * T * V.transpose(), or its transpose, to
+        /// the rows of a row major m x numRhs array: C -= V * (T or T.transpose()) * (V.transpose() * C)
+        ///
+        /// @param panel: index of the panel
+        /// @param transpose: whether to apply the transpose
+        /// @param c: first element of the array
+        /// @param numRhs: number of columns of the array
+        /// @param stride: distance between the array's rows, defaults to numRhs
+        ///
+        void applyPanel(uint32 panel, bool transpose, double* c, uint32 numRhs, uint32 stride = 0) const
+        {
+            if (numRhs == 0)
+            {
+                return;
+            }
+
+            stride                 = stride == 0 ? numRhs : stride;
+            const uint32 numRows   = factors_.numRows();
+            const uint32 first     = panelFirst_[panel];
+            const uint32 width     = std::min(first + detail::QR_BLOCK_SIZE, static_cast<uint32>(tau_.size())) - first;
+            const uint32 panelRows = numRows - first;
+            const auto&  t         = panelT_[panel];
+
+            // per thread workspace, applyPanel is shared by the factorization and the const solves
+            thread_local std::vector<double> v;
+            thread_local std::vector<double> vT;
+            thread_local std::vector<double> block;
+            thread_local std::vector<double> w;
+            thread_local std::vector<double> tW;
+
+            // the panel's unit lower trapezoidal V, packed row major and transposed
+            v.assign(static_cast<std::size_t>(panelRows) * width, 0.);
+            vT.assign(static_cast<std::size_t>(width) * panelRows, 0.);
+            for (uint32 row = 0; row < panelRows; ++row)
+            {
+                for (uint32 j = 0; j < width && j <= row; ++j)
+                {
+                    const double value = j == row ? 1. : factors_(first + row, first + j);
+                    v[static_cast<std::size_t>(row) * width + j]      = -value;
+                    vT[static_cast<std::size_t>(j) * panelRows + row] = value;
+                }
+            }
+
+            block.resize(static_cast<std::size_t>(panelRows) * numRhs);
+            for (uint32 row = 0; row < panelRows; ++row)
+            {
+                std::copy_n(c + static_cast<std::size_t>(first + row) * stride,
+                            numRhs,
+                            block.begin() + static_cast<std::ptrdiff_t>(row) * numRhs);
+            }
+
+            // W = V.transpose() * C
+            w.assign(static_cast<std::size_t>(width) * numRhs, 0.);
+            gemm::multiply(width, numRhs, panelRows, vT.data(), block.data(), w.data());
+
+            // W = T * W or T.transpose() * W, T is upper triangular
+            tW.assign(w.size(), 0.);
+            for (uint32 i = 0; i < width; ++i)
+            {
+                double*      outRow = &tW[static_cast<std::size_t>(i) * numRhs];
+                const uint32 pFirst = transpose ? 0 : i;
+                const uint32 pLast  = transpose ? i + 1 : width;
+                for (uint32 p = pFirst; p < pLast; ++p)
+                {
+                    const double  factor = transpose ? t[static_cast<std::size_t>(p) * width + i]
+                                                     : t[static_cast<std::size_t>(i) * width + p];
+                    const double* wRow   = &w[static_cast<std::size_t>(p) * numRhs];
+                    for (uint32 rhs = 0; rhs < numRhs; ++rhs)
+                    {
+                        outRow[rhs] += factor * wRow[rhs];
+                    }
+                }
+            }
+
+            // C -= V * W
+            gemm::multiply(panelRows, numRhs, width, v.data(), tW.data(), block.data());
+
+            for (uint32 row = 0; row < panelRows; ++row)
+            {
+                std::copy_n(block.begin() + static_cast<std::ptrdiff_t>(row) * numRhs,
+                            numRhs,
+                            c + static_cast<std::size_t>(first + row) * stride);
+            }
+        }
+    };
+} // namespace nc::linalg
@@ -0,0 +1,313 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// sign and natural log of the matrix determinant.
+///
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/Linalg/det.hpp"
+#include "NumCpp/Linalg/lu/luFactor.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::linalg
+{
+    namespace detail
+    {
+        /// Below this Hadamard bound (in bits) every minor of an integer matrix, and every
+        /// closed form sum, fits in the integer Bareiss determinant
+        constexpr double EXACT_DET_BITS = 4. * sizeof(BareissProduct) - 4.;
+
+        /// The most modular eliminations spent proving an integer matrix singular
+        constexpr uint32 MAX_SINGULAR_PRIMES = 16;
+
+        //============================================================================
+        // Method Description:
+        /// log2 of the Hadamard bound of a matrix, the product of its row norms, which
+        /// bounds the magnitude of every minor of an integer matrix
+        ///
+        /// @param inArray: square matrix
+        /// @return bound in bits, -inf if a row is zero
+        ///
+        template<typename dtype>
+        double hadamardBits(const NdArray<dtype>& inArray)
+        {
+            double bits = 0.;
+            for (uint32 row = 0; row < inArray.numRows(); ++row)
+            {
+                double normSquared = 0.;
+                for (uint32 col = 0; col < inArray.numCols(); ++col)
+                {
+                    const auto value = static_cast<double>(inArray(row, col));
+                    normSquared += value * value;
+                }
+
+                bits += 0.5 * std::log2(normSquared);
+            }
+
+            return bits;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Trial division primality test
+        ///
+        /// @param value: odd value
+        /// @return true if value is prime
+        ///
+        inline bool isOddPrime(uint64 value) noexcept
+        {
+            for (uint64 divisor = 3; divisor * divisor <= value; divisor += 2)
+            {
+                if (value % divisor == 0)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// base^exponent modulo a prime below 2^31
+        ///
+        /// @param base
+        /// @param exponent
+        /// @param prime
+        /// @return power
+        ///
+        inline uint64 powerModulo(uint64 base, uint64 exponent, uint64 prime) noexcept
+        {
+            uint64 result = 1;
+            while (exponent > 0)
+            {
+                if ((exponent & 1) != 0)
+                {
+                    result = result * base % prime;
+                }
+
+                base = base * base % prime;
+                exponent >>= 1;
+            }
+
+            return result;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Whether the determinant of an integer matrix is divisible by a prime below 2^31,
+        /// by Gaussian elimination over the integers modulo the prime
+        ///
+        /// @param inArray: square matrix
+        /// @param prime
+        /// @param workspace: inArray.size() elements
+        /// @return true if the determinant is zero modulo the prime
+        ///
+        template<typename dtype>
+        bool singularModulo(const NdArray<dtype>& inArray, uint64 prime, std::vector<uint64>& workspace)
+        {
+            const uint32 order = inArray.numRows();
+            std::transform(inArray.begin(),
+                           inArray.end(),
+                           workspace.begin(),
+                           [prime](dtype value) -> uint64
+                           {
+                               if constexpr (std::is_signed_v<dtype>)
+                               {
+                                   const auto modulus  = static_cast<int64>(prime);
+                                   const auto residual = static_cast<int64>(value) % modulus;
+                                   return static_cast<uint64>(residual < 0 ? residual + modulus : residual);
+                               }
+                               else
+                               {
+                                   return static_cast<uint64>(value) % prime;
+                               }
+                           });
+
+            const auto element = [&workspace, order](uint32 row, uint32 col) -> uint64&
+            { return workspace[static_cast<std::size_t>(row) * order + col]; };
+
+            for (uint32 k = 0; k < order; ++k)
+            {
+                uint32 pivotRow = k;
+                while (pivotRow < order && element(pivotRow, k) == 0)
+                {
+                    ++pivotRow;
+                }
+
+                if (pivotRow == order)
+                {
+                    return true;
+                }
+
+                if (pivotRow != k)
+                {
+                    std::swap_ranges(&element(k, 0), &element(k, 0) + order, &element(pivotRow, 0));
+                }
+
+                const uint64 inverse = powerModulo(element(k, k), prime - 2, prime);
+                for (uint32 row = k + 1; row < order; ++row)
+                {
+                    const uint64 factor = element(row, k) * inverse % prime;
+                    if (factor == 0)
+                    {
+                        continue;
+                    }
+
+                    const uint64 negatedFactor = prime - factor;
+                    for (uint32 col = k + 1; col < order; ++col)
+                    {
+                        element(row, col) = (element(row, col) + negatedFactor * element(k, col)) % prime;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Exact singularity test of an integer matrix whose Hadamard bound is too large
+        /// for the Bareiss determinant. Reduces the determinant modulo primes below 2^31:
+        /// a nonzero residue proves it nonzero, and once the product of the primes exceeds
+        /// twice the Hadamard bound a zero residue for every one proves it zero. A nonsingular
+        /// matrix almost always stops at the first prime, a singular one needs an elimination
+        /// per 31 bits of the bound. The test gives up after MAX_SINGULAR_PRIMES O(n^3)
+        /// eliminations, so only bounds below about 495 bits are proven singular and larger
+        /// matrices are left to the floating point LU.
+        ///
+        /// @param inArray: square matrix
+        /// @param boundBits: log2 of the Hadamard bound of inArray
+        /// @return true if the matrix was proven singular
+        ///
+        template<typename dtype>
+        bool isSingularInteger(const NdArray<dtype>& inArray, double boundBits)
+        {
+            constexpr uint64 LARGEST_PRIME = (uint64{ 1 } << 31) - 1;
+
+            std::vector<uint64> workspace(inArray.size());
+            double              primeBits = 0.;
+            uint32              numPrimes = 0;
+            for (uint64 candidate = LARGEST_PRIME; primeBits <= boundBits + 1.; candidate -= 2)
+            {
+                if (!isOddPrime(candidate))
+                {
+                    continue;
+                }
+
+                if (numPrimes == MAX_SINGULAR_PRIMES || !singularModulo(inArray, candidate, workspace))
+                {
+                    return false;
+                }
+
+                primeBits += std::log2(static_cast<double>(candidate));
+                ++numPrimes;
+            }
+
+            return true;
+        }
+    } // namespace detail
+
+    //============================================================================
+    // Method Description:
+    /// sign and natural log of the absolute value of the matrix determinant. Sums the logs
+    /// of the LU pivots, so unlike det it neither overflows nor underflows for large matrices.
+    /// Integer matrices are decided exactly: from the Bareiss determinant while its minors
+    /// fit in an int64, otherwise singular or not by at most sixteen modular eliminations
+    /// before the LU gives the magnitude. A singular integer matrix whose Hadamard bound
+    /// exceeds about 495 bits is decided by the LU alone, like a floating point matrix.
+    ///
+    /// NumPy Reference: https://numpy.org/doc/stable/reference/generated/numpy.linalg.slogdet.html
+    ///
+    /// @param inArray
+    /// @return std::pair of the sign (1, -1, or 0 for a singular matrix) and the log of the
+    ///         absolute determinant (-inf for a singular matrix)
+    ///
+    template<typename dtype>
+    std::pair<double, double> slogdet(const NdArray<dtype>& inArray)
+    {
+        STATIC_ASSERT_ARITHMETIC(dtype);
+
+        if (!inArray.shape().issquare())
+        {
+            THROW_INVALID_ARGUMENT_ERROR("input array must be square.");
+        }
+
+        constexpr std::pair<double, double> SINGULAR{ 0., -std::numeric_limits<double>::infinity() };
+
+        if constexpr (std::is_integral_v<dtype>)
+        {
+            const double boundBits = detail::hadamardBits(inArray);
+            if (boundBits < detail::EXACT_DET_BITS)
+            {
+                const auto determinant = detail::det(inArray);
+                if (determinant == 0)
+                {
+                    return SINGULAR;
+                }
+
+                return { determinant < 0 ? -1. : 1., std::log(std::abs(static_cast<double>(determinant))) };
+            }
+
+            if (detail::isSingularInteger(inArray, boundBits))
+            {
+                return SINGULAR;
+            }
+        }
+
+        auto                matrix = inArray.template astype<double>();
+        std::vector<uint32> pivots;
+        if (detail::luFactor(matrix, pivots))
+        {
+            return SINGULAR;
+        }
+
+        double sign   = 1.;
+        double logDet = 0.;
+        for (uint32 i = 0; i < matrix.numRows(); ++i)
+        {
+            const double pivot = matrix(i, i);
+            if ((pivot < 0.) != (pivots[i] != i))
+            {
+                sign = -sign;
+            }
+
+            logDet += std::log(std::abs(pivot));
+        }
+
+        return { sign, logDet };
+    }
+} // namespace nc::linalg
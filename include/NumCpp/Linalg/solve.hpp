@@ -29,8 +29,8 @@
 
 #include "NumCpp/Core/Internal/Error.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
-#include "NumCpp/Functions/dot.hpp"
-#include "NumCpp/Linalg/inv.hpp"
+#include "NumCpp/Linalg/lapack/Lapack.hpp"
+#include "NumCpp/Linalg/lu/LU.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::linalg
@@ -67,6 +67,10 @@ namespace nc::linalg
             THROW_INVALID_ARGUMENT_ERROR("input array b size must be the same as the square size of a.");
         }
 
-        return dot(inv(inA), inB.template astype<double>().reshape(inB.size(), 1)).reshape(inB.shape());
+#ifdef NUMCPP_USE_LAPACK
+        return lapack::solve(inA.template astype<double>(), inB.template astype<double>());
+#else
+        return LU<dtype>(inA).solve(inB.template astype<double>());
+#endif
     }
 } // namespace nc::linalg
@@ -29,6 +29,7 @@
 
 #include <utility>
 
+#include "NumCpp/Core/Enums.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
 #include "NumCpp/Functions/diagflat.hpp"
 #include "NumCpp/Linalg/svd/SVD.hpp"
@@ -46,13 +47,19 @@ namespace nc::linalg
     /// @param outU: NdArray output U
     /// @param outS: NdArray output S
     /// @param outVT: NdArray output V transpose
+    /// @param inMode: FULL for the m x m U and n x n V transpose, THIN for only their first
+    ///                min(m, n) columns and rows, VALUES for empty U and V transpose (default FULL)
     ///
     template<typename dtype>
-    void svd(const NdArray<dtype>& inArray, NdArray<double>& outU, NdArray<double>& outS, NdArray<double>& outVT)
+    void svd(const NdArray<dtype>& inArray,
+             NdArray<double>&      outU,
+             NdArray<double>&      outS,
+             NdArray<double>&      outVT,
+             SVDMode               inMode = SVDMode::FULL)
     {
         STATIC_ASSERT_ARITHMETIC(dtype);
 
-        const auto svd = SVD{ inArray };
+        const auto svd = SVD{ inArray, inMode };
 
         outU  = svd.u();
         outS  = std::move(svd.s()[Slice(std::min(inArray.numRows(), inArray.numCols()))]);
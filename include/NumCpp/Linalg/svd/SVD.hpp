@@ -23,28 +23,35 @@
 /// DEALINGS IN THE SOFTWARE.
 ///
 /// Description
-/// Performs the singular value decomposition of a general matrix,
-/// taken and adapted from Numerical Recipes Third Edition svd.h
+/// Singular value decomposition of a general matrix by Householder bidiagonalization
+/// and the Golub-Kahan implicit shift QR iteration
 ///
 #pragma once
 
-#include <cmath>
-#include <limits>
-#include <string>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
+#include "NumCpp/Core/Enums.hpp"
 #include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Slice.hpp"
 #include "NumCpp/Core/Types.hpp"
 #include "NumCpp/Functions/dot.hpp"
-#include "NumCpp/Functions/norm.hpp"
-#include "NumCpp/Functions/zeros.hpp"
-#include "NumCpp/Linalg/eig.hpp"
+#include "NumCpp/Linalg/lapack/Lapack.hpp"
+#include "NumCpp/Linalg/qr/QR.hpp"
+#include "NumCpp/Linalg/svd/golubKahan.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::linalg
 {
     // =============================================================================
     // Class Description:
-    /// Performs the singular value decomposition of a general matrix
+    /// Performs the singular value decomposition of a general matrix, A = u * diag(s) * v.transpose().
+    /// The matrix is bidiagonalized with Householder reflections and diagonalized with the
+    /// Golub-Kahan implicit shift QR iteration, so A.transpose() * A is never formed and
+    /// the condition number is not squared. A tall matrix is first reduced to its square
+    /// triangular QR factor, and a wide one is decomposed through its transpose.
     template<typename dtype>
     class SVD
     {
@@ -58,10 +65,13 @@ namespace nc::linalg
         /// Constructor
         ///
         /// @param inMatrix: matrix to perform SVD on
+        /// @param inMode: FULL computes the m x m u and n x n v, THIN only their first min(m, n)
+        ///                columns, and VALUES only the singular values (default FULL)
         ///
-        explicit SVD(const NdArray<dtype>& inMatrix) :
+        explicit SVD(const NdArray<dtype>& inMatrix, SVDMode inMode = SVDMode::FULL) :
             m_{ inMatrix.shape().rows },
             n_{ inMatrix.shape().cols },
+            mode_{ inMode },
             s_(1, m_)
         {
             compute(inMatrix.template astype<double>());
@@ -69,7 +79,7 @@ namespace nc::linalg
 
         // =============================================================================
         // Description:
-        /// the resultant u matrix
+        /// the resultant u matrix, empty in VALUES mode
         ///
         /// @return u matrix
         ///
@@ -80,7 +90,7 @@ namespace nc::linalg
 
         // =============================================================================
         // Description:
-        /// the resultant v transpose matrix
+        /// the resultant v matrix, empty in VALUES mode
         ///
         /// @return v matrix
         ///
@@ -91,7 +101,7 @@ namespace nc::linalg
 
         // =============================================================================
         // Description:
-        /// the resultant w matrix
+        /// the resultant singular values, 1 x m in descending order and zero past min(m, n)
         ///
         /// @return s matrix
         ///
@@ -111,16 +121,8 @@ namespace nc::linalg
             // lazy evaluation
             if (pinv_.isempty())
             {
-                auto sInverse = nc::zeros<double>(n_, m_); // transpose
-                for (auto i = 0u; i < std::min(m_, n_); ++i)
-                {
-                    if (s_[i] > TOLERANCE)
-                    {
-                        sInverse(i, i) = 1. / s_[i];
-                    }
-                }
-
-                pinv_ = dot(v_, dot(sInverse, u_.transpose()));
+                checkVectors();
+                pinv_ = dot(scaledV(), leadingColumns(u_).transpose());
             }
 
             return pinv_;
@@ -128,27 +130,29 @@ namespace nc::linalg
 
         // =============================================================================
         // Description:
-        /// solves the linear least squares problem
+        /// solves the linear least squares problem for every column of the input at once
         ///
-        /// @param inInput
+        /// @param inInput: m x k, or a flat array of size m
         ///
-        /// @return NdArray
+        /// @return NdArray n x k, n x 1 for a flat input
         ///
         NdArray<double> lstsq(const NdArray<double>& inInput)
         {
-            if (inInput.size() != m_)
+            if (inInput.numRows() != m_ && inInput.size() != m_)
             {
                 THROW_INVALID_ARGUMENT_ERROR("Invalid matrix dimensions");
             }
 
-            if (inInput.numCols() == 1)
+            checkVectors();
+
+            if (inInput.numRows() == m_)
             {
-                return dot(pinv(), inInput);
+                return dot(scaledV(), dot(leadingColumns(u_).transpose(), inInput));
             }
             else
             {
                 const auto input = inInput.copy().reshape(inInput.size(), 1);
-                return dot(pinv(), input);
+                return dot(scaledV(), dot(leadingColumns(u_).transpose(), input));
             }
         }
 
@@ -161,59 +165,142 @@ namespace nc::linalg
         ///
         void compute(const NdArray<double>& A)
         {
-            const auto At  = A.transpose();
-            const auto AtA = dot(At, A);
-            const auto AAt = dot(A, At);
+            s_.zeros();
 
-            const auto& [sigmaSquaredU, U] = eig(AAt);
-            const auto& [sigmaSquaredV, V] = eig(AtA);
+#ifdef NUMCPP_USE_LAPACK
+            auto singularValues = NdArray<double>{};
+            lapack::svd(A, u_, singularValues, v_, mode_);
+            std::copy(singularValues.begin(), singularValues.end(), s_.begin());
+#else
+            // decompose a matrix with at least as many rows as columns
+            const bool transposed = m_ < n_;
+            const auto work       = transposed ? A.transpose() : A;
+            const auto numRows    = work.numRows();
+            const auto numCols    = work.numCols();
 
-            auto rank = 0u;
-            for (auto i = 0u; i < std::min(m_, n_); ++i)
+            std::vector<double> values;
+            NdArray<double>     uWork;
+            NdArray<double>     vWork;
+            if (numRows > numCols)
             {
-                if (sigmaSquaredV[i] > TOLERANCE)
+                const QR<double> qr(work);
+                auto             r = qr.r();
+                decomposeSquare(r, values, uWork, vWork);
+
+                if (mode_ != SVDMode::VALUES)
                 {
-                    s_[i] = std::sqrt(sigmaSquaredV[i]);
-                    rank++;
+                    // u = Q * [uR 0; 0 I], of which THIN keeps the first columns
+                    NdArray<double> u(numRows, mode_ == SVDMode::FULL ? numRows : numCols);
+                    u.zeros();
+                    for (uint32 row = 0; row < numCols; ++row)
+                    {
+                        std::copy_n(&uWork(row, 0), numCols, &u(row, 0));
+                    }
+                    for (uint32 i = numCols; i < u.numCols(); ++i)
+                    {
+                        u(i, i) = 1.;
+                    }
+
+                    qr.applyQ(u);
+                    uWork = std::move(u);
                 }
             }
+            else
+            {
+                auto square = work.copy();
+                decomposeSquare(square, values, uWork, vWork);
+            }
 
-            // std::cout << U.front() << ' ' << U.back() << '\n';
-            // std::cout << V.front() << ' ' << V.back() << '\n';
-            // std::cout << "hello world\n";
+            std::copy(values.begin(), values.end(), s_.begin());
+            u_ = transposed ? std::move(vWork) : std::move(uWork);
+            v_ = transposed ? std::move(uWork) : std::move(vWork);
+#endif
+        }
 
-            u_ = std::move(U);
-            v_ = std::move(V);
+        // =============================================================================
+        // Description:
+        /// SVD of a square matrix
+        ///
+        /// @param inOutMatrix: destroyed
+        /// @param outValues: the singular values, descending
+        /// @param outU: left singular vectors, empty in VALUES mode
+        /// @param outV: right singular vectors, empty in VALUES mode
+        ///
+        void decomposeSquare(NdArray<double>&     inOutMatrix,
+                             std::vector<double>& outValues,
+                             NdArray<double>&     outU,
+                             NdArray<double>&     outV) const
+        {
+            std::vector<double> superDiagonal;
+            NdArray<double>     uT;
+            NdArray<double>     vT;
+            detail::bidiagonalize(inOutMatrix, outValues, superDiagonal, uT, vT, mode_ != SVDMode::VALUES);
+            detail::bidiagonalQR(outValues, superDiagonal, uT, vT);
 
-            auto Av = NdArray<double>(m_, 1);
-            for (auto i = 0u; i < rank; ++i)
+            if (mode_ != SVDMode::VALUES)
             {
-                for (auto j = 0u; j < m_; ++j)
-                {
-                    auto sum = 0.;
-                    for (auto k = 0u; k < n_; ++k)
-                    {
-                        sum += A(j, k) * v_(k, i);
-                    }
-                    Av[j] = sum;
-                }
+                outU = uT.transpose();
+                outV = vT.transpose();
+            }
+        }
 
-                const auto normalization = norm(Av).item();
+        // =============================================================================
+        // Description:
+        /// throws if the singular vectors were not computed
+        ///
+        void checkVectors() const
+        {
+            if (mode_ == SVDMode::VALUES)
+            {
+                THROW_RUNTIME_ERROR("singular vectors were not computed.");
+            }
+        }
+
+        // =============================================================================
+        // Description:
+        /// the first min(m, n) columns of a full or thin singular vector matrix
+        ///
+        /// @param inVectors
+        ///
+        /// @return NdArray
+        ///
+        NdArray<double> leadingColumns(const NdArray<double>& inVectors) const
+        {
+            const auto k = std::min(m_, n_);
+            if (inVectors.numCols() == k)
+            {
+                return inVectors;
+            }
 
-                if (normalization > TOLERANCE)
+            return inVectors(inVectors.rSlice(), Slice(k));
+        }
+
+        // =============================================================================
+        // Description:
+        /// v with each column divided by its singular value, and zeroed for the singular
+        /// values below TOLERANCE
+        ///
+        /// @return NdArray n x min(m, n)
+        ///
+        NdArray<double> scaledV() const
+        {
+            auto scaled = leadingColumns(v_);
+            for (uint32 row = 0; row < scaled.numRows(); ++row)
+            {
+                for (uint32 i = 0; i < scaled.numCols(); ++i)
                 {
-                    for (auto j = 0u; j < m_; ++j)
-                    {
-                        u_(j, i) = Av[j] / normalization;
-                    }
+                    scaled(row, i) = s_[i] > TOLERANCE ? scaled(row, i) / s_[i] : 0.;
                 }
             }
+
+            return scaled;
         }
 
     private:
         // ===============================Attributes====================================
         const uint32    m_{};
         const uint32    n_{};
+        const SVDMode   mode_{ SVDMode::FULL };
         NdArray<double> u_{};
         NdArray<double> v_{};
         NdArray<double> s_{};
@@ -0,0 +1,475 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Householder bidiagonalization and the Golub-Kahan implicit shift QR iteration
+///
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::linalg::detail
+{
+    /// Implicit shift QR sweeps allowed per singular value before giving up
+    constexpr uint32 GOLUB_KAHAN_MAX_SWEEPS = 75;
+
+    //============================================================================
+    // Method Description:
+    /// Householder reflector H = I - tau * v * v.transpose() with H * x = beta * e1. x is
+    /// overwritten with v, whose leading one is implied, and beta.
+    ///
+    /// @param x: first element of the vector
+    /// @param size: number of elements
+    /// @param stride: distance between the elements
+    ///
+    /// @return tau
+    ///
+    inline double householder(double* x, uint32 size, uint32 stride)
+    {
+        double norm = 0.;
+        for (uint32 i = 1; i < size; ++i)
+        {
+            norm = std::hypot(norm, x[static_cast<std::size_t>(i) * stride]);
+        }
+
+        if (!(norm > 0.))
+        {
+            return 0.;
+        }
+
+        const double alpha = x[0];
+        const double beta  = alpha >= 0. ? -std::hypot(alpha, norm) : std::hypot(alpha, norm);
+        const double scale = 1. / (alpha - beta);
+        for (uint32 i = 1; i < size; ++i)
+        {
+            x[static_cast<std::size_t>(i) * stride] *= scale;
+        }
+        x[0] = beta;
+
+        return (beta - alpha) / beta;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Accumulates the reflectors stored below the diagonal of reflectors, offset columns
+    /// to the left of it, into an explicit orthogonal matrix, Q = H(0) * H(1) * ...
+    ///
+    /// @param reflectors: n x n, reflector k is column k from row k + offset + 1 down
+    /// @param tau: the reflector scales
+    /// @param offset: 0 for column reflectors, 1 for the row reflectors of a transposed matrix
+    ///
+    /// @return Q
+    ///
+    inline NdArray<double> accumulateReflectors(const NdArray<double>& reflectors,
+                                                const std::vector<double>& tau,
+                                                uint32                     offset)
+    {
+        const uint32    n = reflectors.numRows();
+        NdArray<double> q(n, n);
+        q.zeros();
+        for (uint32 i = 0; i < n; ++i)
+        {
+            q(i, i) = 1.;
+        }
+
+        std::vector<double> w(n);
+        for (auto k = static_cast<uint32>(tau.size()); k-- > 0;)
+        {
+            if (!(std::abs(tau[k]) > 0.))
+            {
+                continue;
+            }
+
+            // rows and columns first..n of Q are touched by H(k)
+            const uint32 first = k + offset;
+            std::fill(w.begin() + first, w.end(), 0.);
+            for (uint32 row = first; row < n; ++row)
+            {
+                const double  v    = row == first ? 1. : reflectors(row, k);
+                const double* qRow = &q(row, 0);
+                for (uint32 col = first; col < n; ++col)
+                {
+                    w[col] += v * qRow[col];
+                }
+            }
+
+            for (uint32 row = first; row < n; ++row)
+            {
+                const double v    = (row == first ? 1. : reflectors(row, k)) * tau[k];
+                double*      qRow = &q(row, 0);
+                for (uint32 col = first; col < n; ++col)
+                {
+                    qRow[col] -= v * w[col];
+                }
+            }
+        }
+
+        return q;
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Reduces a square matrix to upper bidiagonal form with Householder reflections
+    /// from both sides, A = U * B * V.transpose()
+    ///
+    /// @param inOutMatrix: n x n matrix, overwritten with the reflectors
+    /// @param outDiagonal: the diagonal of B
+    /// @param outSuperDiagonal: the super diagonal of B
+    /// @param outUt: U.transpose(), left empty when computeVectors is false
+    /// @param outVt: V.transpose(), left empty when computeVectors is false
+    /// @param computeVectors: whether to accumulate U and V
+    ///
+    inline void bidiagonalize(NdArray<double>&     inOutMatrix,
+                              std::vector<double>& outDiagonal,
+                              std::vector<double>& outSuperDiagonal,
+                              NdArray<double>&     outUt,
+                              NdArray<double>&     outVt,
+                              bool                 computeVectors)
+    {
+        const uint32 n = inOutMatrix.numRows();
+        auto&        a = inOutMatrix;
+        outDiagonal.assign(n, 0.);
+        outSuperDiagonal.assign(n > 0 ? n - 1 : 0, 0.);
+
+        std::vector<double> tauLeft(n, 0.);
+        std::vector<double> tauRight(n, 0.);
+        std::vector<double> w(n);
+
+        for (uint32 k = 0; k < n; ++k)
+        {
+            // the left reflector zeros column k below the diagonal
+            tauLeft[k] = householder(&a(k, k), n - k, n);
+            if (std::abs(tauLeft[k]) > 0.)
+            {
+                std::fill(w.begin() + k + 1, w.end(), 0.);
+                for (uint32 row = k; row < n; ++row)
+                {
+                    const double  v    = row == k ? 1. : a(row, k);
+                    const double* aRow = &a(row, 0);
+                    for (uint32 col = k + 1; col < n; ++col)
+                    {
+                        w[col] += v * aRow[col];
+                    }
+                }
+
+                for (uint32 row = k; row < n; ++row)
+                {
+                    const double v    = (row == k ? 1. : a(row, k)) * tauLeft[k];
+                    double*      aRow = &a(row, 0);
+                    for (uint32 col = k + 1; col < n; ++col)
+                    {
+                        aRow[col] -= v * w[col];
+                    }
+                }
+            }
+            outDiagonal[k] = a(k, k);
+
+            if (k + 1 == n)
+            {
+                break;
+            }
+
+            // the right reflector zeros row k right of the super diagonal
+            tauRight[k] = householder(&a(k, k + 1), n - k - 1, 1);
+            if (std::abs(tauRight[k]) > 0.)
+            {
+                const double* v = &a(k, k + 1);
+                for (uint32 row = k + 1; row < n; ++row)
+                {
+                    double* aRow = &a(row, k + 1);
+                    double  dot  = aRow[0];
+                    for (uint32 col = 1; col < n - k - 1; ++col)
+                    {
+                        dot += aRow[col] * v[col];
+                    }
+
+                    dot *= tauRight[k];
+                    aRow[0] -= dot;
+                    for (uint32 col = 1; col < n - k - 1; ++col)
+                    {
+                        aRow[col] -= dot * v[col];
+                    }
+                }
+            }
+            outSuperDiagonal[k] = a(k, k + 1);
+        }
+
+        if (!computeVectors)
+        {
+            return;
+        }
+
+        outUt = accumulateReflectors(a, tauLeft, 0).transpose();
+
+        // the right reflectors are stored in the rows, transposed they are column reflectors
+        tauRight.resize(n > 1 ? n - 1 : 0);
+        outVt = accumulateReflectors(a.transpose(), tauRight, 1).transpose();
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Rotates rows i and j of a row major matrix, row i = c * row i + s * row j and
+    /// row j = c * row j - s * row i
+    ///
+    /// @param matrix: the matrix, nothing is done when it is empty
+    /// @param i
+    /// @param j
+    /// @param c
+    /// @param s
+    ///
+    inline void rotateRows(NdArray<double>& matrix, uint32 i, uint32 j, double c, double s)
+    {
+        if (matrix.isempty())
+        {
+            return;
+        }
+
+        double*      rowI    = &matrix(i, 0);
+        double*      rowJ    = &matrix(j, 0);
+        const uint32 numCols = matrix.numCols();
+        for (uint32 col = 0; col < numCols; ++col)
+        {
+            const double valueI = rowI[col];
+            rowI[col]           = c * valueI + s * rowJ[col];
+            rowJ[col]           = c * rowJ[col] - s * valueI;
+        }
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Diagonalizes an upper bidiagonal matrix B = U * S * V.transpose() with the Golub-Kahan
+    /// implicit shift QR iteration, and sorts the singular values into descending order.
+    /// The rotations are applied to the rows of Ut and Vt, which are kept transposed so
+    /// that each rotation streams two contiguous rows.
+    ///
+    /// @param inOutDiagonal: the diagonal of B, overwritten with the singular values
+    /// @param inOutSuperDiagonal: the super diagonal of B, destroyed
+    /// @param inOutUt: U.transpose() to rotate, may be empty
+    /// @param inOutVt: V.transpose() to rotate, may be empty
+    ///
+    inline void bidiagonalQR(std::vector<double>& inOutDiagonal,
+                             std::vector<double>& inOutSuperDiagonal,
+                             NdArray<double>&     inOutUt,
+                             NdArray<double>&     inOutVt)
+    {
+        auto&        d       = inOutDiagonal;
+        auto&        e       = inOutSuperDiagonal;
+        const auto   n       = static_cast<uint32>(d.size());
+        const double epsilon = std::numeric_limits<double>::epsilon();
+
+        double norm = 0.;
+        for (uint32 i = 0; i < n; ++i)
+        {
+            norm = std::max(norm, std::abs(d[i]) + (i + 1 < n ? std::abs(e[i]) : 0.));
+        }
+        const double negligible = epsilon * norm;
+
+        uint32       sweeps    = 0;
+        const uint32 maxSweeps = GOLUB_KAHAN_MAX_SWEEPS * std::max(n, 1u);
+        uint32       hi        = n > 0 ? n - 1 : 0;
+        while (hi > 0)
+        {
+            // deflate converged super diagonal elements from the bottom
+            if (!(std::abs(e[hi - 1]) > epsilon * (std::abs(d[hi - 1]) + std::abs(d[hi]))) ||
+                !(std::abs(e[hi - 1]) > negligible))
+            {
+                e[hi - 1] = 0.;
+                --hi;
+                continue;
+            }
+
+            // the unreduced block lo..hi
+            uint32 lo = hi - 1;
+            while (lo > 0)
+            {
+                if (!(std::abs(e[lo - 1]) > epsilon * (std::abs(d[lo - 1]) + std::abs(d[lo]))) ||
+                    !(std::abs(e[lo - 1]) > negligible))
+                {
+                    e[lo - 1] = 0.;
+                    break;
+                }
+                --lo;
+            }
+
+            if (++sweeps > maxSweeps)
+            {
+                THROW_RUNTIME_ERROR("SVD did not converge.");
+            }
+
+            // a zero on the diagonal splits the block once its row or column is rotated away
+            bool zeroDiagonal = false;
+            for (uint32 i = lo; i <= hi; ++i)
+            {
+                if (!(std::abs(d[i]) > negligible))
+                {
+                    d[i]         = 0.;
+                    zeroDiagonal = true;
+                    if (i < hi)
+                    {
+                        // chase e[i] along row i to the right with left rotations
+                        double bulge = e[i];
+                        e[i]        = 0.;
+                        for (uint32 j = i + 1; j <= hi; ++j)
+                        {
+                            const double r = std::hypot(d[j], bulge);
+                            const double c = d[j] / r;
+                            const double s = bulge / r;
+                            d[j]           = r;
+                            if (j < hi)
+                            {
+                                bulge = -s * e[j];
+                                e[j]  = c * e[j];
+                            }
+                            rotateRows(inOutUt, j, i, c, s);
+                        }
+                    }
+                    else
+                    {
+                        // chase e[hi - 1] up column hi with right rotations
+                        double bulge = e[hi - 1];
+                        e[hi - 1]    = 0.;
+                        for (uint32 j = hi; j-- > lo;)
+                        {
+                            const double r = std::hypot(d[j], bulge);
+                            const double c = d[j] / r;
+                            const double s = bulge / r;
+                            d[j]           = r;
+                            if (j > lo)
+                            {
+                                bulge    = -s * e[j - 1];
+                                e[j - 1] = c * e[j - 1];
+                            }
+                            rotateRows(inOutVt, j, hi, c, s);
+                        }
+                    }
+                    break;
+                }
+            }
+
+            if (zeroDiagonal)
+            {
+                continue;
+            }
+
+            // Wilkinson shift from the trailing 2 x 2 of B.transpose() * B
+            const double a     = d[hi - 1] * d[hi - 1] + (hi - 1 > lo ? e[hi - 2] * e[hi - 2] : 0.);
+            const double b     = d[hi - 1] * e[hi - 1];
+            const double c     = d[hi] * d[hi] + e[hi - 1] * e[hi - 1];
+            const double delta = (a - c) / 2.;
+            const double root  = std::hypot(delta, b);
+            const double shift = c - b * b / (delta >= 0. ? delta + root : delta - root);
+
+            double y = d[lo] * d[lo] - shift;
+            double z = d[lo] * e[lo];
+            for (uint32 k = lo; k < hi; ++k)
+            {
+                // the right rotation zeros z, and creates a bulge below the diagonal
+                double r  = std::hypot(y, z);
+                double cs = y / r;
+                double sn = z / r;
+                if (k > lo)
+                {
+                    e[k - 1] = r;
+                }
+
+                const double dk    = d[k];
+                const double bulge = sn * d[k + 1];
+                d[k]               = cs * dk + sn * e[k];
+                e[k]               = cs * e[k] - sn * dk;
+                d[k + 1]           = cs * d[k + 1];
+                rotateRows(inOutVt, k, k + 1, cs, sn);
+
+                // the left rotation zeros the bulge, and creates one right of the super diagonal
+                r    = std::hypot(d[k], bulge);
+                cs   = d[k] / r;
+                sn   = bulge / r;
+                d[k] = r;
+
+                const double ek = e[k];
+                e[k]            = cs * ek + sn * d[k + 1];
+                d[k + 1]        = cs * d[k + 1] - sn * ek;
+                rotateRows(inOutUt, k, k + 1, cs, sn);
+
+                if (k + 1 < hi)
+                {
+                    y        = e[k];
+                    z        = sn * e[k + 1];
+                    e[k + 1] = cs * e[k + 1];
+                }
+            }
+        }
+
+        // nonnegative singular values in descending order
+        for (uint32 i = 0; i < n; ++i)
+        {
+            if (d[i] < 0.)
+            {
+                d[i] = -d[i];
+                if (!inOutVt.isempty())
+                {
+                    double* row = &inOutVt(i, 0);
+                    std::transform(row, row + inOutVt.numCols(), row, [](double value) { return -value; });
+                }
+            }
+        }
+
+        std::vector<uint32> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&d](uint32 i, uint32 j) { return d[i] > d[j]; });
+
+        const auto permute = [&order, n](NdArray<double>& matrix)
+        {
+            if (matrix.isempty())
+            {
+                return;
+            }
+
+            NdArray<double> sorted(matrix.shape());
+            const uint32    numCols = matrix.numCols();
+            for (uint32 i = 0; i < n; ++i)
+            {
+                std::copy_n(&matrix(order[i], 0), numCols, &sorted(i, 0));
+            }
+            matrix = std::move(sorted);
+        };
+
+        std::vector<double> sortedDiagonal(n);
+        for (uint32 i = 0; i < n; ++i)
+        {
+            sortedDiagonal[i] = d[order[i]];
+        }
+        d = std::move(sortedDiagonal);
+        permute(inOutUt);
+        permute(inOutVt);
+    }
+} // namespace nc::linalg::detail
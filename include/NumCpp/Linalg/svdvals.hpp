@@ -27,10 +27,12 @@
 ///
 #pragma once
 
-#include <utility>
+#include <algorithm>
 
+#include "NumCpp/Core/Enums.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
-#include "NumCpp/Linalg/svd.hpp"
+#include "NumCpp/Core/Slice.hpp"
+#include "NumCpp/Linalg/svd/SVD.hpp"
 #include "NumCpp/NdArray.hpp"
 
 namespace nc::linalg
@@ -50,12 +52,7 @@ namespace nc::linalg
     {
         STATIC_ASSERT_ARITHMETIC(dtype);
 
-        auto u  = NdArray<double>{};
-        auto s  = NdArray<double>{};
-        auto vT = NdArray<double>{};
-
-        svd(inArray, u, s, vT);
-
-        return s;
+        const auto svd = SVD{ inArray, SVDMode::VALUES };
+        return svd.s()[Slice(std::min(inArray.numRows(), inArray.numCols()))];
     }
 } // namespace nc::linalg
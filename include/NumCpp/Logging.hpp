@@ -27,5 +27,7 @@
 ///
 #pragma once
 
+#include "NumCpp/Logging/BinaryLogFormat.hpp"
+#include "NumCpp/Logging/BinaryLogReader.hpp"
 #include "NumCpp/Logging/BinaryLogger.hpp"
 #include "NumCpp/Logging/Logger.hpp"
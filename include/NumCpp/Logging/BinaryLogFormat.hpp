@@ -0,0 +1,193 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// File format of rotating binary log segments
+///
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace nc::logger::detail::log_format
+{
+    /**
+     * A segment starts with a header padded to a multiple of HEADER_ALIGNMENT bytes so
+     * that the elements after it are aligned in a memory mapping:
+     *
+     *     char[8]   magic "NCBINLOG"
+     *     uint32    format version
+     *     uint32    header size in bytes
+     *     uint64    element size in bytes, 0 for types with a serialize method
+     *     uint64    segment number
+     *     uint64    index of the segment's first element in the whole log
+     *     uint32    type name size, followed by the type name
+     *
+     * Each segment has a sidecar index file of IndexEntry records, one for every
+     * indexInterval-th element of the log. All fields are in the writer's byte order.
+     */
+
+    inline constexpr std::string_view MAGIC                  = "NCBINLOG";
+    inline constexpr std::uint32_t    VERSION                = 1;
+    inline constexpr std::uint32_t    HEADER_ALIGNMENT       = 64;
+    inline constexpr std::size_t      SEGMENT_NUMBER_DIGITS  = 6;
+    inline constexpr std::uint64_t    DEFAULT_INDEX_INTERVAL = 1024;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays)
+    inline constexpr char LOG_EXT[] = ".log";
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays)
+    inline constexpr char INDEX_EXT[] = ".idx";
+
+    /**
+     * @brief The header fields of a log segment
+     */
+    struct SegmentHeader
+    {
+        std::uint32_t headerSize{ 0 };
+        std::uint64_t elementSize{ 0 };
+        std::uint64_t segmentNumber{ 0 };
+        std::uint64_t firstElement{ 0 };
+        std::string   typeName{};
+    };
+
+    /**
+     * @brief A sparse index record
+     */
+    struct IndexEntry
+    {
+        std::uint64_t elementIndex{ 0 }; ///< index of the element in the whole log
+        std::int64_t  timestamp{ 0 };    ///< system_clock nanoseconds since the epoch when it was written
+        std::uint64_t byteOffset{ 0 };   ///< byte offset of the element in its segment file
+    };
+
+    /**
+     * @brief The path of a segment file, <stem>.<segmentNumber><extension>
+     * @param stem: the output directory joined with the data type name
+     * @param segmentNumber: the segment number
+     * @param extension: LOG_EXT or INDEX_EXT
+     */
+    inline std::filesystem::path
+        segmentPath(const std::filesystem::path& stem, std::uint64_t segmentNumber, std::string_view extension)
+    {
+        auto number = std::to_string(segmentNumber);
+        if (number.size() < SEGMENT_NUMBER_DIGITS)
+        {
+            number.insert(0, SEGMENT_NUMBER_DIGITS - number.size(), '0');
+        }
+
+        auto path = stem;
+        path += "." + number;
+        path += extension;
+        return path;
+    }
+
+    /**
+     * @brief Checks whether a buffer starts with the segment magic
+     * @param data: the buffer
+     * @param size: the buffer size in bytes
+     */
+    inline bool hasMagic(const char* data, std::uint64_t size) noexcept
+    {
+        return size >= MAGIC.size() && std::string_view(data, MAGIC.size()) == MAGIC;
+    }
+
+    /**
+     * @brief Encodes a segment header, the headerSize field is computed
+     * @param header: the header fields
+     * @returns the padded header bytes
+     */
+    inline std::string encodeHeader(const SegmentHeader& header)
+    {
+        std::string encoded(MAGIC);
+        const auto  append = [&encoded](const auto& value)
+        { encoded.append(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+        const auto typeNameSize = static_cast<std::uint32_t>(header.typeName.size());
+        const auto unpaddedSize = MAGIC.size() + 2 * sizeof(std::uint32_t) + 3 * sizeof(std::uint64_t) +
+                                  sizeof(std::uint32_t) + typeNameSize;
+        const auto headerSize =
+            static_cast<std::uint32_t>((unpaddedSize + HEADER_ALIGNMENT - 1) / HEADER_ALIGNMENT * HEADER_ALIGNMENT);
+
+        append(VERSION);
+        append(headerSize);
+        append(header.elementSize);
+        append(header.segmentNumber);
+        append(header.firstElement);
+        append(typeNameSize);
+        encoded += header.typeName;
+        encoded.resize(headerSize, '\0');
+        return encoded;
+    }
+
+    /**
+     * @brief Decodes a segment header
+     * @param data: the start of the segment
+     * @param size: the segment size in bytes
+     * @returns the header fields
+     */
+    inline SegmentHeader decodeHeader(const char* data, std::uint64_t size)
+    {
+        if (!hasMagic(data, size))
+        {
+            throw std::runtime_error("Not a binary log segment");
+        }
+
+        std::uint64_t offset = MAGIC.size();
+        const auto    read   = [data, size, &offset](auto& value)
+        {
+            if (offset + sizeof(value) > size)
+            {
+                throw std::runtime_error("Truncated binary log segment header");
+            }
+
+            std::memcpy(&value, data + offset, sizeof(value));
+            offset += sizeof(value);
+        };
+
+        std::uint32_t version = 0;
+        read(version);
+        if (version != VERSION)
+        {
+            throw std::runtime_error("Unsupported binary log version " + std::to_string(version));
+        }
+
+        SegmentHeader header;
+        std::uint32_t typeNameSize = 0;
+        read(header.headerSize);
+        read(header.elementSize);
+        read(header.segmentNumber);
+        read(header.firstElement);
+        read(typeNameSize);
+        if (offset + typeNameSize > header.headerSize || header.headerSize > size)
+        {
+            throw std::runtime_error("Truncated binary log segment header");
+        }
+
+        header.typeName.assign(data + offset, typeNameSize);
+        return header;
+    }
+} // namespace nc::logger::detail::log_format
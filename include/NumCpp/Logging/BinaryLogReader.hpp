@@ -0,0 +1,457 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Memory mapped reader of binary logs
+///
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/FileMapping.hpp"
+#include "NumCpp/Logging/BinaryLogFormat.hpp"
+#include "NumCpp/NdArray.hpp"
+
+namespace nc::logger
+{
+    /**
+     * @brief Reads back a binary log written by BinaryDataLogger, either the segments of
+     *        a segmented log or a single headerless log file. The files are memory mapped,
+     *        so opening a multi-GB log only reads its headers and sparse indices and
+     *        elements are paged in as they are accessed.
+     *
+     * Only logs of types that are written as their raw bytes can be read back, logs of
+     * types with a serialize method have no fixed element size.
+     */
+    template<typename DataType>
+    class BinaryLogReader
+    {
+    public:
+        static_assert(std::is_trivially_copy_constructible_v<DataType> && std::is_trivially_destructible_v<DataType>,
+                      "DataType must be trivially copy constructible and destructible");
+        static_assert(alignof(DataType) <= detail::log_format::HEADER_ALIGNMENT,
+                      "DataType alignment is larger than the segment header alignment");
+
+        using value_type = DataType;
+        using IndexEntry = detail::log_format::IndexEntry;
+
+        /**
+         * @brief Non-owning view of contiguous elements
+         */
+        class Span
+        {
+        public:
+            using value_type     = DataType;
+            using const_iterator = const DataType*;
+
+            /**
+             * @brief Default constructor, empty span
+             */
+            Span() = default;
+
+            /**
+             * @brief Constructor
+             * @param data: the first element
+             * @param size: the number of elements
+             */
+            Span(const DataType* data, std::size_t size) noexcept :
+                data_(data),
+                size_(size)
+            {
+            }
+
+            /**
+             * @brief The first element
+             */
+            const DataType* data() const noexcept
+            {
+                return data_;
+            }
+
+            /**
+             * @brief The number of elements
+             */
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            /**
+             * @brief Checks whether the span is empty
+             */
+            bool empty() const noexcept
+            {
+                return size_ == 0;
+            }
+
+            /**
+             * @brief Iterator to the first element
+             */
+            const_iterator begin() const noexcept
+            {
+                return data_;
+            }
+
+            /**
+             * @brief Iterator past the last element
+             */
+            const_iterator end() const noexcept
+            {
+                return data_ + size_;
+            }
+
+            /**
+             * @brief Unchecked element access
+             * @param index: the element index
+             */
+            const DataType& operator[](std::size_t index) const noexcept
+            {
+                return data_[index];
+            }
+
+        private:
+            const DataType* data_{ nullptr };
+            std::size_t     size_{ 0 };
+        };
+
+        /**
+         * @brief Constructor
+         * @param logPath: any segment of a segmented log, the <type>.log path of a segmented
+         *                 log, or a single log file
+         */
+        explicit BinaryLogReader(const std::filesystem::path& logPath)
+        {
+            auto stem = segmentStem(logPath);
+            if (stem.empty() && !std::filesystem::exists(logPath))
+            {
+                const auto candidate = std::filesystem::path(logPath).replace_extension();
+                if (std::filesystem::exists(
+                        detail::log_format::segmentPath(candidate, 0, detail::log_format::LOG_EXT)))
+                {
+                    stem = candidate;
+                }
+            }
+
+            if (stem.empty())
+            {
+                addSegment(logPath, 0, false);
+            }
+            else
+            {
+                for (std::uint64_t segmentNumber = 0;; ++segmentNumber)
+                {
+                    const auto segmentPath =
+                        detail::log_format::segmentPath(stem, segmentNumber, detail::log_format::LOG_EXT);
+                    if (!std::filesystem::exists(segmentPath))
+                    {
+                        break;
+                    }
+
+                    addSegment(segmentPath, segmentNumber, true);
+                    readIndex(detail::log_format::segmentPath(stem, segmentNumber, detail::log_format::INDEX_EXT));
+                }
+
+                if (segments_.empty())
+                {
+                    throw std::runtime_error("No binary log segments found:\n\t" + logPath.string());
+                }
+            }
+        }
+
+        /**
+         * @brief The total number of elements in the log
+         */
+        std::uint64_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /**
+         * @brief Checks whether the log is empty
+         */
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        /**
+         * @brief The number of segments, 1 for a single log file
+         */
+        std::size_t numSegments() const noexcept
+        {
+            return segments_.size();
+        }
+
+        /**
+         * @brief The type name recorded in the segment headers, empty for a headerless log
+         */
+        const std::string& typeName() const noexcept
+        {
+            return typeName_;
+        }
+
+        /**
+         * @brief The elements of one segment without copying them
+         * @param segmentIndex: the segment index
+         */
+        Span segment(std::size_t segmentIndex) const
+        {
+            if (segmentIndex >= segments_.size())
+            {
+                throw std::out_of_range("segment index " + std::to_string(segmentIndex) + " is out of range");
+            }
+
+            const auto& theSegment = segments_[segmentIndex];
+            return Span(theSegment.data, static_cast<std::size_t>(theSegment.size));
+        }
+
+        /**
+         * @brief The index of the segment's first element in the whole log
+         * @param segmentIndex: the segment index
+         */
+        std::uint64_t segmentStart(std::size_t segmentIndex) const
+        {
+            if (segmentIndex >= segments_.size())
+            {
+                throw std::out_of_range("segment index " + std::to_string(segmentIndex) + " is out of range");
+            }
+
+            return segments_[segmentIndex].firstElement;
+        }
+
+        /**
+         * @brief Unchecked element access
+         * @param elementIndex: the index of the element in the whole log
+         */
+        const DataType& operator[](std::uint64_t elementIndex) const noexcept
+        {
+            const auto segmentIter = findSegment(elementIndex);
+            return segmentIter->data[elementIndex - segmentIter->firstElement];
+        }
+
+        /**
+         * @brief Bounds checked element access
+         * @param elementIndex: the index of the element in the whole log
+         */
+        const DataType& at(std::uint64_t elementIndex) const
+        {
+            if (elementIndex >= size_)
+            {
+                throw std::out_of_range("element index " + std::to_string(elementIndex) + " is out of range");
+            }
+
+            return operator[](elementIndex);
+        }
+
+        /**
+         * @brief Copies a range of elements, which may span several segments, into a 1 x count
+         *        NdArray. Only available for the NdArray data types.
+         * @param start: the index of the first element in the whole log
+         * @param count: the number of elements
+         */
+        NdArray<DataType> range(std::uint64_t start, std::uint64_t count) const
+        {
+            if (start > size_ || count > size_ - start)
+            {
+                throw std::out_of_range("element range is out of range of the log");
+            }
+
+            if (count > std::numeric_limits<uint32>::max())
+            {
+                throw std::out_of_range("element range is too large for an NdArray");
+            }
+
+            NdArray<DataType> result(1, static_cast<uint32>(count));
+            auto              outIter     = result.begin();
+            auto              segmentIter = findSegment(start);
+            while (count > 0)
+            {
+                const auto offset    = start - segmentIter->firstElement;
+                const auto numToCopy = std::min(count, segmentIter->size - offset);
+                outIter              = std::copy_n(segmentIter->data + offset, numToCopy, outIter);
+                start += numToCopy;
+                count -= numToCopy;
+                ++segmentIter;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief The sparse index of every segment, ordered by element index. A headerless
+         *        log has no index.
+         */
+        const std::vector<IndexEntry>& index() const noexcept
+        {
+            return index_;
+        }
+
+        /**
+         * @brief Finds where to start reading the elements logged from a point in time,
+         *        assuming the system clock did not step backwards while logging
+         * @param time: the point in time
+         * @returns the index of the last indexed element written at or before time, 0 if
+         *          time precedes the index
+         */
+        std::uint64_t findTime(std::chrono::system_clock::time_point time) const
+        {
+            const auto timestamp =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+            const auto iter = std::upper_bound(index_.begin(),
+                                               index_.end(),
+                                               timestamp,
+                                               [](std::int64_t value, const IndexEntry& entry)
+                                               { return value < entry.timestamp; });
+            return iter == index_.begin() ? 0 : std::prev(iter)->elementIndex;
+        }
+
+    private:
+        /**
+         * @brief A mapped segment
+         */
+        struct Segment
+        {
+            mapping::FileMapping mapping{};
+            const DataType*      data{ nullptr };
+            std::uint64_t        firstElement{ 0 };
+            std::uint64_t        size{ 0 };
+        };
+
+        std::vector<Segment>    segments_{};
+        std::vector<IndexEntry> index_{};
+        std::string             typeName_{};
+        std::uint64_t           size_{ 0 };
+
+        /**
+         * @brief The <dir>/<type> stem of a segment path, empty if the path is not a segment
+         * @param logPath: the log path
+         */
+        static std::filesystem::path segmentStem(const std::filesystem::path& logPath)
+        {
+            auto       stem   = std::filesystem::path(logPath).replace_extension();
+            const auto number = stem.extension().string();
+            if (number.size() != detail::log_format::SEGMENT_NUMBER_DIGITS + 1 ||
+                !std::all_of(number.begin() + 1, number.end(), [](char c) { return c >= '0' && c <= '9'; }))
+            {
+                return {};
+            }
+
+            return stem.replace_extension();
+        }
+
+        /**
+         * @brief Maps a segment and checks its header. An empty file, such as a log that
+         *        nothing was written to yet, is an empty segment.
+         * @param segmentPath: the segment path
+         * @param segmentNumber: the expected segment number
+         * @param requireHeader: whether a headerless file is an error
+         */
+        void addSegment(const std::filesystem::path& segmentPath, std::uint64_t segmentNumber, bool requireHeader)
+        {
+            Segment theSegment;
+            theSegment.firstElement = size_;
+            if (std::filesystem::file_size(segmentPath) == 0)
+            {
+                // a file can not be mapped with a length of zero
+                segments_.push_back(std::move(theSegment));
+                return;
+            }
+
+            theSegment.mapping = mapping::FileMapping(segmentPath.string(), MapMode::COPY_ON_WRITE);
+
+            const auto*   data       = theSegment.mapping.data();
+            const auto    fileSize   = theSegment.mapping.size();
+            std::uint64_t dataOffset = 0;
+            if (requireHeader || detail::log_format::hasMagic(data, fileSize))
+            {
+                const auto header = detail::log_format::decodeHeader(data, fileSize);
+                if (header.elementSize != sizeof(DataType))
+                {
+                    throw std::runtime_error("The log element size " + std::to_string(header.elementSize) +
+                                             " does not match the data type size " +
+                                             std::to_string(sizeof(DataType)) + ":\n\t" + segmentPath.string());
+                }
+
+                if (header.segmentNumber != segmentNumber || header.firstElement != size_)
+                {
+                    throw std::runtime_error("The log segments are not consecutive:\n\t" + segmentPath.string());
+                }
+
+                if (segments_.empty())
+                {
+                    typeName_ = header.typeName;
+                }
+
+                dataOffset = header.headerSize;
+            }
+
+            theSegment.data = reinterpret_cast<const DataType*>(data + dataOffset);
+            theSegment.size = (fileSize - dataOffset) / sizeof(DataType);
+            size_ += theSegment.size;
+            segments_.push_back(std::move(theSegment));
+        }
+
+        /**
+         * @brief Appends the entries of a segment's index, ignoring a partially written last entry
+         * @param indexPath: the index path
+         */
+        void readIndex(const std::filesystem::path& indexPath)
+        {
+            std::ifstream indexFile(indexPath, std::ios::in | std::ios::binary);
+            IndexEntry    entry;
+            while (indexFile.read(reinterpret_cast<char*>(&entry), sizeof(entry)))
+            {
+                if (entry.elementIndex < size_)
+                {
+                    index_.push_back(entry);
+                }
+            }
+        }
+
+        /**
+         * @brief The segment holding an element
+         * @param elementIndex: the index of the element in the whole log
+         */
+        typename std::vector<Segment>::const_iterator findSegment(std::uint64_t elementIndex) const noexcept
+        {
+            return std::prev(std::upper_bound(segments_.begin(),
+                                              segments_.end(),
+                                              elementIndex,
+                                              [](std::uint64_t value, const Segment& theSegment)
+                                              { return value < theSegment.firstElement; }));
+        }
+    };
+} // namespace nc::logger
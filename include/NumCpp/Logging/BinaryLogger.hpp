@@ -30,19 +30,39 @@
 #ifndef NUMCPP_NO_USE_BOOST
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <type_traits>
 #include <typeinfo>
 
 #include "boost/algorithm/string.hpp"
 #include "boost/core/demangle.hpp"
 
+#include "NumCpp/Logging/BinaryLogFormat.hpp"
+#include "NumCpp/Logging/RingBuffer.hpp"
+
 namespace nc::logger
 {
+    /**
+     * @brief What an asynchronous logger does with an element when its buffer is full
+     */
+    enum class OverflowPolicy
+    {
+        BLOCK, ///< wait for the writer thread to free a slot
+        DROP   ///< discard the element and count it in numDropped()
+    };
+
     namespace detail
     {
         namespace type_traits
@@ -83,6 +103,18 @@ namespace nc::logger
 
         /**
          * @brief Binary Logger
+         *
+         * By default log() writes to the file on the calling thread. After enableAsync()
+         * log() only copies the element into a lock-free ring buffer and a background
+         * writer thread serializes and writes the elements in batches, so logging from a
+         * real-time loop never waits on disk I/O. The logger must not be reconfigured
+         * (setOutputDir, enableAsync, disableAsync, enableSegments) while other threads
+         * are logging.
+         *
+         * By default the log is a single headerless <type>.log file. After enableSegments()
+         * it is split into <type>.NNNNNN.log segments of bounded size, each starting with a
+         * header and paired with a sparse <type>.NNNNNN.idx timestamp index, which
+         * BinaryLogReader can seek into without scanning the log.
          */
         template<typename DataType>
         class BinaryDataLogger
@@ -92,10 +124,13 @@ namespace nc::logger
             using const_pointer   = const DataType* const;
             using const_reference = const DataType&;
 
-            // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays)
-            static constexpr char LOG_EXT[]                      = ".log";
+            static constexpr auto LOG_EXT                        = log_format::LOG_EXT;
             static constexpr auto DATA_ELEMENT_SIZE              = sizeof(value_type);
             static constexpr auto DATE_TYPE_HAS_SERIALIZE_METHOD = type_traits::has_serialize_v<value_type>;
+            static constexpr auto DEFAULT_ASYNC_CAPACITY         = std::size_t{ 1 } << 16;
+            static constexpr auto WRITE_BATCH_SIZE               = std::size_t{ 1024 };
+            static constexpr auto WRITER_POLL_PERIOD             = std::chrono::milliseconds(1);
+            static constexpr auto DEFAULT_INDEX_INTERVAL         = log_format::DEFAULT_INDEX_INTERVAL;
 
             /**
              * @brief Default constructor
@@ -121,10 +156,45 @@ namespace nc::logger
             }
 
             /**
-             * @brief Destructor
+             * @brief Constructor
+             * @param outputDir: the directory to place the output log
+             * @param asyncCapacity: the ring buffer capacity for asynchronous logging,
+             *                       0 logs synchronously
+             * @param overflowPolicy: what to do when the ring buffer is full
+             * @param maxSegmentBytes: the maximum size of a log segment, 0 writes a single log file
+             * @param indexInterval: the number of elements between index entries of a segmented log
+             */
+            BinaryDataLogger(const std::filesystem::path& outputDir,
+                             std::size_t                  asyncCapacity,
+                             OverflowPolicy               overflowPolicy,
+                             std::uint64_t                maxSegmentBytes = 0,
+                             std::uint64_t                indexInterval   = DEFAULT_INDEX_INTERVAL)
+            {
+                if (maxSegmentBytes > 0)
+                {
+                    enableSegments(maxSegmentBytes, indexInterval);
+                }
+
+                setOutputDir(outputDir);
+                if (asyncCapacity > 0)
+                {
+                    enableAsync(asyncCapacity, overflowPolicy);
+                }
+            }
+
+            /**
+             * @brief Destructor, writes out everything that was logged asynchronously
              */
             ~BinaryDataLogger()
             {
+                try
+                {
+                    disableAsync();
+                }
+                catch (...)
+                {
+                }
+
                 ofile_.close();
             }
 
@@ -135,7 +205,8 @@ namespace nc::logger
             BinaryDataLogger& operator=(BinaryDataLogger&&)      = delete;
 
             /**
-             * @brief The log file path
+             * @brief The log file path. For a segmented log this is the segment currently being
+             *        written, which an asynchronous logger rotates on its writer thread.
              */
             const std::filesystem::path& filepath() const noexcept
             {
@@ -151,18 +222,36 @@ namespace nc::logger
             {
                 if (std::filesystem::is_directory(outputDir))
                 {
-                    auto dataTypeName = boost::core::demangle(typeid(DataType).name());
-                    boost::algorithm::replace_all(dataTypeName, "::", "_");
-                    boost::algorithm::replace_all(dataTypeName, "<", "_");
-                    boost::algorithm::replace_all(dataTypeName, ">", "_");
-                    const auto filename = std::filesystem::path(dataTypeName).replace_extension(LOG_EXT);
-                    filepath_           = std::filesystem::canonical(outputDir) / filename;
-
-                    ofile_ = std::ofstream(filepath_.c_str(), std::ios::out | std::ios::binary);
-                    if (!ofile_.good())
+                    auto fileStem = dataTypeName();
+                    boost::algorithm::replace_all(fileStem, "::", "_");
+                    boost::algorithm::replace_all(fileStem, "<", "_");
+                    boost::algorithm::replace_all(fileStem, ">", "_");
+
+                    const auto asyncCapacity = isAsync() ? ringBuffer_->capacity() : 0;
+                    disableAsync();
+
+                    logStem_ = std::filesystem::canonical(outputDir) / fileStem;
+                    if (isSegmented())
+                    {
+                        removeSegments();
+                        numLogged_ = 0;
+                        openSegment(0);
+                    }
+                    else
+                    {
+                        filepath_ = std::filesystem::path(logStem_).replace_extension(LOG_EXT);
+                        ofile_    = std::ofstream(filepath_.c_str(), std::ios::out | std::ios::binary);
+                    }
+
+                    if (!filesGood())
                     {
                         throw std::runtime_error("Unable to open the log file:\n\t" + filepath_.string());
                     }
+
+                    if (asyncCapacity > 0)
+                    {
+                        enableAsync(asyncCapacity, overflowPolicy_);
+                    }
                 }
                 else
                 {
@@ -206,11 +295,144 @@ namespace nc::logger
             }
 
             /**
-             * @brief Force a flush of the output stream
+             * @brief Starts logging asynchronously through a ring buffer and a background
+             *        writer thread. Elements of types with a serialize method are copied
+             *        into the buffer and serialized on the writer thread.
+             *
+             * @param capacity: the number of elements the buffer holds, rounded up to a power of two
+             * @param overflowPolicy: what to do when the buffer is full
+             */
+            void enableAsync(std::size_t    capacity       = DEFAULT_ASYNC_CAPACITY,
+                             OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK)
+            {
+                if (logStem_.empty())
+                {
+                    throw std::runtime_error("The output log directory does not exist");
+                }
+
+                disableAsync();
+
+                ringBuffer_     = std::make_unique<RingBuffer<value_type>>(capacity);
+                overflowPolicy_ = overflowPolicy;
+                stopWriter_     = false;
+                flushTarget_    = 0;
+                numFlushed_     = 0;
+                writerThread_   = std::thread(&BinaryDataLogger::writeLoop, this);
+            }
+
+            /**
+             * @brief Writes out everything logged so far, stops the writer thread, and
+             *        returns to synchronous logging
+             */
+            void disableAsync()
+            {
+                if (!isAsync())
+                {
+                    return;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(writerMutex_);
+                    stopWriter_ = true;
+                }
+                writerCondition_.notify_all();
+                writerThread_.join();
+                ringBuffer_.reset();
+
+                checkWriteError();
+            }
+
+            /**
+             * @brief Splits the log into segments of at most maxSegmentBytes each, rotating to
+             *        a new segment at element boundaries. Every indexInterval-th element gets
+             *        an entry in the segment's index with the time it was written. If the output
+             *        directory is already set this starts a new log there, like setOutputDir.
+             *
+             * @param maxSegmentBytes: the maximum segment size in bytes, including its header.
+             *                         A segment always holds at least one element.
+             * @param indexInterval: the number of elements between index entries
+             */
+            void enableSegments(std::uint64_t maxSegmentBytes, std::uint64_t indexInterval = DEFAULT_INDEX_INTERVAL)
+            {
+                if (maxSegmentBytes == 0 || indexInterval == 0)
+                {
+                    throw std::invalid_argument("maxSegmentBytes and indexInterval must be greater than zero");
+                }
+
+                const auto asyncCapacity = isAsync() ? ringBuffer_->capacity() : 0;
+                disableAsync();
+
+                const auto singleLogPath = isSegmented() ? std::filesystem::path{} : filepath_;
+                maxSegmentBytes_         = maxSegmentBytes;
+                indexInterval_           = indexInterval;
+
+                if (!logStem_.empty())
+                {
+                    setOutputDir(logStem_.parent_path());
+
+                    // the single log file that was replaced is removed if nothing was logged to it
+                    std::error_code errorCode;
+                    if (!singleLogPath.empty() && std::filesystem::file_size(singleLogPath, errorCode) == 0 &&
+                        !errorCode)
+                    {
+                        std::filesystem::remove(singleLogPath, errorCode);
+                    }
+                }
+
+                if (asyncCapacity > 0)
+                {
+                    enableAsync(asyncCapacity, overflowPolicy_);
+                }
+            }
+
+            /**
+             * @brief Checks whether the log is split into segments
+             */
+            bool isSegmented() const noexcept
+            {
+                return maxSegmentBytes_ > 0;
+            }
+
+            /**
+             * @brief Checks whether the logger is asynchronous
+             */
+            bool isAsync() const noexcept
+            {
+                return ringBuffer_ != nullptr;
+            }
+
+            /**
+             * @brief The number of elements discarded by the DROP overflow policy
+             */
+            std::uint64_t numDropped() const noexcept
+            {
+                return numDropped_.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Force a flush of the output stream. For an asynchronous logger this
+             *        waits until every element logged before the call has been written.
              */
             void flush()
             {
-                ofile_.flush();
+                if (!isAsync())
+                {
+                    flushFiles();
+                    return;
+                }
+
+                const auto target = ringBuffer_->numPushed();
+                {
+                    std::unique_lock<std::mutex> lock(writerMutex_);
+                    flushTarget_ = std::max(flushTarget_, target);
+                    writerCondition_.notify_all();
+                    while (numFlushed_ < target)
+                    {
+                        writerCondition_.wait_for(lock, WRITER_POLL_PERIOD);
+                    }
+                }
+
+                checkWriteError();
             }
 
             /**
@@ -224,19 +446,18 @@ namespace nc::logger
                     return;
                 }
 
-                if (filepath_.empty())
+                if (logStem_.empty())
                 {
                     throw std::runtime_error("The output log directory does not exist");
                 }
 
-                if constexpr (DATE_TYPE_HAS_SERIALIZE_METHOD)
+                if (isAsync())
                 {
-                    const auto serializedData = dataElement.serialize();
-                    ofile_.write(serializedData.data(), serializedData.size());
+                    push(dataElement);
                 }
                 else
                 {
-                    ofile_.write(reinterpret_cast<const char*>(&dataElement), DATA_ELEMENT_SIZE);
+                    writeElement(dataElement);
                 }
             }
 
@@ -252,11 +473,20 @@ namespace nc::logger
                     return;
                 }
 
-                if (filepath_.empty())
+                if (logStem_.empty())
                 {
                     throw std::runtime_error("The output log directory does not exist");
                 }
 
+                if constexpr (!DATE_TYPE_HAS_SERIALIZE_METHOD)
+                {
+                    if (!isAsync() && !isSegmented())
+                    {
+                        ofile_.write(reinterpret_cast<const char*>(dataElements), numElements * DATA_ELEMENT_SIZE);
+                        return;
+                    }
+                }
+
                 std::for_each(dataElements,
                               dataElements + numElements,
                               [this](const_reference dataElement) { log(dataElement); });
@@ -266,6 +496,252 @@ namespace nc::logger
             std::filesystem::path filepath_{};
             std::ofstream         ofile_;
             bool                  enabled_{ true };
+
+            std::unique_ptr<RingBuffer<value_type>> ringBuffer_{};
+            OverflowPolicy                          overflowPolicy_{ OverflowPolicy::BLOCK };
+            std::atomic<std::uint64_t>              numDropped_{ 0 };
+            std::atomic<bool>                       writeFailed_{ false };
+            std::thread                             writerThread_{};
+            std::mutex                              writerMutex_{};
+            std::condition_variable                 writerCondition_{};
+            bool                                    stopWriter_{ false };
+            std::size_t                             flushTarget_{ 0 };
+            std::size_t                             numFlushed_{ 0 };
+
+            std::filesystem::path logStem_{};
+            std::ofstream         indexFile_;
+            std::uint64_t         maxSegmentBytes_{ 0 };
+            std::uint64_t         indexInterval_{ DEFAULT_INDEX_INTERVAL };
+            std::uint64_t         segmentNumber_{ 0 };
+            std::uint64_t         segmentBytes_{ 0 };
+            std::uint64_t         headerBytes_{ 0 };
+            std::uint64_t         numLogged_{ 0 };
+
+            /**
+             * @brief The demangled name of the data type
+             */
+            static std::string dataTypeName()
+            {
+                return boost::core::demangle(typeid(DataType).name());
+            }
+
+            /**
+             * @brief Writes an element to the log, rotating to a new segment first if it
+             *        would not fit in the current one
+             * @param dataElement: the data element
+             */
+            void writeElement(const_reference dataElement)
+            {
+                if constexpr (DATE_TYPE_HAS_SERIALIZE_METHOD)
+                {
+                    const auto serializedData = dataElement.serialize();
+                    writeBytes(serializedData.data(), serializedData.size());
+                }
+                else
+                {
+                    writeBytes(reinterpret_cast<const char*>(&dataElement), DATA_ELEMENT_SIZE);
+                }
+            }
+
+            /**
+             * @brief Writes the bytes of one element to the log
+             * @param data: the element bytes
+             * @param numBytes: the number of bytes
+             */
+            void writeBytes(const char* data, std::size_t numBytes)
+            {
+                if (isSegmented())
+                {
+                    if (segmentBytes_ > headerBytes_ && segmentBytes_ + numBytes > maxSegmentBytes_)
+                    {
+                        openSegment(segmentNumber_ + 1);
+                    }
+
+                    if (numLogged_ % indexInterval_ == 0)
+                    {
+                        const auto now   = std::chrono::system_clock::now().time_since_epoch();
+                        const auto entry = log_format::IndexEntry{
+                            numLogged_,
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(now).count(),
+                            segmentBytes_ };
+                        indexFile_.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+                    }
+
+                    segmentBytes_ += numBytes;
+                    ++numLogged_;
+                }
+
+                ofile_.write(data, static_cast<std::streamsize>(numBytes));
+            }
+
+            /**
+             * @brief Closes the current segment and starts the next one. Failures are left
+             *        in the stream states for filesGood() to report.
+             * @param segmentNumber: the segment number
+             */
+            void openSegment(std::uint64_t segmentNumber)
+            {
+                ofile_.close();
+                indexFile_.close();
+
+                segmentNumber_ = segmentNumber;
+                filepath_      = log_format::segmentPath(logStem_, segmentNumber_, log_format::LOG_EXT);
+                ofile_         = std::ofstream(filepath_.c_str(), std::ios::out | std::ios::binary);
+                indexFile_     = std::ofstream(log_format::segmentPath(logStem_, segmentNumber_, log_format::INDEX_EXT),
+                                           std::ios::out | std::ios::binary);
+
+                const auto header = log_format::encodeHeader(
+                    { 0,
+                      static_cast<std::uint64_t>(DATE_TYPE_HAS_SERIALIZE_METHOD ? 0 : DATA_ELEMENT_SIZE),
+                      segmentNumber_,
+                      numLogged_,
+                      dataTypeName() });
+                ofile_.write(header.data(), static_cast<std::streamsize>(header.size()));
+                headerBytes_  = header.size();
+                segmentBytes_ = headerBytes_;
+            }
+
+            /**
+             * @brief Removes the segments of a previous log with the same name
+             */
+            void removeSegments()
+            {
+                for (std::uint64_t segmentNumber = 0;; ++segmentNumber)
+                {
+                    const auto logPath   = log_format::segmentPath(logStem_, segmentNumber, log_format::LOG_EXT);
+                    const auto indexPath = log_format::segmentPath(logStem_, segmentNumber, log_format::INDEX_EXT);
+                    if (!std::filesystem::exists(logPath) && !std::filesystem::exists(indexPath))
+                    {
+                        break;
+                    }
+
+                    std::filesystem::remove(logPath);
+                    std::filesystem::remove(indexPath);
+                }
+            }
+
+            /**
+             * @brief Flushes the log and index files
+             */
+            void flushFiles()
+            {
+                ofile_.flush();
+                if (indexFile_.is_open())
+                {
+                    indexFile_.flush();
+                }
+            }
+
+            /**
+             * @brief Checks whether the log and index files are still writable
+             */
+            bool filesGood() const
+            {
+                return ofile_.good() && (!isSegmented() || indexFile_.good());
+            }
+
+            /**
+             * @brief Puts an element in the ring buffer according to the overflow policy
+             * @param dataElement: the data element
+             */
+            void push(const_reference dataElement)
+            {
+                while (!ringBuffer_->tryPush(dataElement))
+                {
+                    if (overflowPolicy_ == OverflowPolicy::DROP)
+                    {
+                        numDropped_.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    }
+
+                    writerCondition_.notify_one();
+                    std::this_thread::yield();
+                }
+            }
+
+            /**
+             * @brief Body of the writer thread. Drains the ring buffer in batches until
+             *        it is stopped and everything pushed has been written.
+             */
+            void writeLoop()
+            {
+                std::string batch;
+                std::size_t numWritten = 0;
+                const auto  appendElement = [&batch](const_reference dataElement)
+                {
+                    if constexpr (DATE_TYPE_HAS_SERIALIZE_METHOD)
+                    {
+                        batch += dataElement.serialize();
+                    }
+                    else
+                    {
+                        batch.append(reinterpret_cast<const char*>(&dataElement), DATA_ELEMENT_SIZE);
+                    }
+                };
+
+                const auto writeSegmented = [this](const_reference dataElement) { writeElement(dataElement); };
+
+                while (true)
+                {
+                    std::size_t numConsumed = 0;
+                    if (isSegmented())
+                    {
+                        numConsumed = ringBuffer_->consume(writeSegmented, WRITE_BATCH_SIZE);
+                    }
+                    else
+                    {
+                        batch.clear();
+                        numConsumed = ringBuffer_->consume(appendElement, WRITE_BATCH_SIZE);
+                        if (numConsumed > 0)
+                        {
+                            ofile_.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+                        }
+                    }
+                    numWritten += numConsumed;
+
+                    std::unique_lock<std::mutex> lock(writerMutex_);
+                    if (numFlushed_ < flushTarget_ && (numConsumed == 0 || numWritten >= flushTarget_))
+                    {
+                        flushFiles();
+                        numFlushed_ = numWritten;
+                        writerCondition_.notify_all();
+                    }
+
+                    if (!filesGood())
+                    {
+                        writeFailed_ = true;
+                    }
+
+                    if (numConsumed > 0)
+                    {
+                        continue;
+                    }
+
+                    if (stopWriter_ && numWritten == ringBuffer_->numPushed())
+                    {
+                        break;
+                    }
+
+                    writerCondition_.wait_for(lock, WRITER_POLL_PERIOD);
+                }
+
+                flushFiles();
+                if (!filesGood())
+                {
+                    writeFailed_ = true;
+                }
+            }
+
+            /**
+             * @brief Throws if the writer thread failed to write the log file
+             */
+            void checkWriteError()
+            {
+                if (writeFailed_.exchange(false))
+                {
+                    throw std::runtime_error("Error writing the log file:\n\t" + filepath_.string());
+                }
+            }
         };
     } // namespace detail
 
@@ -327,12 +803,54 @@ namespace nc::logger
         template<typename DataType>
         detail::BinaryDataLogger<DataType>& getTypeLogger()
         {
-            static detail::BinaryDataLogger<DataType> typeLogger(outputDir_);
+            static detail::BinaryDataLogger<DataType> typeLogger(outputDir_,
+                                                                 asyncCapacity_,
+                                                                 overflowPolicy_,
+                                                                 maxSegmentBytes_,
+                                                                 indexInterval_);
             return typeLogger;
         }
 
+        /**
+         * @brief Makes type loggers created afterwards log asynchronously, each with its
+         *        own ring buffer and writer thread. Like setOutputDir this should be called
+         *        BEFORE any type loggers have been created.
+         *
+         * @param capacity: the number of elements each ring buffer holds, 0 logs synchronously
+         * @param overflowPolicy: what to do when a ring buffer is full
+         */
+        void setAsync(std::size_t capacity, OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK) noexcept
+        {
+            asyncCapacity_  = capacity;
+            overflowPolicy_ = overflowPolicy;
+        }
+
+        /**
+         * @brief Makes type loggers created afterwards split their logs into indexed
+         *        segments. Like setOutputDir this should be called BEFORE any type loggers
+         *        have been created.
+         *
+         * @param maxSegmentBytes: the maximum segment size in bytes, 0 writes a single log file
+         * @param indexInterval: the number of elements between index entries
+         */
+        void setSegments(std::uint64_t maxSegmentBytes,
+                         std::uint64_t indexInterval = detail::log_format::DEFAULT_INDEX_INTERVAL)
+        {
+            if (indexInterval == 0)
+            {
+                throw std::invalid_argument("indexInterval must be greater than zero");
+            }
+
+            maxSegmentBytes_ = maxSegmentBytes;
+            indexInterval_   = indexInterval;
+        }
+
     private:
         std::filesystem::path outputDir_{ "." };
+        std::size_t           asyncCapacity_{ 0 };
+        OverflowPolicy        overflowPolicy_{ OverflowPolicy::BLOCK };
+        std::uint64_t         maxSegmentBytes_{ 0 };
+        std::uint64_t         indexInterval_{ detail::log_format::DEFAULT_INDEX_INTERVAL };
 
         /**
          * @brief Constructor
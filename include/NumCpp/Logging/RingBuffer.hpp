@@ -0,0 +1,188 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Bounded lock-free ring buffer
+///
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace nc::logger::detail
+{
+    /**
+     * @brief Bounded lock-free multi-producer, single-consumer ring buffer. Each slot
+     *        carries a sequence number that tells producers and the consumer whether
+     *        the slot is free or filled, so neither side ever takes a lock.
+     */
+    template<typename DataType>
+    class RingBuffer
+    {
+    public:
+        static_assert(std::is_copy_constructible_v<DataType>, "DataType must be copy constructible");
+
+        using value_type = DataType;
+
+        /**
+         * @brief Constructor
+         * @param capacity: the number of slots, rounded up to a power of two
+         */
+        explicit RingBuffer(std::size_t capacity)
+        {
+            if (capacity == 0)
+            {
+                throw std::invalid_argument("RingBuffer capacity must be greater than zero");
+            }
+
+            capacity_ = 1;
+            while (capacity_ < capacity)
+            {
+                capacity_ <<= 1;
+            }
+
+            mask_  = capacity_ - 1;
+            slots_ = std::make_unique<Slot[]>(capacity_);
+            for (std::size_t i = 0; i < capacity_; ++i)
+            {
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Destructor, destroys any elements that were never consumed
+         */
+        ~RingBuffer()
+        {
+            consume([](const value_type&) {}, capacity_);
+        }
+
+        // explicitly delete
+        RingBuffer(const RingBuffer&)            = delete;
+        RingBuffer(RingBuffer&&)                 = delete;
+        RingBuffer& operator=(const RingBuffer&) = delete;
+        RingBuffer& operator=(RingBuffer&&)      = delete;
+
+        /**
+         * @brief The number of slots
+         */
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        /**
+         * @brief The total number of elements ever pushed, including those still in flight
+         */
+        [[nodiscard]] std::size_t numPushed() const noexcept
+        {
+            return enqueuePos_.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Pushes an element, may be called from any number of threads
+         * @param dataElement: the data element
+         * @returns false if the buffer is full
+         */
+        bool tryPush(const value_type& dataElement)
+        {
+            auto pos = enqueuePos_.load(std::memory_order_relaxed);
+            while (true)
+            {
+                auto&      slot     = slots_[pos & mask_];
+                const auto sequence = slot.sequence.load(std::memory_order_acquire);
+                const auto diff     = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+                if (diff == 0)
+                {
+                    if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        ::new (static_cast<void*>(slot.storage)) value_type(dataElement);
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Passes up to maxElements of the oldest elements to function in order and
+         *        frees their slots. Must only be called from the one consumer thread.
+         * @param function: called with each element as function(const value_type&)
+         * @param maxElements: the maximum number of elements to consume
+         * @returns the number of elements consumed
+         */
+        template<typename Function>
+        std::size_t consume(Function&& function, std::size_t maxElements)
+        {
+            std::size_t numConsumed = 0;
+            while (numConsumed < maxElements)
+            {
+                auto& slot = slots_[dequeuePos_ & mask_];
+                if (slot.sequence.load(std::memory_order_acquire) != dequeuePos_ + 1)
+                {
+                    break;
+                }
+
+                auto* element = std::launder(reinterpret_cast<value_type*>(slot.storage));
+                function(static_cast<const value_type&>(*element));
+                element->~value_type();
+                slot.sequence.store(dequeuePos_ + capacity_, std::memory_order_release);
+                ++dequeuePos_;
+                ++numConsumed;
+            }
+
+            return numConsumed;
+        }
+
+    private:
+        static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+        struct Slot
+        {
+            std::atomic<std::size_t> sequence{ 0 };
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays)
+            alignas(value_type) unsigned char storage[sizeof(value_type)]{};
+        };
+
+        std::size_t             capacity_{ 0 };
+        std::size_t             mask_{ 0 };
+        std::unique_ptr<Slot[]> slots_{};
+
+        alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> enqueuePos_{ 0 };
+        alignas(CACHE_LINE_SIZE) std::size_t dequeuePos_{ 0 };
+    };
+} // namespace nc::logger::detail
@@ -29,3 +29,4 @@
 
 #include "NumCpp/NdArray/NdArrayCore.hpp"
 #include "NumCpp/NdArray/NdArrayOperators.hpp"
+#include "NumCpp/NdArray/NdArrayView.hpp"
@@ -48,8 +48,10 @@
 #include "NumCpp/Core/Constants.hpp"
 #include "NumCpp/Core/DtypeInfo.hpp"
 #include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/CharConv.hpp"
 #include "NumCpp/Core/Internal/Endian.hpp"
 #include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/Gemm.hpp"
 #include "NumCpp/Core/Internal/StaticAsserts.hpp"
 #include "NumCpp/Core/Internal/StdComplexOperators.hpp"
 #include "NumCpp/Core/Internal/StlAlgorithms.hpp"
@@ -131,6 +133,10 @@ namespace nc
         using ndarray_int_concept = std::enable_if_t<is_ndarray_int_v<T>, int>;
     } // namespace type_traits
 
+    // Forward declare
+    template<typename dtype>
+    class NdArrayView;
+
     //================================================================================
     // Class Description:
     /// Holds 1D and 2D arrays, the main work horse of the NumCpp library
@@ -2808,18 +2814,13 @@ namespace nc
             {
                 // 2D array, use matrix multiplication
                 self_type returnArray(shape_.rows, inOtherArray.shape_.cols);
-                auto      otherArrayT = inOtherArray.transpose();
-
-                for (uint32 i = 0; i < shape_.rows; ++i)
-                {
-                    for (uint32 j = 0; j < otherArrayT.shape_.rows; ++j)
-                    {
-                        returnArray(i, j) = stl_algorithms::transform_reduce(otherArrayT.cbegin(j),
-                                                                             otherArrayT.cend(j),
-                                                                             cbegin(i),
-                                                                             dtype{ 0 });
-                    }
-                }
+                returnArray.zeros();
+                gemm::multiply(shape_.rows,
+                               inOtherArray.shape_.cols,
+                               shape_.cols,
+                               data(),
+                               inOtherArray.data(),
+                               returnArray.data());
 
                 return returnArray;
             }
@@ -4797,6 +4798,8 @@ namespace nc
         /// Write array to a file as text.
         /// The data produced by this method can be recovered
         /// using the function fromfile().
+        /// Arithmetic values are written in the shortest form that parses back
+        /// to the same value.
         ///
         /// Numpy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.ndarray.tofile.html
         ///
@@ -4819,16 +4822,42 @@ namespace nc
                 THROW_RUNTIME_ERROR("Input file could not be opened:\n\t" + inFilename);
             }
 
-            size_type counter = 0;
-            for (auto value : *this)
+            if constexpr (std::is_arithmetic_v<dtype>)
+            {
+                // format into a buffer that is written out each time it fills up
+                constexpr std::ptrdiff_t bufferSize = 1 << 16;
+                std::vector<char>        buffer(bufferSize + charconv::MAX_CHARS + 1);
+                char*                    iter = buffer.data();
+                for (size_type i = 0; i < size_; ++i)
+                {
+                    if (i > 0)
+                    {
+                        *iter++ = inSep;
+                    }
+                    iter = charconv::toChars(iter, iter + charconv::MAX_CHARS, array_[i]);
+
+                    if (iter - buffer.data() >= bufferSize)
+                    {
+                        ofile.write(buffer.data(), iter - buffer.data());
+                        iter = buffer.data();
+                    }
+                }
+                *iter++ = '\n';
+                ofile.write(buffer.data(), iter - buffer.data());
+            }
+            else
             {
-                ofile << value;
-                if (counter++ != size_ - 1)
+                size_type counter = 0;
+                for (auto value : *this)
                 {
-                    ofile << inSep;
+                    ofile << value;
+                    if (counter++ != size_ - 1)
+                    {
+                        ofile << inSep;
+                    }
                 }
+                ofile << '\n';
             }
-            ofile << '\n';
             ofile.close();
         }
 
@@ -4973,6 +5002,141 @@ namespace nc
             return transArray;
         }
 
+        //============================================================================
+        // Method Description:
+        /// Returns a view of the whole array without copying. A view reads and writes
+        /// this array's data and is invalidated when the array is resized or destroyed.
+        ///
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<dtype> view() noexcept
+        {
+            return NdArrayView<dtype>(array_, shape_, shape_.cols, 1);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a read only view of the whole array without copying
+        ///
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<const dtype> view() const noexcept
+        {
+            return NdArrayView<const dtype>(array_, shape_, shape_.cols, 1);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a view of the flattened slice in O(1), the non-copying counterpart of
+        /// operator[](Slice)
+        ///
+        /// @param inSlice
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<dtype> view(Slice inSlice)
+        {
+            const auto numElements = inSlice.numElements(size_);
+            return NdArrayView<dtype>(array_ + inSlice.start,
+                                      Shape(numElements == 0 ? 0 : 1, numElements),
+                                      numElements * static_cast<size_type>(inSlice.step),
+                                      static_cast<size_type>(inSlice.step));
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a read only view of the flattened slice in O(1)
+        ///
+        /// @param inSlice
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<const dtype> view(Slice inSlice) const
+        {
+            const auto numElements = inSlice.numElements(size_);
+            return NdArrayView<const dtype>(array_ + inSlice.start,
+                                            Shape(numElements == 0 ? 0 : 1, numElements),
+                                            numElements * static_cast<size_type>(inSlice.step),
+                                            static_cast<size_type>(inSlice.step));
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a view of the 2D slice in O(1), the non-copying counterpart of
+        /// operator()(Slice, Slice)
+        ///
+        /// @param inRowSlice
+        /// @param inColSlice
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<dtype> view(Slice inRowSlice, Slice inColSlice)
+        {
+            return view().view(inRowSlice, inColSlice);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a read only view of the 2D slice in O(1)
+        ///
+        /// @param inRowSlice
+        /// @param inColSlice
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<const dtype> view(Slice inRowSlice, Slice inColSlice) const
+        {
+            return view().view(inRowSlice, inColSlice);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a view of the rows of one column in O(1)
+        ///
+        /// @param inRowSlice
+        /// @param inColIndex
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<dtype> view(Slice inRowSlice, index_type inColIndex)
+        {
+            return view(inRowSlice, toSlice(inColIndex, shape_.cols));
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a read only view of the rows of one column in O(1)
+        ///
+        /// @param inRowSlice
+        /// @param inColIndex
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<const dtype> view(Slice inRowSlice, index_type inColIndex) const
+        {
+            return view(inRowSlice, toSlice(inColIndex, shape_.cols));
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a view of the columns of one row in O(1)
+        ///
+        /// @param inRowIndex
+        /// @param inColSlice
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<dtype> view(index_type inRowIndex, Slice inColSlice)
+        {
+            return view(toSlice(inRowIndex, shape_.rows), inColSlice);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a read only view of the columns of one row in O(1)
+        ///
+        /// @param inRowIndex
+        /// @param inColSlice
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] NdArrayView<const dtype> view(index_type inRowIndex, Slice inColSlice) const
+        {
+            return view(toSlice(inRowIndex, shape_.rows), inColSlice);
+        }
+
         //============================================================================
         // Method Description:
         /// Fills the array with zeros
@@ -5013,6 +5177,24 @@ namespace nc
             endianess_                = Endian::NATIVE;
         }
 
+        //============================================================================
+        // Method Description:
+        /// The single element slice of an index, negative indices counting from the end
+        ///
+        /// @param inIndex
+        /// @param inSize: size of the indexed dimension
+        /// @return Slice
+        ///
+        static Slice toSlice(index_type inIndex, size_type inSize) noexcept
+        {
+            if (inIndex < 0)
+            {
+                inIndex += static_cast<index_type>(inSize);
+            }
+
+            return Slice(inIndex, inIndex + 1);
+        }
+
         //============================================================================
         // Method Description:
         /// Creates a new internal array
@@ -0,0 +1,1615 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+///
+/// License
+/// Copyright 2018-2026 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// Description
+/// Non-owning strided view into an NdArray
+///
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+#include "NumCpp/Core/Enums.hpp"
+#include "NumCpp/Core/Internal/Error.hpp"
+#include "NumCpp/Core/Internal/StaticAsserts.hpp"
+#include "NumCpp/Core/Shape.hpp"
+#include "NumCpp/Core/Slice.hpp"
+#include "NumCpp/Core/Types.hpp"
+#include "NumCpp/NdArray/NdArrayCore.hpp"
+#include "NumCpp/Utils/num2str.hpp"
+
+namespace nc
+{
+    //================================================================================
+    // Class Description:
+    /// Random access iterator over the elements of an NdArrayView in row major order
+    template<typename dtype>
+    class NdArrayViewIterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = std::remove_const_t<dtype>;
+        using pointer           = dtype*;
+        using reference         = dtype&;
+        using difference_type   = std::ptrdiff_t;
+        using size_type         = uint32;
+
+        //============================================================================
+        // Method Description:
+        /// Default Constructor
+        ///
+        NdArrayViewIterator() = default;
+
+        //============================================================================
+        // Method Description:
+        /// Constructor
+        ///
+        /// @param inData: first element of the view
+        /// @param inNumCols: number of columns of the view
+        /// @param inRowStride: elements between consecutive rows
+        /// @param inColStride: elements between consecutive columns
+        /// @param inIndex: flat row major index of the element pointed to
+        ///
+        NdArrayViewIterator(pointer         inData,
+                            size_type       inNumCols,
+                            size_type       inRowStride,
+                            size_type       inColStride,
+                            difference_type inIndex) noexcept :
+            data_(inData),
+            numCols_(inNumCols),
+            rowStride_(inRowStride),
+            colStride_(inColStride)
+        {
+            seek(inIndex);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Converts an iterator to a const iterator
+        ///
+        operator NdArrayViewIterator<const value_type>() const noexcept
+        {
+            return NdArrayViewIterator<const value_type>(data_, numCols_, rowStride_, colStride_, index());
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator dereference
+        ///
+        /// @return reference
+        ///
+        reference operator*() const noexcept
+        {
+            return data_[static_cast<std::size_t>(row_) * rowStride_ + static_cast<std::size_t>(col_) * colStride_];
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator pointer operator
+        ///
+        /// @return pointer
+        ///
+        pointer operator->() const noexcept
+        {
+            return &operator*();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator prefix incrementer
+        ///
+        /// @return NdArrayViewIterator&
+        ///
+        NdArrayViewIterator& operator++() noexcept
+        {
+            if (++col_ == numCols_)
+            {
+                col_ = 0;
+                ++row_;
+            }
+
+            return *this;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator postfix incrementer
+        ///
+        /// @return NdArrayViewIterator
+        ///
+        NdArrayViewIterator operator++(int) noexcept
+        {
+            auto tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator prefix decrementer
+        ///
+        /// @return NdArrayViewIterator&
+        ///
+        NdArrayViewIterator& operator--() noexcept
+        {
+            if (col_ == 0)
+            {
+                col_ = numCols_;
+                --row_;
+            }
+            --col_;
+
+            return *this;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator postfix decrementer
+        ///
+        /// @return NdArrayViewIterator
+        ///
+        NdArrayViewIterator operator--(int) noexcept
+        {
+            auto tmp(*this);
+            --*this;
+            return tmp;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator addition assignment operator
+        ///
+        /// @param offset
+        /// @return NdArrayViewIterator&
+        ///
+        NdArrayViewIterator& operator+=(difference_type offset) noexcept
+        {
+            seek(index() + offset);
+            return *this;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator addition operator
+        ///
+        /// @param offset
+        /// @return NdArrayViewIterator
+        ///
+        NdArrayViewIterator operator+(difference_type offset) const noexcept
+        {
+            auto tmp(*this);
+            return tmp += offset;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator subtraction assignment operator
+        ///
+        /// @param offset
+        /// @return NdArrayViewIterator&
+        ///
+        NdArrayViewIterator& operator-=(difference_type offset) noexcept
+        {
+            return *this += -offset;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator subtraction operator
+        ///
+        /// @param offset
+        /// @return NdArrayViewIterator
+        ///
+        NdArrayViewIterator operator-(difference_type offset) const noexcept
+        {
+            auto tmp(*this);
+            return tmp -= offset;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator difference operator
+        ///
+        /// @param rhs
+        /// @return difference_type
+        ///
+        difference_type operator-(const NdArrayViewIterator& rhs) const noexcept
+        {
+            return index() - rhs.index();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator access operator
+        ///
+        /// @param offset
+        /// @return reference
+        ///
+        reference operator[](difference_type offset) const noexcept
+        {
+            return *(*this + offset);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator equality operator
+        ///
+        /// @param rhs
+        /// @return bool
+        ///
+        bool operator==(const NdArrayViewIterator& rhs) const noexcept
+        {
+            return index() == rhs.index();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator not-equality operator
+        ///
+        /// @param rhs
+        /// @return bool
+        ///
+        bool operator!=(const NdArrayViewIterator& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator less than operator
+        ///
+        /// @param rhs
+        /// @return bool
+        ///
+        bool operator<(const NdArrayViewIterator& rhs) const noexcept
+        {
+            return index() < rhs.index();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator greater than operator
+        ///
+        /// @param rhs
+        /// @return bool
+        ///
+        bool operator>(const NdArrayViewIterator& rhs) const noexcept
+        {
+            return rhs < *this;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator less than equal operator
+        ///
+        /// @param rhs
+        /// @return bool
+        ///
+        bool operator<=(const NdArrayViewIterator& rhs) const noexcept
+        {
+            return !(rhs < *this);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator greater than equal operator
+        ///
+        /// @param rhs
+        /// @return bool
+        ///
+        bool operator>=(const NdArrayViewIterator& rhs) const noexcept
+        {
+            return !(*this < rhs);
+        }
+
+    private:
+        pointer   data_{ nullptr };
+        size_type numCols_{ 0 };
+        size_type rowStride_{ 0 };
+        size_type colStride_{ 0 };
+        size_type row_{ 0 };
+        size_type col_{ 0 };
+
+        //============================================================================
+        // Method Description:
+        /// The flat row major index of the element pointed to
+        ///
+        /// @return difference_type
+        ///
+        [[nodiscard]] difference_type index() const noexcept
+        {
+            return static_cast<difference_type>(row_) * numCols_ + col_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Points the iterator at a flat row major index
+        ///
+        /// @param inIndex
+        ///
+        void seek(difference_type inIndex) noexcept
+        {
+            if (numCols_ == 0)
+            {
+                return;
+            }
+
+            row_ = static_cast<size_type>(inIndex / numCols_);
+            col_ = static_cast<size_type>(inIndex % numCols_);
+        }
+    };
+
+    //============================================================================
+    // Method Description:
+    /// Iterator addition operator
+    ///
+    /// @param offset
+    /// @param next
+    /// @return NdArrayViewIterator
+    ///
+    template<typename dtype>
+    NdArrayViewIterator<dtype> operator+(typename NdArrayViewIterator<dtype>::difference_type offset,
+                                         NdArrayViewIterator<dtype>                           next) noexcept
+    {
+        return next += offset;
+    }
+
+    //================================================================================
+    // Class Description:
+    /// A non-owning window into the data of an NdArray: a shape plus row and column
+    /// strides from a first element. Views are created in O(1) with NdArray::view and
+    /// read and write the array they came from; copy() materializes one into a new
+    /// NdArray. A view is invalidated when its array is resized or destroyed.
+    /// NdArrayView<const dtype> is the read only view of a const array.
+    template<typename dtype>
+    class NdArrayView
+    {
+    public:
+        using self_type       = NdArrayView<dtype>;
+        using value_type      = std::remove_const_t<dtype>;
+        using pointer         = dtype*;
+        using reference       = dtype&;
+        using const_reference = const value_type&;
+        using size_type       = uint32;
+        using index_type      = int32;
+        using difference_type = std::ptrdiff_t;
+
+        using iterator       = NdArrayViewIterator<dtype>;
+        using const_iterator = NdArrayViewIterator<const value_type>;
+
+        //============================================================================
+        // Method Description:
+        /// Default Constructor, an empty view
+        ///
+        NdArrayView() = default;
+
+        //============================================================================
+        // Method Description:
+        /// Constructor
+        ///
+        /// @param inData: first element of the view
+        /// @param inShape: rows and columns of the view
+        /// @param inRowStride: elements between consecutive rows
+        /// @param inColStride: elements between consecutive columns
+        ///
+        NdArrayView(pointer inData, const Shape& inShape, size_type inRowStride, size_type inColStride) noexcept :
+            data_(inData),
+            shape_(inShape),
+            rowStride_(inRowStride),
+            colStride_(inColStride)
+        {
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Converts a view to a read only view
+        ///
+        /// @param inOtherView
+        ///
+        template<typename OtherDtype, std::enable_if_t<std::is_same_v<const OtherDtype, dtype>, int> = 0>
+        NdArrayView(const NdArrayView<OtherDtype>& inOtherView) noexcept :
+            data_(inOtherView.data()),
+            shape_(inOtherView.shape()),
+            rowStride_(inOtherView.rowStride()),
+            colStride_(inOtherView.colStride())
+        {
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Pointer to the first element of the view
+        ///
+        /// @return pointer
+        ///
+        [[nodiscard]] pointer data() const noexcept
+        {
+            return data_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The shape of the view
+        ///
+        /// @return Shape
+        ///
+        [[nodiscard]] Shape shape() const noexcept
+        {
+            return shape_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The number of rows of the view
+        ///
+        /// @return size_type
+        ///
+        [[nodiscard]] size_type numRows() const noexcept
+        {
+            return shape_.rows;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The number of columns of the view
+        ///
+        /// @return size_type
+        ///
+        [[nodiscard]] size_type numCols() const noexcept
+        {
+            return shape_.cols;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The number of elements in the view
+        ///
+        /// @return size_type
+        ///
+        [[nodiscard]] size_type size() const noexcept
+        {
+            return shape_.size();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns whether the view has any elements
+        ///
+        /// @return bool
+        ///
+        [[nodiscard]] bool isempty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Elements between consecutive rows in the underlying array
+        ///
+        /// @return size_type
+        ///
+        [[nodiscard]] size_type rowStride() const noexcept
+        {
+            return rowStride_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Elements between consecutive columns in the underlying array
+        ///
+        /// @return size_type
+        ///
+        [[nodiscard]] size_type colStride() const noexcept
+        {
+            return colStride_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns whether the elements of the view are contiguous in row major order
+        ///
+        /// @return bool
+        ///
+        [[nodiscard]] bool iscontiguous() const noexcept
+        {
+            return (shape_.cols <= 1 || colStride_ == 1) &&
+                   (shape_.rows <= 1 || rowStride_ == shape_.cols * colStride_);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// 1D access operator in row major order with no bounds checking
+        ///
+        /// @param inIndex
+        /// @return reference
+        ///
+        reference operator[](index_type inIndex) const noexcept
+        {
+            if (inIndex < 0)
+            {
+                inIndex += static_cast<index_type>(size());
+            }
+
+            const auto index = static_cast<size_type>(inIndex);
+            return element(index / shape_.cols, index % shape_.cols);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// 2D access operator with no bounds checking
+        ///
+        /// @param inRowIndex
+        /// @param inColIndex
+        /// @return reference
+        ///
+        reference operator()(index_type inRowIndex, index_type inColIndex) const noexcept
+        {
+            if (inRowIndex < 0)
+            {
+                inRowIndex += static_cast<index_type>(shape_.rows);
+            }
+
+            if (inColIndex < 0)
+            {
+                inColIndex += static_cast<index_type>(shape_.cols);
+            }
+
+            return element(static_cast<size_type>(inRowIndex), static_cast<size_type>(inColIndex));
+        }
+
+        //============================================================================
+        // Method Description:
+        /// 1D access method in row major order with bounds checking
+        ///
+        /// @param inIndex
+        /// @return reference
+        ///
+        [[nodiscard]] reference at(index_type inIndex) const
+        {
+            if (std::abs(inIndex) > static_cast<int64>(size()) - 1)
+            {
+                std::string errStr = "Input index " + utils::num2str(inIndex);
+                errStr += " is out of bounds for view of size " + utils::num2str(size()) + ".";
+                THROW_INVALID_ARGUMENT_ERROR(errStr);
+            }
+
+            return operator[](inIndex);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// 2D access method with bounds checking
+        ///
+        /// @param inRowIndex
+        /// @param inColIndex
+        /// @return reference
+        ///
+        [[nodiscard]] reference at(index_type inRowIndex, index_type inColIndex) const
+        {
+            if (std::abs(inRowIndex) > static_cast<int64>(shape_.rows) - 1)
+            {
+                std::string errStr = "Row index " + utils::num2str(inRowIndex);
+                errStr += " is out of bounds for view of size " + utils::num2str(shape_.rows) + ".";
+                THROW_INVALID_ARGUMENT_ERROR(errStr);
+            }
+
+            if (std::abs(inColIndex) > static_cast<int64>(shape_.cols) - 1)
+            {
+                std::string errStr = "Column index " + utils::num2str(inColIndex);
+                errStr += " is out of bounds for view of size " + utils::num2str(shape_.cols) + ".";
+                THROW_INVALID_ARGUMENT_ERROR(errStr);
+            }
+
+            return operator()(inRowIndex, inColIndex);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a view of a 2D slice of this view
+        ///
+        /// @param inRowSlice
+        /// @param inColSlice
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] self_type view(Slice inRowSlice, Slice inColSlice) const
+        {
+            const auto numRows = inRowSlice.numElements(shape_.rows);
+            const auto numCols = inColSlice.numElements(shape_.cols);
+            if (numRows == 0 || numCols == 0)
+            {
+                return {};
+            }
+
+            const auto rowStart = static_cast<size_type>(inRowSlice.start);
+            const auto colStart = static_cast<size_type>(inColSlice.start);
+            return self_type(&element(rowStart, colStart),
+                             Shape(numRows, numCols),
+                             rowStride_ * static_cast<size_type>(inRowSlice.step),
+                             colStride_ * static_cast<size_type>(inColSlice.step));
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a view of a single row
+        ///
+        /// @param inRow
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] self_type row(size_type inRow) const
+        {
+            const auto rowIndex = static_cast<index_type>(inRow);
+            return view(Slice(rowIndex, rowIndex + 1), Slice(0, static_cast<index_type>(shape_.cols)));
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns a view of a single column
+        ///
+        /// @param inColumn
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] self_type column(size_type inColumn) const
+        {
+            const auto colIndex = static_cast<index_type>(inColumn);
+            return view(Slice(0, static_cast<index_type>(shape_.rows)), Slice(colIndex, colIndex + 1));
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the transposed view, without copying
+        ///
+        /// @return NdArrayView
+        ///
+        [[nodiscard]] self_type transpose() const noexcept
+        {
+            return self_type(data_, Shape(shape_.cols, shape_.rows), colStride_, rowStride_);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator to the first element in row major order
+        ///
+        /// @return iterator
+        ///
+        [[nodiscard]] iterator begin() const noexcept
+        {
+            return iterator(data_, shape_.cols, rowStride_, colStride_, 0);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Iterator past the last element in row major order
+        ///
+        /// @return iterator
+        ///
+        [[nodiscard]] iterator end() const noexcept
+        {
+            return iterator(data_, shape_.cols, rowStride_, colStride_, size());
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Const iterator to the first element in row major order
+        ///
+        /// @return const_iterator
+        ///
+        [[nodiscard]] const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Const iterator past the last element in row major order
+        ///
+        /// @return const_iterator
+        ///
+        [[nodiscard]] const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Copies the elements of the view into a new contiguous array
+        ///
+        /// @return NdArray
+        ///
+        [[nodiscard]] NdArray<value_type> copy() const
+        {
+            NdArray<value_type> returnArray(shape_);
+            auto                out = returnArray.begin();
+            for (size_type row = 0; row < shape_.rows; ++row)
+            {
+                const auto* in = rowData(row);
+                if (colStride_ == 1)
+                {
+                    out = std::copy(in, in + shape_.cols, out);
+                }
+                else
+                {
+                    for (size_type col = 0; col < shape_.cols; ++col)
+                    {
+                        *out++ = in[static_cast<std::size_t>(col) * colStride_];
+                    }
+                }
+            }
+
+            return returnArray;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Fills the view with a value
+        ///
+        /// @param inFillValue
+        /// @return NdArrayView&
+        ///
+        self_type& fill(value_type inFillValue)
+        {
+            return apply([inFillValue](value_type) { return inFillValue; });
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Copies the values of an array of the same shape into the view
+        ///
+        /// @param inValues
+        /// @return NdArrayView&
+        ///
+        self_type& assign(const NdArrayView<const value_type>& inValues)
+        {
+            return apply(inValues, [](value_type, value_type rhs) { return rhs; });
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Copies the values of an array of the same shape into the view
+        ///
+        /// @param inValues
+        /// @return NdArrayView&
+        ///
+        self_type& assign(const NdArray<value_type>& inValues)
+        {
+            return assign(inValues.view());
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Adds a scalar to each element of the view
+        ///
+        /// @param inScalar
+        /// @return NdArrayView&
+        ///
+        self_type& operator+=(value_type inScalar)
+        {
+            return apply([inScalar](value_type value) { return value + inScalar; });
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Adds the elements of an array of the same shape to the view
+        ///
+        /// @param inOther
+        /// @return NdArrayView&
+        ///
+        self_type& operator+=(const NdArrayView<const value_type>& inOther)
+        {
+            return apply(inOther, std::plus<value_type>());
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Adds the elements of an array of the same shape to the view
+        ///
+        /// @param inOther
+        /// @return NdArrayView&
+        ///
+        self_type& operator+=(const NdArray<value_type>& inOther)
+        {
+            return *this += inOther.view();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Subtracts a scalar from each element of the view
+        ///
+        /// @param inScalar
+        /// @return NdArrayView&
+        ///
+        self_type& operator-=(value_type inScalar)
+        {
+            return apply([inScalar](value_type value) { return value - inScalar; });
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Subtracts the elements of an array of the same shape from the view
+        ///
+        /// @param inOther
+        /// @return NdArrayView&
+        ///
+        self_type& operator-=(const NdArrayView<const value_type>& inOther)
+        {
+            return apply(inOther, std::minus<value_type>());
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Subtracts the elements of an array of the same shape from the view
+        ///
+        /// @param inOther
+        /// @return NdArrayView&
+        ///
+        self_type& operator-=(const NdArray<value_type>& inOther)
+        {
+            return *this -= inOther.view();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Multiplies each element of the view by a scalar
+        ///
+        /// @param inScalar
+        /// @return NdArrayView&
+        ///
+        self_type& operator*=(value_type inScalar)
+        {
+            return apply([inScalar](value_type value) { return value * inScalar; });
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Multiplies the view by the elements of an array of the same shape
+        ///
+        /// @param inOther
+        /// @return NdArrayView&
+        ///
+        self_type& operator*=(const NdArrayView<const value_type>& inOther)
+        {
+            return apply(inOther, std::multiplies<value_type>());
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Multiplies the view by the elements of an array of the same shape
+        ///
+        /// @param inOther
+        /// @return NdArrayView&
+        ///
+        self_type& operator*=(const NdArray<value_type>& inOther)
+        {
+            return *this *= inOther.view();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Divides each element of the view by a scalar
+        ///
+        /// @param inScalar
+        /// @return NdArrayView&
+        ///
+        self_type& operator/=(value_type inScalar)
+        {
+            return apply([inScalar](value_type value) { return value / inScalar; });
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Divides the view by the elements of an array of the same shape
+        ///
+        /// @param inOther
+        /// @return NdArrayView&
+        ///
+        self_type& operator/=(const NdArrayView<const value_type>& inOther)
+        {
+            return apply(inOther, std::divides<value_type>());
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Divides the view by the elements of an array of the same shape
+        ///
+        /// @param inOther
+        /// @return NdArrayView&
+        ///
+        self_type& operator/=(const NdArray<value_type>& inOther)
+        {
+            return *this /= inOther.view();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Sum of the elements over the given axis
+        ///
+        /// @param inAxis (Optional, default NONE)
+        /// @return NdArray
+        ///
+        [[nodiscard]] NdArray<value_type> sum(Axis inAxis = Axis::NONE) const
+        {
+            STATIC_ASSERT_ARITHMETIC_OR_COMPLEX(value_type);
+
+            return reduce(inAxis, value_type{ 0 }, std::plus<value_type>());
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Product of the elements over the given axis
+        ///
+        /// @param inAxis (Optional, default NONE)
+        /// @return NdArray
+        ///
+        [[nodiscard]] NdArray<value_type> prod(Axis inAxis = Axis::NONE) const
+        {
+            STATIC_ASSERT_ARITHMETIC_OR_COMPLEX(value_type);
+
+            return reduce(inAxis, value_type{ 1 }, std::multiplies<value_type>());
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Minimum of the elements over the given axis
+        ///
+        /// @param inAxis (Optional, default NONE)
+        /// @return NdArray
+        ///
+        [[nodiscard]] NdArray<value_type> min(Axis inAxis = Axis::NONE) const
+        {
+            STATIC_ASSERT_ARITHMETIC_OR_COMPLEX(value_type);
+
+            return reduceFromFirst(inAxis, [](value_type lhs, value_type rhs) { return rhs < lhs ? rhs : lhs; });
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Maximum of the elements over the given axis
+        ///
+        /// @param inAxis (Optional, default NONE)
+        /// @return NdArray
+        ///
+        [[nodiscard]] NdArray<value_type> max(Axis inAxis = Axis::NONE) const
+        {
+            STATIC_ASSERT_ARITHMETIC_OR_COMPLEX(value_type);
+
+            return reduceFromFirst(inAxis, [](value_type lhs, value_type rhs) { return lhs < rhs ? rhs : lhs; });
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Returns the view as a string representation
+        ///
+        /// @return string
+        ///
+        [[nodiscard]] std::string str() const
+        {
+            return copy().str();
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Prints the view to the console.
+        ///
+        void print() const
+        {
+            std::cout << *this;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// IO operator for the NdArrayView class
+        ///
+        /// @param inOStream
+        /// @param inView
+        /// @return std::ostream
+        ///
+        friend std::ostream& operator<<(std::ostream& inOStream, const self_type& inView)
+        {
+            inOStream << inView.str();
+            return inOStream;
+        }
+
+    private:
+        pointer   data_{ nullptr };
+        Shape     shape_{ 0, 0 };
+        size_type rowStride_{ 0 };
+        size_type colStride_{ 0 };
+
+        //============================================================================
+        // Method Description:
+        /// Element reference from non negative indices
+        ///
+        /// @param inRow
+        /// @param inCol
+        /// @return reference
+        ///
+        reference element(size_type inRow, size_type inCol) const noexcept
+        {
+            return data_[static_cast<std::size_t>(inRow) * rowStride_ + static_cast<std::size_t>(inCol) * colStride_];
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Pointer to the first element of a row
+        ///
+        /// @param inRow
+        /// @return pointer
+        ///
+        pointer rowData(size_type inRow) const noexcept
+        {
+            return data_ + static_cast<std::size_t>(inRow) * rowStride_;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Replaces each element with function(element)
+        ///
+        /// @param function
+        /// @return NdArrayView&
+        ///
+        template<typename Function>
+        self_type& apply(Function&& function)
+        {
+            static_assert(!std::is_const_v<dtype>, "a read only view cannot be modified");
+
+            for (size_type row = 0; row < shape_.rows; ++row)
+            {
+                auto* out = rowData(row);
+                for (size_type col = 0; col < shape_.cols; ++col)
+                {
+                    auto& value = out[static_cast<std::size_t>(col) * colStride_];
+                    value       = function(value);
+                }
+            }
+
+            return *this;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Replaces each element with function(element, other element)
+        ///
+        /// @param inOther: view of the same shape
+        /// @param function
+        /// @return NdArrayView&
+        ///
+        template<typename Function>
+        self_type& apply(const NdArrayView<const value_type>& inOther, Function&& function)
+        {
+            static_assert(!std::is_const_v<dtype>, "a read only view cannot be modified");
+
+            if (inOther.shape() != shape_)
+            {
+                THROW_INVALID_ARGUMENT_ERROR("Array dimensions do not match.");
+            }
+
+            if (overlaps(inOther))
+            {
+                const auto other = inOther.copy();
+                return apply(other.view(), function);
+            }
+
+            for (size_type row = 0; row < shape_.rows; ++row)
+            {
+                auto*       out = rowData(row);
+                const auto* in  = inOther.data() + static_cast<std::size_t>(row) * inOther.rowStride();
+                for (size_type col = 0; col < shape_.cols; ++col)
+                {
+                    auto& value = out[static_cast<std::size_t>(col) * colStride_];
+                    value       = function(value, in[static_cast<std::size_t>(col) * inOther.colStride()]);
+                }
+            }
+
+            return *this;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Whether the memory spanned by another view overlaps this one
+        ///
+        /// @param inOther
+        /// @return bool
+        ///
+        [[nodiscard]] bool overlaps(const NdArrayView<const value_type>& inOther) const noexcept
+        {
+            if (isempty() || inOther.isempty())
+            {
+                return false;
+            }
+
+            const auto* first      = static_cast<const value_type*>(data_);
+            const auto* last       = &element(shape_.rows - 1, shape_.cols - 1);
+            const auto* otherFirst = inOther.data();
+            const auto* otherLast  = &inOther(-1, -1);
+
+            const std::less<const value_type*> less;
+            return !less(last, otherFirst) && !less(otherLast, first);
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Folds the elements over an axis starting from an initial value
+        ///
+        /// @param inAxis
+        /// @param inInitialValue
+        /// @param function
+        /// @return NdArray
+        ///
+        template<typename Function>
+        NdArray<value_type> reduce(Axis inAxis, value_type inInitialValue, Function function) const
+        {
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    NdArray<value_type> returnArray = { inInitialValue };
+                    for (size_type row = 0; row < shape_.rows; ++row)
+                    {
+                        returnArray.front() = reduceRow(row, returnArray.front(), function);
+                    }
+
+                    return returnArray;
+                }
+                case Axis::COL:
+                {
+                    NdArray<value_type> returnArray(1, shape_.rows);
+                    for (size_type row = 0; row < shape_.rows; ++row)
+                    {
+                        returnArray(0, row) = reduceRow(row, inInitialValue, function);
+                    }
+
+                    return returnArray;
+                }
+                case Axis::ROW:
+                {
+                    return transpose().reduce(Axis::COL, inInitialValue, function);
+                }
+                default:
+                {
+                    THROW_INVALID_ARGUMENT_ERROR("Unimplemented axis type.");
+                    return {}; // get rid of compiler warning
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Folds the elements over an axis starting from the first element
+        ///
+        /// @param inAxis
+        /// @param function
+        /// @return NdArray
+        ///
+        template<typename Function>
+        NdArray<value_type> reduceFromFirst(Axis inAxis, Function function) const
+        {
+            if (isempty())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("view is empty.");
+            }
+
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    return reduce(Axis::NONE, front(), function);
+                }
+                case Axis::COL:
+                {
+                    NdArray<value_type> returnArray(1, shape_.rows);
+                    for (size_type row = 0; row < shape_.rows; ++row)
+                    {
+                        returnArray(0, row) = reduceRow(row, *rowData(row), function);
+                    }
+
+                    return returnArray;
+                }
+                case Axis::ROW:
+                {
+                    return transpose().reduceFromFirst(Axis::COL, function);
+                }
+                default:
+                {
+                    THROW_INVALID_ARGUMENT_ERROR("Unimplemented axis type.");
+                    return {}; // get rid of compiler warning
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Folds the elements of one row
+        ///
+        /// @param inRow
+        /// @param inInitialValue
+        /// @param function
+        /// @return value
+        ///
+        template<typename Function>
+        value_type reduceRow(size_type inRow, value_type inInitialValue, Function& function) const
+        {
+            const auto* in     = rowData(inRow);
+            auto        result = inInitialValue;
+            for (size_type col = 0; col < shape_.cols; ++col)
+            {
+                result = function(result, in[static_cast<std::size_t>(col) * colStride_]);
+            }
+
+            return result;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// The first element
+        ///
+        /// @return value
+        ///
+        [[nodiscard]] value_type front() const noexcept
+        {
+            return *data_;
+        }
+    };
+
+    namespace detail
+    {
+        //============================================================================
+        // Method Description:
+        /// Element wise function of two same shaped views into a new array
+        ///
+        /// @param inLhs
+        /// @param inRhs
+        /// @param function
+        /// @return NdArray
+        ///
+        template<typename dtype, typename Function>
+        NdArray<dtype> transformViews(const NdArrayView<const dtype>& inLhs,
+                                      const NdArrayView<const dtype>& inRhs,
+                                      Function                        function)
+        {
+            if (inLhs.shape() != inRhs.shape())
+            {
+                THROW_INVALID_ARGUMENT_ERROR("Array dimensions do not match.");
+            }
+
+            NdArray<dtype> returnArray(inLhs.shape());
+            std::transform(inLhs.cbegin(), inLhs.cend(), inRhs.cbegin(), returnArray.begin(), function);
+            return returnArray;
+        }
+
+        //============================================================================
+        // Method Description:
+        /// Element wise function of a view into a new array
+        ///
+        /// @param inView
+        /// @param function
+        /// @return NdArray
+        ///
+        template<typename dtype, typename Function>
+        NdArray<dtype> transformView(const NdArrayView<const dtype>& inView, Function function)
+        {
+            NdArray<dtype> returnArray(inView.shape());
+            std::transform(inView.cbegin(), inView.cend(), returnArray.begin(), function);
+            return returnArray;
+        }
+    } // namespace detail
+
+    //============================================================================
+    // Method Description:
+    /// Adds the elements of two views
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename LhsDtype,
+             typename RhsDtype,
+             std::enable_if_t<std::is_same_v<std::remove_const_t<LhsDtype>, std::remove_const_t<RhsDtype>>, int> = 0>
+    NdArray<std::remove_const_t<LhsDtype>> operator+(const NdArrayView<LhsDtype>& lhs, const NdArrayView<RhsDtype>& rhs)
+    {
+        return detail::transformViews<std::remove_const_t<LhsDtype>>(lhs, rhs, std::plus<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Adds a view and an array
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator+(const NdArrayView<dtype>&                  lhs,
+                                                  const NdArray<std::remove_const_t<dtype>>& rhs)
+    {
+        return detail::transformViews<std::remove_const_t<dtype>>(lhs, rhs.view(), std::plus<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Adds an array and a view
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator+(const NdArray<std::remove_const_t<dtype>>& lhs,
+                                                  const NdArrayView<dtype>&                  rhs)
+    {
+        return detail::transformViews<std::remove_const_t<dtype>>(lhs.view(), rhs, std::plus<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Adds a scalar to the elements of a view
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator+(const NdArrayView<dtype>& lhs, std::remove_const_t<dtype> rhs)
+    {
+        return detail::transformView<std::remove_const_t<dtype>>(lhs, [rhs](auto value) { return value + rhs; });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Adds the elements of a view to a scalar
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator+(std::remove_const_t<dtype> lhs, const NdArrayView<dtype>& rhs)
+    {
+        return detail::transformView<std::remove_const_t<dtype>>(rhs, [lhs](auto value) { return lhs + value; });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Subtracts the elements of two views
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename LhsDtype,
+             typename RhsDtype,
+             std::enable_if_t<std::is_same_v<std::remove_const_t<LhsDtype>, std::remove_const_t<RhsDtype>>, int> = 0>
+    NdArray<std::remove_const_t<LhsDtype>> operator-(const NdArrayView<LhsDtype>& lhs, const NdArrayView<RhsDtype>& rhs)
+    {
+        return detail::transformViews<std::remove_const_t<LhsDtype>>(lhs, rhs, std::minus<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Subtracts an array from a view
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator-(const NdArrayView<dtype>&                  lhs,
+                                                  const NdArray<std::remove_const_t<dtype>>& rhs)
+    {
+        return detail::transformViews<std::remove_const_t<dtype>>(lhs, rhs.view(), std::minus<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Subtracts a view from an array
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator-(const NdArray<std::remove_const_t<dtype>>& lhs,
+                                                  const NdArrayView<dtype>&                  rhs)
+    {
+        return detail::transformViews<std::remove_const_t<dtype>>(lhs.view(), rhs, std::minus<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Subtracts a scalar from the elements of a view
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator-(const NdArrayView<dtype>& lhs, std::remove_const_t<dtype> rhs)
+    {
+        return detail::transformView<std::remove_const_t<dtype>>(lhs, [rhs](auto value) { return value - rhs; });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Subtracts the elements of a view from a scalar
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator-(std::remove_const_t<dtype> lhs, const NdArrayView<dtype>& rhs)
+    {
+        return detail::transformView<std::remove_const_t<dtype>>(rhs, [lhs](auto value) { return lhs - value; });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Multiplies the elements of two views
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename LhsDtype,
+             typename RhsDtype,
+             std::enable_if_t<std::is_same_v<std::remove_const_t<LhsDtype>, std::remove_const_t<RhsDtype>>, int> = 0>
+    NdArray<std::remove_const_t<LhsDtype>> operator*(const NdArrayView<LhsDtype>& lhs, const NdArrayView<RhsDtype>& rhs)
+    {
+        return detail::transformViews<std::remove_const_t<LhsDtype>>(lhs, rhs, std::multiplies<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Multiplies a view and an array
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator*(const NdArrayView<dtype>&                  lhs,
+                                                  const NdArray<std::remove_const_t<dtype>>& rhs)
+    {
+        return detail::transformViews<std::remove_const_t<dtype>>(lhs, rhs.view(), std::multiplies<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Multiplies an array and a view
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator*(const NdArray<std::remove_const_t<dtype>>& lhs,
+                                                  const NdArrayView<dtype>&                  rhs)
+    {
+        return detail::transformViews<std::remove_const_t<dtype>>(lhs.view(), rhs, std::multiplies<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Multiplies the elements of a view by a scalar
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator*(const NdArrayView<dtype>& lhs, std::remove_const_t<dtype> rhs)
+    {
+        return detail::transformView<std::remove_const_t<dtype>>(lhs, [rhs](auto value) { return value * rhs; });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Multiplies a scalar by the elements of a view
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator*(std::remove_const_t<dtype> lhs, const NdArrayView<dtype>& rhs)
+    {
+        return detail::transformView<std::remove_const_t<dtype>>(rhs, [lhs](auto value) { return lhs * value; });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Divides the elements of two views
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename LhsDtype,
+             typename RhsDtype,
+             std::enable_if_t<std::is_same_v<std::remove_const_t<LhsDtype>, std::remove_const_t<RhsDtype>>, int> = 0>
+    NdArray<std::remove_const_t<LhsDtype>> operator/(const NdArrayView<LhsDtype>& lhs, const NdArrayView<RhsDtype>& rhs)
+    {
+        return detail::transformViews<std::remove_const_t<LhsDtype>>(lhs, rhs, std::divides<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Divides a view by an array
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator/(const NdArrayView<dtype>&                  lhs,
+                                                  const NdArray<std::remove_const_t<dtype>>& rhs)
+    {
+        return detail::transformViews<std::remove_const_t<dtype>>(lhs, rhs.view(), std::divides<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Divides an array by a view
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator/(const NdArray<std::remove_const_t<dtype>>& lhs,
+                                                  const NdArrayView<dtype>&                  rhs)
+    {
+        return detail::transformViews<std::remove_const_t<dtype>>(lhs.view(), rhs, std::divides<>());
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Divides the elements of a view by a scalar
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator/(const NdArrayView<dtype>& lhs, std::remove_const_t<dtype> rhs)
+    {
+        return detail::transformView<std::remove_const_t<dtype>>(lhs, [rhs](auto value) { return value / rhs; });
+    }
+
+    //============================================================================
+    // Method Description:
+    /// Divides a scalar by the elements of a view
+    ///
+    /// @param lhs
+    /// @param rhs
+    /// @return NdArray
+    ///
+    template<typename dtype>
+    NdArray<std::remove_const_t<dtype>> operator/(std::remove_const_t<dtype> lhs, const NdArrayView<dtype>& rhs)
+    {
+        return detail::transformView<std::remove_const_t<dtype>>(rhs, [lhs](auto value) { return lhs / value; });
+    }
+} // namespace nc
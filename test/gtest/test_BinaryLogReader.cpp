@@ -0,0 +1,247 @@
+// UNCLASSIFIED
+
+#ifndef NUMCPP_NO_USE_BOOST
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "NumCpp/Logging/BinaryLogReader.hpp"
+#include "NumCpp/Logging/BinaryLogger.hpp"
+
+namespace nc::logger
+{
+    class BinaryLogReaderTestSuite : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            outputDir_ = std::filesystem::temp_directory_path() / "NumCppBinaryLogReaderTests";
+            std::filesystem::remove_all(outputDir_);
+            std::filesystem::create_directories(outputDir_);
+        }
+
+        void TearDown() override
+        {
+            std::filesystem::remove_all(outputDir_);
+        }
+
+        std::filesystem::path outputDir_{};
+    };
+
+    struct Sample
+    {
+        std::int64_t counter{ 0 };
+        float        value{ 0.F };
+        bool         valid{ false };
+    };
+
+    /**
+     * @brief test rotating segments and reading them back
+     */
+    TEST_F(BinaryLogReaderTestSuite, TestSegmentedLog)
+    {
+        constexpr std::uint64_t NUM_ELEMENTS   = 10000;
+        constexpr std::uint64_t INDEX_INTERVAL = 100;
+        constexpr std::uint64_t SEGMENT_BYTES  = 4096;
+
+        const auto startTime = std::chrono::system_clock::now();
+        {
+            auto typeLogger = detail::BinaryDataLogger<double>(outputDir_);
+            ASSERT_FALSE(typeLogger.isSegmented());
+            ASSERT_THROW(typeLogger.enableSegments(0), std::invalid_argument);
+            ASSERT_NO_THROW(typeLogger.enableSegments(SEGMENT_BYTES, INDEX_INTERVAL));
+            ASSERT_TRUE(typeLogger.isSegmented());
+            // the empty single log file is replaced by the first segment
+            ASSERT_FALSE(std::filesystem::exists(outputDir_ / "double.log"));
+            ASSERT_TRUE(std::filesystem::exists(outputDir_ / "double.000000.log"));
+
+            auto data = std::vector<double>(NUM_ELEMENTS / 2);
+            std::iota(data.begin(), data.end(), 0.);
+            typeLogger.log(data.data(), data.size());
+            for (auto i = NUM_ELEMENTS / 2; i < NUM_ELEMENTS; ++i)
+            {
+                typeLogger.log(static_cast<double>(i));
+            }
+            typeLogger.flush();
+            ASSERT_LE(std::filesystem::file_size(typeLogger.filepath()), SEGMENT_BYTES);
+        }
+        const auto endTime = std::chrono::system_clock::now();
+
+        const auto reader = BinaryLogReader<double>(outputDir_ / "double.000003.log");
+        ASSERT_EQ(reader.size(), NUM_ELEMENTS);
+        ASSERT_EQ(reader.typeName(), "double");
+        ASSERT_GT(reader.numSegments(), 1U);
+
+        std::uint64_t numElements = 0;
+        for (std::size_t segment = 0; segment < reader.numSegments(); ++segment)
+        {
+            const auto span = reader.segment(segment);
+            ASSERT_EQ(reader.segmentStart(segment), numElements);
+            for (std::size_t i = 0; i < span.size(); ++i)
+            {
+                ASSERT_EQ(span[i], static_cast<double>(numElements + i));
+            }
+            numElements += span.size();
+        }
+        ASSERT_EQ(numElements, NUM_ELEMENTS);
+        ASSERT_THROW(reader.segment(reader.numSegments()), std::out_of_range);
+
+        for (std::uint64_t i = 0; i < NUM_ELEMENTS; i += 37)
+        {
+            ASSERT_EQ(reader[i], static_cast<double>(i));
+            ASSERT_EQ(reader.at(i), static_cast<double>(i));
+        }
+        ASSERT_THROW(reader.at(NUM_ELEMENTS), std::out_of_range);
+
+        // a range across several segments
+        const auto range = reader.range(100, 2000);
+        ASSERT_EQ(range.shape(), Shape(1, 2000));
+        for (uint32 i = 0; i < range.size(); ++i)
+        {
+            ASSERT_EQ(range[i], static_cast<double>(100 + i));
+        }
+        ASSERT_EQ(reader.range(NUM_ELEMENTS, 0).size(), 0U);
+        ASSERT_THROW(reader.range(NUM_ELEMENTS - 10, 11), std::out_of_range);
+
+        const auto& index = reader.index();
+        ASSERT_EQ(index.size(), NUM_ELEMENTS / INDEX_INTERVAL);
+        for (std::size_t i = 0; i < index.size(); ++i)
+        {
+            ASSERT_EQ(index[i].elementIndex, i * INDEX_INTERVAL);
+
+            // the byte offset locates the element in its segment after the 64 byte header
+            std::size_t segment = 0;
+            while (segment + 1 < reader.numSegments() && reader.segmentStart(segment + 1) <= index[i].elementIndex)
+            {
+                ++segment;
+            }
+            const auto elementOffset = index[i].elementIndex - reader.segmentStart(segment);
+            ASSERT_EQ(index[i].byteOffset, 64 + elementOffset * sizeof(double));
+        }
+
+        ASSERT_EQ(reader.findTime(startTime - std::chrono::hours(1)), 0U);
+        ASSERT_EQ(reader.findTime(endTime + std::chrono::hours(1)), NUM_ELEMENTS - INDEX_INTERVAL);
+        const auto time = std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(index[42].timestamp)));
+        ASSERT_GE(reader.findTime(time), index[42].elementIndex);
+        ASSERT_LT(reader.findTime(time), index[42].elementIndex + INDEX_INTERVAL);
+
+        // the element size must match
+        ASSERT_THROW(BinaryLogReader<float>(outputDir_ / "double.log"), std::runtime_error);
+    }
+
+    /**
+     * @brief test an asynchronous segmented log of a struct type
+     */
+    TEST_F(BinaryLogReaderTestSuite, TestAsyncSegmentedLog)
+    {
+        constexpr std::int64_t NUM_ELEMENTS = 50000;
+
+        std::filesystem::path logPath;
+        {
+            auto typeLogger = detail::BinaryDataLogger<Sample>(outputDir_, 256, OverflowPolicy::BLOCK, 1 << 16, 1000);
+            ASSERT_TRUE(typeLogger.isAsync());
+            ASSERT_TRUE(typeLogger.isSegmented());
+            for (std::int64_t i = 0; i < NUM_ELEMENTS; ++i)
+            {
+                typeLogger.log(Sample{ i, static_cast<float>(i) * 0.5F, i % 2 == 0 });
+            }
+            typeLogger.flush();
+            logPath = typeLogger.filepath();
+        }
+
+        // the <type>.log path of a segmented log finds its segments
+        const auto reader = BinaryLogReader<Sample>(std::filesystem::path(logPath).replace_extension().replace_extension(
+            detail::log_format::LOG_EXT));
+        ASSERT_EQ(reader.size(), static_cast<std::uint64_t>(NUM_ELEMENTS));
+        ASSERT_EQ(reader.index().size(), static_cast<std::size_t>(NUM_ELEMENTS / 1000));
+        for (std::int64_t i = 0; i < NUM_ELEMENTS; ++i)
+        {
+            const auto& sample = reader[static_cast<std::uint64_t>(i)];
+            ASSERT_EQ(sample.counter, i);
+            ASSERT_EQ(sample.value, static_cast<float>(i) * 0.5F);
+            ASSERT_EQ(sample.valid, i % 2 == 0);
+        }
+
+        // restarting the log removes the previous segments
+        {
+            auto typeLogger = detail::BinaryDataLogger<Sample>(outputDir_, 0, OverflowPolicy::BLOCK, 1 << 16);
+            typeLogger.log(Sample{});
+        }
+        ASSERT_EQ(BinaryLogReader<Sample>(logPath).size(), 1U);
+        ASSERT_EQ(BinaryLogReader<Sample>(logPath).numSegments(), 1U);
+    }
+
+    /**
+     * @brief test encoding segment headers and reading a single log file
+     */
+    TEST_F(BinaryLogReaderTestSuite, TestHeaders)
+    {
+        const auto header = detail::log_format::SegmentHeader{ 0, 24, 3, 1000, "Sample" };
+        const auto bytes  = detail::log_format::encodeHeader(header);
+        ASSERT_EQ(bytes.size() % detail::log_format::HEADER_ALIGNMENT, 0U);
+
+        const auto decoded = detail::log_format::decodeHeader(bytes.data(), bytes.size());
+        ASSERT_EQ(decoded.headerSize, bytes.size());
+        ASSERT_EQ(decoded.elementSize, header.elementSize);
+        ASSERT_EQ(decoded.segmentNumber, header.segmentNumber);
+        ASSERT_EQ(decoded.firstElement, header.firstElement);
+        ASSERT_EQ(decoded.typeName, header.typeName);
+        ASSERT_THROW(detail::log_format::decodeHeader(bytes.data(), 20), std::runtime_error);
+        ASSERT_THROW(detail::log_format::decodeHeader(bytes.data() + 1, bytes.size() - 1), std::runtime_error);
+
+        // a single log file has no header and no index
+        {
+            auto typeLogger = detail::BinaryDataLogger<int>(outputDir_);
+            auto data       = std::vector<int>(1000);
+            std::iota(data.begin(), data.end(), 0);
+            typeLogger.log(data.data(), data.size());
+        }
+
+        const auto reader = BinaryLogReader<int>(outputDir_ / "int.log");
+        ASSERT_EQ(reader.numSegments(), 1U);
+        ASSERT_EQ(reader.size(), 1000U);
+        ASSERT_TRUE(reader.typeName().empty());
+        ASSERT_TRUE(reader.index().empty());
+        ASSERT_EQ(reader.range(0, 1000).sum().item(), 499500);
+    }
+
+    /**
+     * @brief test reading logs that nothing was written to
+     */
+    TEST_F(BinaryLogReaderTestSuite, TestEmptyLog)
+    {
+        {
+            auto typeLogger = detail::BinaryDataLogger<int>(outputDir_);
+        }
+        ASSERT_EQ(std::filesystem::file_size(outputDir_ / "int.log"), 0U);
+
+        const auto reader = BinaryLogReader<int>(outputDir_ / "int.log");
+        ASSERT_TRUE(reader.empty());
+        ASSERT_EQ(reader.size(), 0U);
+        ASSERT_EQ(reader.numSegments(), 1U);
+        ASSERT_TRUE(reader.segment(0).empty());
+        ASSERT_TRUE(reader.typeName().empty());
+        ASSERT_TRUE(reader.index().empty());
+        ASSERT_EQ(reader.range(0, 0).size(), 0U);
+        ASSERT_THROW(reader.at(0), std::out_of_range);
+
+        // a segment that was created but not written to yet
+        std::ofstream(outputDir_ / "float.000000.log").close();
+        const auto segmentReader = BinaryLogReader<float>(outputDir_ / "float.log");
+        ASSERT_TRUE(segmentReader.empty());
+        ASSERT_EQ(segmentReader.numSegments(), 1U);
+        ASSERT_EQ(segmentReader.findTime(std::chrono::system_clock::now()), 0U);
+    }
+} // namespace nc::logger
+
+#endif // #ifndef NUMCPP_NO_USE_BOOST
+
+// UNCLASSIFIED
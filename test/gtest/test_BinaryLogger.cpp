@@ -5,9 +5,12 @@
 #include "gtest/gtest.h"
 
 #include <chrono>
+#include <cstdint>
+#include <fstream>
 #include <numeric>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "NumCpp/Logging/BinaryLogger.hpp"
@@ -181,6 +184,91 @@ namespace nc::logger
         typeLogger.flush();
         ASSERT_EQ(std::filesystem::file_size(typeLogger.filepath()), expectedSizeBytes);
     }
+
+    /**
+     * @brief test asynchronous Binary Data Logger with several logging threads
+     */
+    TEST_F(BinaryLoggerTestSuite, TestBinaryLoggerAsync)
+    {
+        auto typeLogger = detail::BinaryDataLogger<std::pair<int, double>>(std::filesystem::temp_directory_path());
+        ASSERT_FALSE(typeLogger.isAsync());
+        ASSERT_NO_THROW(typeLogger.enableAsync(64));
+        ASSERT_TRUE(typeLogger.isAsync());
+
+        constexpr int NUM_THREADS  = 4;
+        constexpr int NUM_ELEMENTS = 10000;
+
+        auto threads = std::vector<std::thread>{};
+        for (auto thread = 0; thread < NUM_THREADS; ++thread)
+        {
+            threads.emplace_back(
+                [&typeLogger, thread]
+                {
+                    for (auto i = 0; i < NUM_ELEMENTS; ++i)
+                    {
+                        typeLogger.log(std::make_pair(thread, static_cast<double>(i)));
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        const auto expectedSizeBytes = sizeof(std::pair<int, double>) * NUM_THREADS * NUM_ELEMENTS;
+        typeLogger.flush();
+        ASSERT_EQ(std::filesystem::file_size(typeLogger.filepath()), expectedSizeBytes);
+        ASSERT_EQ(typeLogger.numDropped(), 0U);
+
+        // every thread's elements are written in the order they were logged
+        auto ifile   = std::ifstream(typeLogger.filepath(), std::ios::binary);
+        auto last    = std::vector<double>(NUM_THREADS, -1.0);
+        auto element = std::pair<int, double>{};
+        for (auto i = 0; i < NUM_THREADS * NUM_ELEMENTS; ++i)
+        {
+            ifile.read(reinterpret_cast<char*>(&element), sizeof(element));
+            ASSERT_EQ(element.second, last[element.first] + 1.0);
+            last[element.first] = element.second;
+        }
+
+        ASSERT_NO_THROW(typeLogger.disableAsync());
+        ASSERT_FALSE(typeLogger.isAsync());
+    }
+
+    /**
+     * @brief test asynchronous Binary Data Logger overflow policies
+     */
+    TEST_F(BinaryLoggerTestSuite, TestBinaryLoggerAsyncOverflow)
+    {
+        constexpr int NUM_ELEMENTS = 100000;
+
+        auto dropLogger =
+            detail::BinaryDataLogger<BaseDataType>(std::filesystem::temp_directory_path(), 4, OverflowPolicy::DROP);
+        const auto data = BaseDataType{};
+        for (auto i = 0; i < NUM_ELEMENTS; ++i)
+        {
+            ASSERT_NO_THROW(dropLogger.log(data));
+        }
+
+        dropLogger.disableAsync();
+        const auto numWritten = std::filesystem::file_size(dropLogger.filepath()) / sizeof(BaseDataType);
+        ASSERT_EQ(numWritten + dropLogger.numDropped(), static_cast<std::uint64_t>(NUM_ELEMENTS));
+
+        using SerialDataTypeDouble = SerialDataType<double>;
+        auto blockLogger           = detail::BinaryDataLogger<SerialDataTypeDouble>(std::filesystem::temp_directory_path(),
+                                                                          4,
+                                                                          OverflowPolicy::BLOCK);
+        const auto serialData      = SerialDataTypeDouble{ 10 };
+        for (auto i = 0; i < NUM_ELEMENTS; ++i)
+        {
+            ASSERT_NO_THROW(blockLogger.log(serialData));
+        }
+
+        blockLogger.flush();
+        ASSERT_EQ(std::filesystem::file_size(blockLogger.filepath()), serialData.numBytes() * NUM_ELEMENTS);
+        ASSERT_EQ(blockLogger.numDropped(), 0U);
+    }
 } // namespace nc::logger
 
 #endif // #ifndef NUMCPP_NO_USE_BOOST
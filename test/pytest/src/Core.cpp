@@ -80,6 +80,36 @@ void initCore(pb11::module &m)
         .def("tic", &MicroTimer::tic)
         .def("toc", &MicroTimer::toc);
 
+    // ChunkReader.hpp
+    using ChunkReaderDouble = ChunkReader<double>;
+    pb11::class_<ChunkReaderDouble>(m, "ChunkReader")
+        .def(pb11::init<std::string, uint32>())
+        .def(pb11::init<std::string, uint32, uint32, Endian>())
+        .def("next", &ChunkReaderDouble::next)
+        .def("numRows", &ChunkReaderDouble::numRows)
+        .def("numCols", &ChunkReaderDouble::numCols)
+        .def("chunkRows", &ChunkReaderDouble::chunkRows)
+        .def("numChunks", &ChunkReaderDouble::numChunks);
+
+    // ChunkWriter.hpp
+    using ChunkWriterDouble = ChunkWriter<double>;
+    pb11::class_<ChunkWriterDouble>(m, "ChunkWriter")
+        .def(pb11::init<std::string, Endian>())
+        .def("write", &ChunkWriterDouble::write)
+        .def("close", &ChunkWriterDouble::close)
+        .def("numRows", &ChunkWriterDouble::numRows);
+
+    // MemMap.hpp
+    using MemMapDouble = MemMap<double>;
+    pb11::class_<MemMapDouble>(m, "MemMap")
+        .def(pb11::init<std::string, MapMode>())
+        .def("array",
+             static_cast<NdArray<double>& (MemMapDouble::*)()>(&MemMapDouble::array),
+             pb11::return_value_policy::reference_internal)
+        .def("shape", &MemMapDouble::shape)
+        .def("mode", &MemMapDouble::mode)
+        .def("flush", &MemMapDouble::flush);
+
     // Enums.hpp
     pb11::enum_<Axis>(m, "Axis").value("NONE", Axis::NONE).value("ROW", Axis::ROW).value("COL", Axis::COL);
 
@@ -92,6 +122,23 @@ void initCore(pb11::module &m)
         .value("COPY", PointerPolicy::COPY)
         .value("SHELL", PointerPolicy::SHELL);
 
+    pb11::enum_<MapMode>(m, "MapMode")
+        .value("COPY_ON_WRITE", MapMode::COPY_ON_WRITE)
+        .value("READ_WRITE", MapMode::READ_WRITE);
+
+    pb11::enum_<CubeLayout>(m, "CubeLayout")
+        .value("FRAME_MAJOR", CubeLayout::FRAME_MAJOR)
+        .value("PIXEL_MAJOR", CubeLayout::PIXEL_MAJOR);
+
+    pb11::enum_<SVDMode>(m, "SVDMode")
+        .value("FULL", SVDMode::FULL)
+        .value("THIN", SVDMode::THIN)
+        .value("VALUES", SVDMode::VALUES);
+
+    pb11::enum_<NllsMethod>(m, "NllsMethod")
+        .value("GAUSS_NEWTON", NllsMethod::GAUSS_NEWTON)
+        .value("LEVENBERG_MARQUARDT", NllsMethod::LEVENBERG_MARQUARDT);
+
     pb11::enum_<Bias>(m, "Bias").value("YES", Bias::YES).value("NO", Bias::NO);
 
     pb11::enum_<EndPoint>(m, "EndPoint").value("YES", EndPoint::YES).value("NO", EndPoint::NO);
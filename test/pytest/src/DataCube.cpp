@@ -22,6 +22,40 @@ namespace DataCubeInterface
 
     //================================================================================
 
+    template<typename dtype>
+    NdArray<dtype> getItemConst(const DataCube<dtype>& self, uint32 inIndex)
+    {
+        return self[inIndex];
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    uint32 numIteratedFrames(DataCube<dtype>& self)
+    {
+        uint32 numFrames = 0;
+        for ([[maybe_unused]] auto& frame : self)
+        {
+            ++numFrames;
+        }
+        return numFrames;
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    uint32 numIteratedFramesConst(const DataCube<dtype>& self)
+    {
+        uint32 numFrames = 0;
+        for ([[maybe_unused]] const auto& frame : self)
+        {
+            ++numFrames;
+        }
+        return numFrames;
+    }
+
+    //================================================================================
+
     template<typename dtype>
     pbArrayGeneric sliceZIndexAll(const DataCube<dtype>& self, int32 inIndex)
     {
@@ -183,6 +217,46 @@ namespace DataCubeInterface
     {
         return self.sliceZat(inRow, inCol, inSlice);
     }
+
+    //================================================================================
+
+    template<typename dtype>
+    pbArrayGeneric frameView(const DataCube<dtype>& self, uint32 inIndex)
+    {
+        return nc2pybind(self.frameView(inIndex).copy());
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    void frameViewAssign(DataCube<dtype>& self, uint32 inIndex, const NdArray<dtype>& inValues)
+    {
+        self.frameView(inIndex).assign(inValues);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    pbArrayGeneric pixelViewIndex(const DataCube<dtype>& self, int32 inIndex)
+    {
+        return nc2pybind(self.pixelView(inIndex).copy());
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    pbArrayGeneric pixelViewRowCol(const DataCube<dtype>& self, int32 inRow, int32 inCol)
+    {
+        return nc2pybind(self.pixelView(inRow, inCol).copy());
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    void pixelViewAssign(DataCube<dtype>& self, int32 inRow, int32 inCol, const NdArray<dtype>& inValues)
+    {
+        self.pixelView(inRow, inCol).assign(inValues);
+    }
 } // namespace DataCubeInterface
 
 //================================================================================
@@ -194,14 +268,30 @@ void initDataCube(pb11::module& m)
     pb11::class_<DataCubeDouble>(m, "DataCube")
         .def(pb11::init<>())
         .def(pb11::init<uint32>())
+        .def(pb11::init<Shape, uint32, CubeLayout>())
+        .def(pb11::init<std::string, CubeLayout, MapMode>())
+        .def(pb11::init<std::string, Shape, CubeLayout, MapMode>())
         .def("at", &DataCubeInterface::at<double>, pb11::return_value_policy::reference)
         .def("__getitem__", &DataCubeInterface::getItem<double>, pb11::return_value_policy::reference)
+        .def("getItemConst", &DataCubeInterface::getItemConst<double>)
         .def("back", &DataCubeDouble::back, pb11::return_value_policy::reference)
         .def("dump", &DataCubeDouble::dump)
+        .def("flush", &DataCubeDouble::flush)
+        .def("frameView", &DataCubeInterface::frameView<double>)
+        .def("frameViewAssign", &DataCubeInterface::frameViewAssign<double>)
         .def("front", &DataCubeDouble::front, pb11::return_value_policy::reference)
         .def("isempty", &DataCubeDouble::isempty)
+        .def("iscontiguous", &DataCubeDouble::iscontiguous)
+        .def("layout", &DataCubeDouble::layout)
+        .def("numIteratedFrames", &DataCubeInterface::numIteratedFrames<double>)
+        .def("numIteratedFramesConst", &DataCubeInterface::numIteratedFramesConst<double>)
+        .def("pixelView", &DataCubeInterface::pixelViewIndex<double>)
+        .def("pixelView", &DataCubeInterface::pixelViewRowCol<double>)
+        .def("pixelViewAssign", &DataCubeInterface::pixelViewAssign<double>)
+        .def("save", &DataCubeDouble::save)
         .def("shape", &DataCubeDouble::shape, pb11::return_value_policy::reference)
         .def("sizeZ", &DataCubeDouble::sizeZ)
+        .def("toLayout", &DataCubeDouble::toLayout)
         .def("pop_back", &DataCubeDouble::pop_back)
         .def("push_back", &DataCubeDouble::push_back)
         .def("sliceZAll", &DataCubeInterface::sliceZIndexAll<double>)
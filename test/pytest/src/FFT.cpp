@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <stdexcept>
 
 //================================================================================
 
@@ -230,6 +231,64 @@ namespace FFTInterface
     {
         return nc2pybind(nc::fft::irfft2(inArray, inShape));
     }
+
+    //================================================================================
+
+    pbArrayGeneric planExecute(const nc::fft::Plan& self, const NdArray<std::complex<double>>& inArray)
+    {
+        if (self.transform() == nc::fft::Transform::IRFFT)
+        {
+            NdArray<double> result;
+            self.execute(inArray, result);
+            return nc2pybind(result);
+        }
+
+        NdArray<std::complex<double>> result;
+        self.execute(inArray, result);
+        return nc2pybind(result);
+    }
+
+    //================================================================================
+
+    pbArrayGeneric planExecuteReal(const nc::fft::Plan& self, const NdArray<double>& inArray)
+    {
+        if (self.transform() == nc::fft::Transform::RFFT)
+        {
+            NdArray<std::complex<double>> result;
+            self.execute(inArray, result);
+            return nc2pybind(result);
+        }
+
+        return planExecute(self, inArray.astype<std::complex<double>>());
+    }
+
+    //================================================================================
+
+    pbArrayGeneric planExecuteReuse(const nc::fft::Plan& self, const NdArray<std::complex<double>>& inArray)
+    {
+        // executes twice into the same output to exercise the non-allocating path
+        NdArray<std::complex<double>> result(self.outputShape());
+        const auto*                   data = result.data();
+        self.execute(inArray, result);
+        self.execute(inArray, result);
+        if (result.data() != data)
+        {
+            throw std::runtime_error("Plan reallocated a correctly sized output.");
+        }
+        return nc2pybind(result);
+    }
+
+    //================================================================================
+
+    void planExecuteInPlace(const nc::fft::Plan& self, NdArray<std::complex<double>>& inOutArray)
+    {
+        const auto* data = inOutArray.data();
+        self.execute(inOutArray, inOutArray);
+        if (inOutArray.data() != data)
+        {
+            throw std::runtime_error("Plan reallocated an in place output.");
+        }
+    }
 } // namespace FFTInterface
 
 //================================================================================
@@ -275,4 +334,22 @@ void initFFT(pb11::module& m)
 
     m.def("irfft2", &FFTInterface::irfft2Complex<double>);
     m.def("irfft2", &FFTInterface::irfft2ComplexShape<double>);
+
+    pb11::enum_<nc::fft::Transform>(m, "Transform")
+        .value("FFT", nc::fft::Transform::FFT)
+        .value("IFFT", nc::fft::Transform::IFFT)
+        .value("RFFT", nc::fft::Transform::RFFT)
+        .value("IRFFT", nc::fft::Transform::IRFFT);
+
+    pb11::class_<nc::fft::Plan>(m, "Plan")
+        .def(pb11::init<uint32, nc::fft::Transform>())
+        .def(pb11::init<const Shape&, nc::fft::Transform>())
+        .def("transform", &nc::fft::Plan::transform)
+        .def("is2d", &nc::fft::Plan::is2d)
+        .def("inputShape", &nc::fft::Plan::inputShape)
+        .def("outputShape", &nc::fft::Plan::outputShape)
+        .def("execute", &FFTInterface::planExecute)
+        .def("execute", &FFTInterface::planExecuteReal)
+        .def("executeReuse", &FFTInterface::planExecuteReuse)
+        .def("executeInPlace", &FFTInterface::planExecuteInPlace);
 }
\ No newline at end of file
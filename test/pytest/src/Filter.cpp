@@ -4,6 +4,32 @@
 
 //================================================================================
 
+namespace FilterInterface
+{
+    template<typename dtype>
+    NdArray<dtype> convolve(const NdArray<dtype>& inImageArray,
+                            uint32                inSize,
+                            const NdArray<dtype>& inWeights,
+                            filter::Boundary      inBoundaryType,
+                            dtype                 inConstantValue)
+    {
+        return filter::convolve(inImageArray, inSize, inWeights, inBoundaryType, inConstantValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype> convolve1d(const NdArray<dtype>& inImageArray,
+                              const NdArray<dtype>& inWeights,
+                              filter::Boundary      inBoundaryType,
+                              dtype                 inConstantValue)
+    {
+        return filter::convolve1d(inImageArray, inWeights, inBoundaryType, inConstantValue);
+    }
+} // namespace FilterInterface
+
+//================================================================================
+
 void initFilter(pb11::module &m)
 {
     // Filters.hpp
@@ -14,12 +40,23 @@ void initFilter(pb11::module &m)
         .value("MIRROR", filter::Boundary::MIRROR)
         .value("WRAP", filter::Boundary::WRAP);
 
+    pb11::enum_<filter::ConvolutionMethod>(m, "ConvolutionMethod")
+        .value("AUTO", filter::ConvolutionMethod::AUTO)
+        .value("DIRECT", filter::ConvolutionMethod::DIRECT)
+        .value("FFT", filter::ConvolutionMethod::FFT);
+
     m.def("complementaryMeanFilter", &filter::complementaryMeanFilter<double>);
     m.def("complementaryMeanFilter1d", &filter::complementaryMeanFilter1d<double>);
     m.def("complementaryMedianFilter", &filter::complementaryMedianFilter<double>);
     m.def("complementaryMedianFilter1d", &filter::complementaryMedianFilter1d<double>);
+    m.def("convolve", &FilterInterface::convolve<double>);
+    m.def("convolve", &FilterInterface::convolve<uint16>);
     m.def("convolve", &filter::convolve<double>);
+    m.def("convolve", &filter::convolve<uint16>);
+    m.def("convolve1d", &FilterInterface::convolve1d<double>);
+    m.def("convolve1d", &FilterInterface::convolve1d<uint16>);
     m.def("convolve1d", &filter::convolve1d<double>);
+    m.def("convolve1d", &filter::convolve1d<uint16>);
     m.def("gaussianFilter", &filter::gaussianFilter<double>);
     m.def("gaussianFilter1d", &filter::gaussianFilter1d<double>);
     m.def("laplaceFilter", &filter::laplace<double>);
@@ -28,13 +65,22 @@ void initFilter(pb11::module &m)
     m.def("meanFilter", &filter::meanFilter<double>);
     m.def("meanFilter1d", &filter::meanFilter1d<double>);
     m.def("medianFilter", &filter::medianFilter<double>);
+    m.def("medianFilter", &filter::medianFilter<uint16>);
+    m.def("medianFilter", &filter::medianFilter<uint8>);
     m.def("medianFilter1d", &filter::medianFilter1d<double>);
+    m.def("medianFilter1d", &filter::medianFilter1d<uint16>);
     m.def("minimumFilter", &filter::minimumFilter<double>);
     m.def("minumumFilter1d", &filter::minumumFilter1d<double>);
     m.def("percentileFilter", &filter::percentileFilter<double>);
+    m.def("percentileFilter", &filter::percentileFilter<uint16>);
+    m.def("percentileFilter", &filter::percentileFilter<uint8>);
     m.def("percentileFilter1d", &filter::percentileFilter1d<double>);
+    m.def("percentileFilter1d", &filter::percentileFilter1d<uint16>);
     m.def("rankFilter", &filter::rankFilter<double>);
+    m.def("rankFilter", &filter::rankFilter<uint16>);
+    m.def("rankFilter", &filter::rankFilter<uint8>);
     m.def("rankFilter1d", &filter::rankFilter1d<double>);
+    m.def("rankFilter1d", &filter::rankFilter1d<uint16>);
     m.def("uniformFilter", &filter::uniformFilter<double>);
     m.def("uniformFilter1d", &filter::uniformFilter1d<double>);
 }
\ No newline at end of file
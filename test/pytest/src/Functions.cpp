@@ -3584,6 +3584,7 @@ void initFunctions(pb11::module& m)
     NdArray<ComplexDouble> (*meanComplexDouble)(const NdArray<ComplexDouble>&, Axis) = &mean<double>;
     m.def("mean", meanComplexDouble);
     m.def("median", &median<double>);
+    m.def("memmap", &memmap<double>);
     m.def("meshgrid", &FunctionsInterface::meshgrid<double>);
     m.def("min", &FunctionsInterface::min<double>);
     m.def("min", &FunctionsInterface::min<ComplexDouble>);
@@ -3772,6 +3773,7 @@ void initFunctions(pb11::module& m)
     m.def("row_stack", &FunctionsInterface::row_stack<double>);
     m.def("row_stack_vec", &FunctionsInterface::row_stack_vec<double>);
 
+    m.def("save", &save<double>);
     m.def("searchsorted", &FunctionsInterface::searchsortedScalar<uint32>);
     m.def("searchsorted", &FunctionsInterface::searchsorted<uint32>);
     m.def("select", &FunctionsInterface::select<double>);
@@ -49,20 +49,42 @@ void initImageProcessing(pb11::module &m)
         .def(pb11::init<>())
         .def(pb11::init<ClusterDouble>())
         .def(pb11::init<CentroidDouble>())
+        .def(pb11::init<double, double, double, double, double, double, double>())
         .def("row", &CentroidDouble::row)
         .def("col", &CentroidDouble::col)
         .def("intensity", &CentroidDouble::intensity)
         .def("eod", &CentroidDouble::eod)
+        .def("a", &CentroidDouble::a)
+        .def("b", &CentroidDouble::b)
+        .def("eccentricity", &CentroidDouble::eccentricity)
+        .def("orientation", &CentroidDouble::orientation)
         .def("__str__", &CentroidDouble::str)
         .def("print", &CentroidDouble::print)
         .def("__eq__", &CentroidDouble::operator==)
         .def("__ne__", &CentroidDouble::operator!=)
         .def("__lt__", &CentroidDouble::operator<);
 
+    using CentroidDetectorDouble = imageProcessing::CentroidDetector<double>;
+    pb11::class_<CentroidDetectorDouble>(m, "CentroidDetector")
+        .def(pb11::init<std::string, uint8>())
+        .def(pb11::init<std::string, uint8, uint32>())
+        .def("detect", &CentroidDetectorDouble::detect)
+        .def("centroids", &CentroidDetectorDouble::centroids);
+
+    using ThresholdGeneratorUint16 = imageProcessing::ThresholdGenerator<uint16>;
+    pb11::class_<ThresholdGeneratorUint16>(m, "ThresholdGeneratorUint16")
+        .def(pb11::init<uint32>())
+        .def("addFrame", &ThresholdGeneratorUint16::addFrame)
+        .def("threshold", &ThresholdGeneratorUint16::threshold)
+        .def("update", &ThresholdGeneratorUint16::update)
+        .def("numFrames", &ThresholdGeneratorUint16::numFrames)
+        .def("clear", &ThresholdGeneratorUint16::clear);
+
     m.def("applyThreshold", &imageProcessing::applyThreshold<double>);
     m.def("centroidClusters", &imageProcessing::centroidClusters<double>);
     m.def("clusterPixels", &imageProcessing::clusterPixels<double>);
     m.def("generateThreshold", &imageProcessing::generateThreshold<double>);
+    m.def("generateThresholdUint16", &imageProcessing::generateThreshold<uint16>);
     m.def("generateCentroids", &imageProcessing::generateCentroids<double>);
     m.def("windowExceedances", &imageProcessing::windowExceedances);
 }
\ No newline at end of file
@@ -15,6 +15,15 @@ namespace LinalgInterface
 
     //================================================================================
 
+    template<typename dtype>
+    std::pair<pbArrayGeneric, pbArrayGeneric> eigLargest(const NdArray<dtype>& inArray, uint32 inNumLargest)
+    {
+        const auto& [eigenValues, eigenVectors] = linalg::eig(inArray, 1e-12, inNumLargest);
+        return std::make_pair(nc2pybind(eigenValues), nc2pybind(eigenVectors));
+    }
+
+    //================================================================================
+
     template<typename dtype>
     pbArrayGeneric eigvals(const NdArray<dtype>& inArray)
     {
@@ -23,6 +32,62 @@ namespace LinalgInterface
 
     //================================================================================
 
+    template<typename dtype>
+    pbArrayGeneric eigvalsLargest(const NdArray<dtype>& inArray, uint32 inNumLargest)
+    {
+        return nc2pybind(linalg::eigvals(inArray, 1e-12, inNumLargest));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    std::pair<pbArrayGeneric, double> gaussNewtonNllsExponential(NllsMethod            inMethod,
+                                                                 uint32                inNumIterations,
+                                                                 const NdArray<dtype>& inCoordinates,
+                                                                 const NdArray<dtype>& inMeasurements,
+                                                                 dtype                 inBeta1Guess,
+                                                                 dtype                 inBeta2Guess)
+    {
+        using FunctionType = std::function<dtype(const NdArray<dtype>&, const NdArray<dtype>&)>;
+
+        // y = beta1 * exp(beta2 * x)
+        const FunctionType function = [](const NdArray<dtype>& coordinates, const NdArray<dtype>& betas) -> dtype
+        { return betas.at(0) * std::exp(betas.at(1) * coordinates.at(0)); };
+        const FunctionType delFdelBeta1 = [](const NdArray<dtype>& coordinates, const NdArray<dtype>& betas) -> dtype
+        { return std::exp(betas.at(1) * coordinates.at(0)); };
+        const FunctionType delFdelBeta2 = [](const NdArray<dtype>& coordinates, const NdArray<dtype>& betas) -> dtype
+        { return betas.at(0) * coordinates.at(0) * std::exp(betas.at(1) * coordinates.at(0)); };
+
+        const auto [betas, rms] = linalg::gaussNewtonNlls(inMethod,
+                                                          inNumIterations,
+                                                          inCoordinates,
+                                                          inMeasurements,
+                                                          function,
+                                                          { delFdelBeta1, delFdelBeta2 },
+                                                          inBeta1Guess,
+                                                          inBeta2Guess);
+        return std::make_pair(nc2pybind(betas), rms);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    std::pair<pbArrayGeneric, double> gaussNewtonNllsExponentialDefault(uint32                inNumIterations,
+                                                                        const NdArray<dtype>& inCoordinates,
+                                                                        const NdArray<dtype>& inMeasurements,
+                                                                        dtype                 inBeta1Guess,
+                                                                        dtype                 inBeta2Guess)
+    {
+        return gaussNewtonNllsExponential(NllsMethod::GAUSS_NEWTON,
+                                          inNumIterations,
+                                          inCoordinates,
+                                          inMeasurements,
+                                          inBeta1Guess,
+                                          inBeta2Guess);
+    }
+
+    //================================================================================
+
     template<typename dtype>
     pbArrayGeneric hatArray(const NdArray<dtype>& inArray)
     {
@@ -62,6 +127,14 @@ namespace LinalgInterface
 
     //================================================================================
 
+    template<typename dtype>
+    void svd(const NdArray<dtype>& inArray, NdArray<double>& outU, NdArray<double>& outS, NdArray<double>& outVT)
+    {
+        linalg::svd(inArray, outU, outS, outVT);
+    }
+
+    //================================================================================
+
     template<typename dtype>
     pbArrayGeneric svdvals(const NdArray<dtype>& inA)
     {
@@ -78,7 +151,11 @@ void initLinalg(pb11::module& m)
     m.def("det", &linalg::det<double>);
     m.def("det", &linalg::det<int64>);
     m.def("eig", &LinalgInterface::eig<double>);
+    m.def("eig", &LinalgInterface::eigLargest<double>);
     m.def("eigvals", &LinalgInterface::eigvals<double>);
+    m.def("eigvals", &LinalgInterface::eigvalsLargest<double>);
+    m.def("gaussNewtonNlls", &LinalgInterface::gaussNewtonNllsExponential<double>);
+    m.def("gaussNewtonNlls", &LinalgInterface::gaussNewtonNllsExponentialDefault<double>);
     m.def("hat", &LinalgInterface::hatArray<double>);
     m.def("inv", &linalg::inv<double>);
     m.def("lstsq", &linalg::lstsq<double>);
@@ -88,7 +165,70 @@ void initLinalg(pb11::module& m)
     m.def("multi_dot", &LinalgInterface::multi_dot<ComplexDouble>);
     m.def("pinv", &linalg::pinv<double>);
     m.def("pivotLU_decomposition", &LinalgInterface::pivotLU_decomposition<double>);
+    m.def("slogdet", &linalg::slogdet<double>);
+    m.def("slogdet", &linalg::slogdet<int64>);
     m.def("solve", &LinalgInterface::solve<double>);
+    m.def("svd", &LinalgInterface::svd<double>);
     m.def("svd", &linalg::svd<double>);
     m.def("svdvals", &LinalgInterface::svdvals<double>);
+
+    // cholesky/Cholesky.hpp
+    using CholeskyDouble = linalg::Cholesky<double>;
+    pb11::class_<CholeskyDouble>(m, "Cholesky")
+        .def(pb11::init<NdArray<double>>())
+        .def("det", &CholeskyDouble::det)
+        .def("downdate", &CholeskyDouble::downdate)
+        .def("inverse", &CholeskyDouble::inverse)
+        .def("l", &CholeskyDouble::l)
+        .def("solve", &CholeskyDouble::solve)
+        .def("update", &CholeskyDouble::update);
+
+    // lu/LU.hpp
+    using LUDouble = linalg::LU<double>;
+    pb11::class_<LUDouble>(m, "LU")
+        .def(pb11::init<NdArray<double>>())
+        .def("det", &LUDouble::det)
+        .def("factors", &LUDouble::factors)
+        .def("inverse", &LUDouble::inverse)
+        .def("issingular", &LUDouble::issingular)
+        .def("l", &LUDouble::l)
+        .def("p", &LUDouble::p)
+        .def("pivots", &LUDouble::pivots)
+        .def("solve", &LUDouble::solve)
+        .def("u", &LUDouble::u);
+
+    // qr/QR.hpp
+    using QRDouble = linalg::QR<double>;
+    pb11::class_<QRDouble>(m, "QR")
+        .def(pb11::init<bool>())
+        .def(pb11::init<NdArray<double>>())
+        .def(pb11::init<NdArray<double>, bool>())
+        .def("applyQ", &QRDouble::applyQ)
+        .def("applyQTranspose", &QRDouble::applyQTranspose)
+        .def("det", &QRDouble::det)
+        .def("factors", &QRDouble::factors)
+        .def("inverse", &QRDouble::inverse)
+        .def("lstsq", static_cast<NdArray<double> (QRDouble::*)(const NdArray<double>&) const>(&QRDouble::lstsq))
+        .def("lstsq",
+             static_cast<void (QRDouble::*)(const NdArray<double>&, NdArray<double>&) const>(&QRDouble::lstsq))
+        .def("p", &QRDouble::p)
+        .def("permutation", &QRDouble::permutation)
+        .def("q", &QRDouble::q)
+        .def("r", &QRDouble::r)
+        .def("rank", &QRDouble::rank)
+        .def("refactor", &QRDouble::refactor)
+        .def("solve", static_cast<NdArray<double> (QRDouble::*)(const NdArray<double>&) const>(&QRDouble::solve))
+        .def("solve",
+             static_cast<void (QRDouble::*)(const NdArray<double>&, NdArray<double>&) const>(&QRDouble::solve));
+
+    // svd/SVD.hpp
+    using SVDDouble = linalg::SVD<double>;
+    pb11::class_<SVDDouble>(m, "SVD")
+        .def(pb11::init<NdArray<double>>())
+        .def(pb11::init<NdArray<double>, SVDMode>())
+        .def("lstsq", &SVDDouble::lstsq)
+        .def("pinv", &SVDDouble::pinv)
+        .def("s", &SVDDouble::s)
+        .def("u", &SVDDouble::u)
+        .def("v", &SVDDouble::v);
 }
@@ -944,6 +944,73 @@ namespace NdArrayInterface
 
     //================================================================================
 
+    template<typename dtype>
+    pbArrayGeneric viewSlice1D(const NdArray<dtype>& self, const Slice& inSlice)
+    {
+        return nc2pybind(self.view(inSlice).copy());
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    pbArrayGeneric viewSlice2D(const NdArray<dtype>& self, const Slice& inRowSlice, const Slice& inColSlice)
+    {
+        return nc2pybind(self.view(inRowSlice, inColSlice).copy());
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    pbArrayGeneric viewSlice2DCol(const NdArray<dtype>& self, const Slice& inRowSlice, int32 inColIndex)
+    {
+        return nc2pybind(self.view(inRowSlice, inColIndex).copy());
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    pbArrayGeneric viewSlice2DRow(const NdArray<dtype>& self, int32 inRowIndex, const Slice& inColSlice)
+    {
+        return nc2pybind(self.view(inRowIndex, inColSlice).copy());
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    pbArrayGeneric viewSum(const NdArray<dtype>& self, const Slice& inRowSlice, const Slice& inColSlice, Axis inAxis)
+    {
+        return nc2pybind(self.view(inRowSlice, inColSlice).sum(inAxis));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    pbArrayGeneric viewTranspose(const NdArray<dtype>& self, const Slice& inRowSlice, const Slice& inColSlice)
+    {
+        return nc2pybind(self.view(inRowSlice, inColSlice).transpose().copy());
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    void viewPlusEqualScalar(NdArray<dtype>& self, const Slice& inRowSlice, const Slice& inColSlice, dtype inValue)
+    {
+        self.view(inRowSlice, inColSlice) += inValue;
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    void viewAssign(NdArray<dtype>&       self,
+                    const Slice&          inRowSlice,
+                    const Slice&          inColSlice,
+                    const NdArray<dtype>& inValues)
+    {
+        self.view(inRowSlice, inColSlice).assign(inValues);
+    }
+
+    //================================================================================
+
     template<typename dtype>
     pbArrayGeneric getIndicesScalar(const NdArray<dtype>& self, const NdArray<int32>& rowIndices, int32 colIndex)
     {
@@ -2865,6 +2932,14 @@ void initNdArray(pb11::module& m)
         .def("get", &NdArrayInterface::getScalarIndices<double>)
         .def("get", &NdArrayInterface::getSliceIndices<double>)
         .def("get", &NdArrayInterface::getIndices2D<double>)
+        .def("view", &NdArrayInterface::viewSlice1D<double>)
+        .def("view", &NdArrayInterface::viewSlice2D<double>)
+        .def("view", &NdArrayInterface::viewSlice2DRow<double>)
+        .def("view", &NdArrayInterface::viewSlice2DCol<double>)
+        .def("viewSum", &NdArrayInterface::viewSum<double>)
+        .def("viewTranspose", &NdArrayInterface::viewTranspose<double>)
+        .def("viewPlusEqualScalar", &NdArrayInterface::viewPlusEqualScalar<double>)
+        .def("viewAssign", &NdArrayInterface::viewAssign<double>)
         .def("at", &NdArrayInterface::atValueFlat<double>)
         .def("atConst", &NdArrayInterface::atValueFlatConst<double>)
         .def("at", &NdArrayInterface::atValueRowCol<double>)
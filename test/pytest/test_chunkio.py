@@ -0,0 +1,103 @@
+import os
+import tempfile
+
+import numpy as np
+
+import NumCppPy as NumCpp  # noqa E402
+
+
+####################################################################################
+def test_seed():
+    np.random.seed(666)
+
+
+####################################################################################
+def test_chunkWriterNpy():
+    """Tests writing an npy file one chunk of rows at a time"""
+    numRows = np.random.randint(100, 500)
+    numCols = np.random.randint(1, 20)
+    data = np.random.randn(numRows, numCols)
+    chunkRows = np.random.randint(1, 50)
+    with tempfile.TemporaryDirectory() as tempDir:
+        tempFile = os.path.join(tempDir, "ChunkWriter.npy")
+        writer = NumCpp.ChunkWriter(tempFile, NumCpp.Endian.NATIVE)
+        for row in range(0, numRows, chunkRows):
+            chunk = data[row : row + chunkRows, :]
+            cChunk = NumCpp.NdArray(*chunk.shape)
+            cChunk.setArray(chunk)
+            writer.write(cChunk)
+        assert writer.numRows() == numRows
+        writer.close()
+        assert np.array_equal(np.load(tempFile), data)
+
+
+####################################################################################
+def test_chunkWriterRaw():
+    """Tests appending chunks of rows to a raw binary file"""
+    numRows = np.random.randint(100, 500)
+    numCols = np.random.randint(1, 20)
+    data = np.random.randn(numRows, numCols)
+    split = np.random.randint(1, numRows)
+    with tempfile.TemporaryDirectory() as tempDir:
+        tempFile = os.path.join(tempDir, "ChunkWriter.bin")
+        for chunk in [data[:split, :], data[split:, :]]:
+            cChunk = NumCpp.NdArray(*chunk.shape)
+            cChunk.setArray(chunk)
+            writer = NumCpp.ChunkWriter(tempFile, NumCpp.Endian.BIG)
+            writer.write(cChunk)
+            writer.close()
+        assert np.array_equal(np.fromfile(tempFile, dtype=">f8").reshape(numRows, numCols), data)
+
+
+####################################################################################
+def test_chunkReaderNpy():
+    """Tests reading an npy file in chunks of rows"""
+    numRows = np.random.randint(100, 500)
+    numCols = np.random.randint(1, 20)
+    data = np.random.randn(numRows, numCols)
+    chunkRows = np.random.randint(1, 50)
+    with tempfile.TemporaryDirectory() as tempDir:
+        tempFile = os.path.join(tempDir, "ChunkReader.npy")
+        np.save(tempFile, data.astype(">f8"))
+        reader = NumCpp.ChunkReader(tempFile, chunkRows)
+        assert reader.numRows() == numRows
+        assert reader.numCols() == numCols
+        assert reader.chunkRows() == chunkRows
+        assert reader.numChunks() == (numRows + chunkRows - 1) // chunkRows
+
+        chunks = []
+        chunk = NumCpp.NdArray()
+        while reader.next(chunk):
+            assert chunk.shape().rows <= chunkRows
+            chunks.append(chunk.getNumpyArray())
+        assert len(chunks) == reader.numChunks()
+        assert np.array_equal(np.vstack(chunks), data)
+        assert not reader.next(chunk)
+        del reader
+
+
+####################################################################################
+def test_chunkReaderRaw():
+    """Tests reading a raw binary file in chunks of rows"""
+    numRows = np.random.randint(100, 500)
+    numCols = np.random.randint(1, 20)
+    data = np.random.randn(numRows, numCols)
+    chunkRows = np.random.randint(1, 50)
+    with tempfile.TemporaryDirectory() as tempDir:
+        tempFile = os.path.join(tempDir, "ChunkReader.bin")
+        data.astype("<f8").tofile(tempFile)
+        reader = NumCpp.ChunkReader(tempFile, numCols, chunkRows, NumCpp.Endian.LITTLE)
+        assert reader.numRows() == numRows
+
+        chunks = []
+        chunk = NumCpp.NdArray()
+        while reader.next(chunk):
+            chunks.append(chunk.getNumpyArray())
+        assert np.array_equal(np.vstack(chunks), data)
+        del reader
+
+        # stop part way through with chunks still being read ahead
+        reader = NumCpp.ChunkReader(tempFile, numCols, 1, NumCpp.Endian.NATIVE)
+        assert reader.next(chunk)
+        assert np.array_equal(chunk.getNumpyArray(), data[:1, :])
+        del reader
@@ -1,5 +1,6 @@
 import numpy as np
 import os
+import pytest
 import tempfile
 
 import NumCppPy as NumCpp  # noqa E402
@@ -351,3 +352,150 @@ def test_z_slices():
     assert zSliceDataNC.sizeZ() == zSliceData.shape[-1]
     for z in range(zSliceDataNC.sizeZ()):
         assert np.array_equal(zSliceDataNC[z].getNumpyArray(), zSliceData[:, :, z])
+
+
+####################################################################################
+def test_contiguous():
+    shape = np.random.randint(10, 50, [3]).tolist()
+    cShape = NumCpp.Shape(shape[0], shape[1])
+    data = np.random.randint(0, 100, shape).astype(float)
+    for layout in [NumCpp.CubeLayout.FRAME_MAJOR, NumCpp.CubeLayout.PIXEL_MAJOR]:
+        dataCube = NumCpp.DataCube(cShape, shape[-1], layout)
+        assert dataCube.iscontiguous()
+        assert dataCube.layout() == layout
+        assert dataCube.sizeZ() == shape[-1]
+        assert dataCube.shape() == cShape
+        assert np.array_equal(dataCube.frameView(0), np.zeros(shape[:2]))
+
+        cArray = NumCpp.NdArray(cShape)
+        for frame in range(shape[-1]):
+            cArray.setArray(data[:, :, frame])
+            dataCube.frameViewAssign(frame, cArray)
+
+        allPass = True
+        for frame in range(shape[-1]):
+            if not np.array_equal(dataCube.frameView(frame), data[:, :, frame]):
+                allPass = False
+                break
+        assert allPass
+
+        row = np.random.randint(0, shape[0])
+        col = np.random.randint(0, shape[1])
+        assert np.array_equal(dataCube.pixelView(row, col).flatten(), data[row, col, :])
+        assert np.array_equal(dataCube.pixelView(row * shape[1] + col).flatten(), data[row, col, :])
+        assert np.array_equal(dataCube.pixelView(-1, -1).flatten(), data[-1, -1, :])
+        assert np.array_equal(dataCube.sliceZAll(row, col).flatten(), data[row, col, :])
+        zSlice = NumCpp.Slice(1, shape[-1] - 1, 2)
+        assert np.array_equal(dataCube.sliceZ(row, col, zSlice).flatten(), data[row, col, 1:-1:2])
+
+        rowSlice = NumCpp.Slice(1, shape[0] - 1, 2)
+        colSlice = NumCpp.Slice(2, shape[1] - 2, 3)
+        zSliceCube = dataCube.sliceZAll(rowSlice, colSlice)
+        assert zSliceCube.sizeZ() == shape[-1]
+        for z in range(shape[-1]):
+            assert np.array_equal(zSliceCube[z].getNumpyArray(), data[1:-1:2, 2:-2:3, z])
+
+        values = np.random.randint(0, 100, [1, shape[-1]]).astype(float)
+        cValues = NumCpp.NdArray(1, shape[-1])
+        cValues.setArray(values)
+        dataCube.pixelViewAssign(row, col, cValues)
+        assert np.array_equal(dataCube.frameView(shape[-1] - 1)[row, col], values[0, -1])
+        data[row, col, :] = values
+
+        with pytest.raises(ValueError):
+            dataCube.push_back(cArray)
+        with pytest.raises(ValueError):
+            dataCube.pixelView(shape[0], 0)
+
+        other = NumCpp.CubeLayout.PIXEL_MAJOR if layout == NumCpp.CubeLayout.FRAME_MAJOR else NumCpp.CubeLayout.FRAME_MAJOR
+        transposed = dataCube.toLayout(other)
+        assert transposed.layout() == other
+        for frame in range(shape[-1]):
+            assert np.array_equal(transposed.frameView(frame), data[:, :, frame])
+        assert np.array_equal(transposed.pixelView(row, col).flatten(), data[row, col, :])
+
+    dataCube = NumCpp.DataCube(cShape, shape[-1], NumCpp.CubeLayout.FRAME_MAJOR)
+    assert dataCube.numIteratedFrames() == shape[-1]
+    assert dataCube.numIteratedFramesConst() == shape[-1]
+    assert dataCube.front().shape() == cShape
+    assert dataCube.back().shape() == cShape
+    assert dataCube[0].shape() == cShape
+    assert dataCube.getItemConst(shape[-1] - 1).shape() == cShape
+
+    dataCube = NumCpp.DataCube(cShape, shape[-1], NumCpp.CubeLayout.PIXEL_MAJOR)
+    with pytest.raises(ValueError):
+        dataCube.at(0)
+    with pytest.raises(ValueError):
+        dataCube[0]
+    with pytest.raises(ValueError):
+        dataCube.getItemConst(0)
+    with pytest.raises(ValueError):
+        dataCube.front()
+    with pytest.raises(ValueError):
+        dataCube.back()
+    with pytest.raises(ValueError):
+        dataCube.numIteratedFrames()
+    with pytest.raises(ValueError):
+        dataCube.numIteratedFramesConst()
+
+    dataCube = NumCpp.DataCube()
+    for frame in range(shape[-1]):
+        cArray.setArray(data[:, :, frame])
+        dataCube.push_back(cArray)
+    assert not dataCube.iscontiguous()
+    with pytest.raises(ValueError):
+        dataCube.pixelView(0)
+    transposed = dataCube.toLayout(NumCpp.CubeLayout.PIXEL_MAJOR)
+    assert np.array_equal(transposed.pixelView(1, 2).flatten(), data[1, 2, :])
+
+
+####################################################################################
+def test_file_backed():
+    shape = np.random.randint(10, 50, [3]).tolist()
+    cShape = NumCpp.Shape(shape[0], shape[1])
+    data = np.random.randint(0, 100, shape).astype(float)
+    dataCube = NumCpp.DataCube(cShape, shape[-1], NumCpp.CubeLayout.PIXEL_MAJOR)
+    cArray = NumCpp.NdArray(cShape)
+    for frame in range(shape[-1]):
+        cArray.setArray(data[:, :, frame])
+        dataCube.frameViewAssign(frame, cArray)
+
+    with tempfile.TemporaryDirectory() as tempDir:
+        pixelMajorFile = os.path.join(tempDir, "pixelMajor.npy")
+        dataCube.save(pixelMajorFile)
+        assert np.array_equal(np.load(pixelMajorFile), data)
+
+        frameMajorFile = os.path.join(tempDir, "frameMajor.npy")
+        dataCube.toLayout(NumCpp.CubeLayout.FRAME_MAJOR).save(frameMajorFile)
+        assert np.array_equal(np.load(frameMajorFile), np.moveaxis(data, -1, 0))
+
+        rawFile = os.path.join(tempDir, "frameMajor.bin")
+        dataCube.dump(rawFile)
+
+        for fileCube in [
+            NumCpp.DataCube(pixelMajorFile, NumCpp.CubeLayout.PIXEL_MAJOR, NumCpp.MapMode.COPY_ON_WRITE),
+            NumCpp.DataCube(frameMajorFile, NumCpp.CubeLayout.FRAME_MAJOR, NumCpp.MapMode.COPY_ON_WRITE),
+            NumCpp.DataCube(rawFile, cShape, NumCpp.CubeLayout.FRAME_MAJOR, NumCpp.MapMode.COPY_ON_WRITE),
+        ]:
+            assert fileCube.iscontiguous()
+            assert fileCube.shape() == cShape
+            assert fileCube.sizeZ() == shape[-1]
+            allPass = True
+            for frame in range(shape[-1]):
+                if not np.array_equal(fileCube.frameView(frame), data[:, :, frame]):
+                    allPass = False
+                    break
+            assert allPass
+            assert np.array_equal(fileCube.pixelView(-1, 1).flatten(), data[-1, 1, :])
+
+        fileCube = NumCpp.DataCube(pixelMajorFile, NumCpp.CubeLayout.PIXEL_MAJOR, NumCpp.MapMode.READ_WRITE)
+        values = np.random.randint(100, 200, [1, shape[-1]]).astype(float)
+        cValues = NumCpp.NdArray(1, shape[-1])
+        cValues.setArray(values)
+        fileCube.pixelViewAssign(2, 3, cValues)
+        fileCube.flush()
+        del fileCube
+        assert np.array_equal(np.load(pixelMajorFile)[2, 3, :], values.flatten())
+
+        with pytest.raises(ValueError):
+            NumCpp.DataCube(rawFile, NumCpp.CubeLayout.FRAME_MAJOR, NumCpp.MapMode.COPY_ON_WRITE)
@@ -1,9 +1,10 @@
 import numpy as np
+import pytest
 
 import NumCppPy as NumCpp  # noqa E402
 
 NUM_TRIALS = 5
-ROUNDING_DIGITS = 5
+TOLERANCE = 1e-5
 
 
 ####################################################################################
@@ -26,9 +27,7 @@ def test_fft():
         cArray = NumCpp.NdArray(shape)
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
-        assert np.array_equal(
-            np.round(NumCpp.fft(cArray, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.fft(data.flatten()), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.fft(cArray, NumCpp.Axis.NONE).flatten(), np.fft.fft(data.flatten()), rtol=0, atol=TOLERANCE)
 
         # real input, axis none, smaller n
         shapeInput = np.random.randint(
@@ -43,9 +42,7 @@ def test_fft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(1, data.size)
-        assert np.array_equal(
-            np.round(NumCpp.fft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.fft(data.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.fft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.fft(data.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # real input, axis none, larger n
         shapeInput = np.random.randint(
@@ -60,9 +57,7 @@ def test_fft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(data.size, data.size + 20)
-        assert np.array_equal(
-            np.round(NumCpp.fft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.fft(data.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.fft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.fft(data.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # complex input, axis none, default n
         shapeInput = np.random.randint(
@@ -78,9 +73,7 @@ def test_fft():
         imag = np.random.randint(1, 100, [shape.rows, shape.cols])
         data = real + 1j * imag
         cArray.setArray(data)
-        assert np.array_equal(
-            np.round(NumCpp.fft(cArray, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.fft(data.flatten()), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.fft(cArray, NumCpp.Axis.NONE).flatten(), np.fft.fft(data.flatten()), rtol=0, atol=TOLERANCE)
 
         # complex input, axis none, smaller n
         shapeInput = np.random.randint(
@@ -97,9 +90,7 @@ def test_fft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(1, data.size)
-        assert np.array_equal(
-            np.round(NumCpp.fft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.fft(data.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.fft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.fft(data.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # complex input, axis none, larger n
         shapeInput = np.random.randint(
@@ -116,9 +107,7 @@ def test_fft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(data.size, data.size + 20)
-        assert np.array_equal(
-            np.round(NumCpp.fft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.fft(data.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.fft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.fft(data.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # real input, axis row, default n
         shapeInput = np.random.randint(
@@ -132,7 +121,7 @@ def test_fft():
         cArray = NumCpp.NdArray(shape)
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.fft(data, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, NumCpp.Axis.ROW), np.fft.fft(data, axis=0), rtol=0, atol=TOLERANCE)
 
         # real input, axis row, smaller n
         shapeInput = np.random.randint(
@@ -147,7 +136,7 @@ def test_fft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(1, shape.rows)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, n, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.fft(data, n, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, n, NumCpp.Axis.ROW), np.fft.fft(data, n, axis=0), rtol=0, atol=TOLERANCE)
 
         # real input, axis row, larger n
         shapeInput = np.random.randint(
@@ -162,7 +151,7 @@ def test_fft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(shape.rows, shape.rows + 20)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.fft(data, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, NumCpp.Axis.ROW), np.fft.fft(data, axis=0), rtol=0, atol=TOLERANCE)
 
         # complex input, axis row, default n
         shapeInput = np.random.randint(
@@ -178,7 +167,7 @@ def test_fft():
         imag = np.random.randint(1, 100, [shape.rows, shape.cols])
         data = real + 1j * imag
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.fft(data, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, NumCpp.Axis.ROW), np.fft.fft(data, axis=0), rtol=0, atol=TOLERANCE)
 
         # complex input, axis row, smaller n
         shapeInput = np.random.randint(
@@ -195,7 +184,7 @@ def test_fft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(1, shape.rows)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, n, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.fft(data, n, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, n, NumCpp.Axis.ROW), np.fft.fft(data, n, axis=0), rtol=0, atol=TOLERANCE)
 
         # complex input, axis row, larger n
         shapeInput = np.random.randint(
@@ -212,7 +201,7 @@ def test_fft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(shape.rows, shape.rows + 20)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, n, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.fft(data, n, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, n, NumCpp.Axis.ROW), np.fft.fft(data, n, axis=0), rtol=0, atol=TOLERANCE)
 
         # real input, axis col, default n
         shapeInput = np.random.randint(
@@ -226,7 +215,7 @@ def test_fft():
         cArray = NumCpp.NdArray(shape)
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.fft(data, axis=1), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, NumCpp.Axis.COL), np.fft.fft(data, axis=1), rtol=0, atol=TOLERANCE)
 
         # real input, axis col, smaller n
         shapeInput = np.random.randint(
@@ -241,7 +230,7 @@ def test_fft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(1, shape.cols)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.fft(data, n, axis=1), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, n, NumCpp.Axis.COL), np.fft.fft(data, n, axis=1), rtol=0, atol=TOLERANCE)
 
         # real input, axis col, larger n
         shapeInput = np.random.randint(
@@ -256,7 +245,7 @@ def test_fft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(shape.cols, shape.cols + 20)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.fft(data, n, axis=1), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, n, NumCpp.Axis.COL), np.fft.fft(data, n, axis=1), rtol=0, atol=TOLERANCE)
 
         # complex input, axis col, default n
         shapeInput = np.random.randint(
@@ -272,7 +261,7 @@ def test_fft():
         imag = np.random.randint(1, 100, [shape.rows, shape.cols])
         data = real + 1j * imag
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.fft(data, axis=1), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, NumCpp.Axis.COL), np.fft.fft(data, axis=1), rtol=0, atol=TOLERANCE)
 
         # complex input, axis col, smaller n
         shapeInput = np.random.randint(
@@ -289,7 +278,7 @@ def test_fft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(1, shape.cols)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.fft(data, n, axis=1), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, n, NumCpp.Axis.COL), np.fft.fft(data, n, axis=1), rtol=0, atol=TOLERANCE)
 
         # complex input, axis col, larger n
         shapeInput = np.random.randint(
@@ -306,7 +295,7 @@ def test_fft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(shape.cols, shape.cols + 20)
-        assert np.array_equal(np.round(NumCpp.fft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.fft(data, n, axis=1), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft(cArray, n, NumCpp.Axis.COL), np.fft.fft(data, n, axis=1), rtol=0, atol=TOLERANCE)
 
 
 ####################################################################################
@@ -324,9 +313,7 @@ def test_ifft():
         cArray = NumCpp.NdArray(shape)
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.ifft(data.flatten()), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, NumCpp.Axis.NONE).flatten(), np.fft.ifft(data.flatten()), rtol=0, atol=TOLERANCE)
 
         # real input, axis none, smaller n
         shapeInput = np.random.randint(
@@ -341,9 +328,7 @@ def test_ifft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(1, data.size)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.ifft(data.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.ifft(data.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # real input, axis none, larger n
         shapeInput = np.random.randint(
@@ -358,9 +343,7 @@ def test_ifft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(data.size, data.size + 20)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.ifft(data.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.ifft(data.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # complex input, axis none, default n
         shapeInput = np.random.randint(
@@ -376,9 +359,7 @@ def test_ifft():
         imag = np.random.randint(1, 100, [shape.rows, shape.cols])
         data = real + 1j * imag
         cArray.setArray(data)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.ifft(data.flatten()), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, NumCpp.Axis.NONE).flatten(), np.fft.ifft(data.flatten()), rtol=0, atol=TOLERANCE)
 
         # complex input, axis none, smaller n
         shapeInput = np.random.randint(
@@ -395,9 +376,7 @@ def test_ifft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(1, data.size)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.ifft(data.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.ifft(data.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # complex input, axis none, larger n
         shapeInput = np.random.randint(
@@ -414,9 +393,7 @@ def test_ifft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(data.size, data.size + 20)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.ifft(data.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.ifft(data.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # real input, axis row, default n
         shapeInput = np.random.randint(
@@ -430,7 +407,7 @@ def test_ifft():
         cArray = NumCpp.NdArray(shape)
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.ifft(cArray, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.ifft(data, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.ifft(cArray, NumCpp.Axis.ROW), np.fft.ifft(data, axis=0), rtol=0, atol=TOLERANCE)
 
         # real input, axis row, smaller n
         shapeInput = np.random.randint(
@@ -445,9 +422,7 @@ def test_ifft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(1, shape.rows)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, n, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.ifft(data, n, axis=0), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, n, NumCpp.Axis.ROW), np.fft.ifft(data, n, axis=0), rtol=0, atol=TOLERANCE)
 
         # real input, axis row, larger n
         shapeInput = np.random.randint(
@@ -462,7 +437,7 @@ def test_ifft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(shape.rows, shape.rows + 20)
-        assert np.array_equal(np.round(NumCpp.ifft(cArray, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.ifft(data, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.ifft(cArray, NumCpp.Axis.ROW), np.fft.ifft(data, axis=0), rtol=0, atol=TOLERANCE)
 
         # complex input, axis row, default n
         shapeInput = np.random.randint(
@@ -478,7 +453,7 @@ def test_ifft():
         imag = np.random.randint(1, 100, [shape.rows, shape.cols])
         data = real + 1j * imag
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.ifft(cArray, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.ifft(data, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.ifft(cArray, NumCpp.Axis.ROW), np.fft.ifft(data, axis=0), rtol=0, atol=TOLERANCE)
 
         # complex input, axis row, smaller n
         shapeInput = np.random.randint(
@@ -495,9 +470,7 @@ def test_ifft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(1, shape.rows)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, n, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.ifft(data, n, axis=0), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, n, NumCpp.Axis.ROW), np.fft.ifft(data, n, axis=0), rtol=0, atol=TOLERANCE)
 
         # complex input, axis row, larger n
         shapeInput = np.random.randint(
@@ -514,9 +487,7 @@ def test_ifft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(shape.rows, shape.rows + 20)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, n, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.ifft(data, n, axis=0), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, n, NumCpp.Axis.ROW), np.fft.ifft(data, n, axis=0), rtol=0, atol=TOLERANCE)
 
         # real input, axis col, default n
         shapeInput = np.random.randint(
@@ -530,7 +501,7 @@ def test_ifft():
         cArray = NumCpp.NdArray(shape)
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.ifft(cArray, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.ifft(data, axis=1), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.ifft(cArray, NumCpp.Axis.COL), np.fft.ifft(data, axis=1), rtol=0, atol=TOLERANCE)
 
         # real input, axis col, smaller n
         shapeInput = np.random.randint(
@@ -545,9 +516,7 @@ def test_ifft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(1, shape.cols)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.ifft(data, n, axis=1), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, n, NumCpp.Axis.COL), np.fft.ifft(data, n, axis=1), rtol=0, atol=TOLERANCE)
 
         # real input, axis col, larger n
         shapeInput = np.random.randint(
@@ -562,9 +531,7 @@ def test_ifft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(shape.cols, shape.cols + 20)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.ifft(data, n, axis=1), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, n, NumCpp.Axis.COL), np.fft.ifft(data, n, axis=1), rtol=0, atol=TOLERANCE)
 
         # complex input, axis col, default n
         shapeInput = np.random.randint(
@@ -580,7 +547,7 @@ def test_ifft():
         imag = np.random.randint(1, 100, [shape.rows, shape.cols])
         data = real + 1j * imag
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.ifft(cArray, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.ifft(data, axis=1), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.ifft(cArray, NumCpp.Axis.COL), np.fft.ifft(data, axis=1), rtol=0, atol=TOLERANCE)
 
         # complex input, axis col, smaller n
         shapeInput = np.random.randint(
@@ -597,9 +564,7 @@ def test_ifft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(1, shape.cols)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.ifft(data, n, axis=1), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, n, NumCpp.Axis.COL), np.fft.ifft(data, n, axis=1), rtol=0, atol=TOLERANCE)
 
         # complex input, axis col, larger n
         shapeInput = np.random.randint(
@@ -616,9 +581,7 @@ def test_ifft():
         data = real + 1j * imag
         cArray.setArray(data)
         n = np.random.randint(shape.cols, shape.cols + 20)
-        assert np.array_equal(
-            np.round(NumCpp.ifft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.ifft(data, n, axis=1), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.ifft(cArray, n, NumCpp.Axis.COL), np.fft.ifft(data, n, axis=1), rtol=0, atol=TOLERANCE)
 
 
 ####################################################################################
@@ -697,7 +660,7 @@ def test_fft2():
         cShape = NumCpp.Shape(*shapeInput)
         cArray = NumCpp.NdArray(cShape)
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.fft2(cArray), ROUNDING_DIGITS), np.round(np.fft.fft2(data), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft2(cArray), np.fft.fft2(data), rtol=0, atol=TOLERANCE)
 
         shapeInput = np.random.randint(
             10,
@@ -711,7 +674,7 @@ def test_fft2():
         cArray = NumCpp.NdArray(cShape)
         cArray.setArray(data)
         s = [np.random.randint(1, shapeInput[0]), np.random.randint(1, shapeInput[1])]
-        assert np.array_equal(np.round(NumCpp.fft2(cArray, NumCpp.Shape(*s)), ROUNDING_DIGITS), np.round(np.fft.fft2(data, s), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.fft2(cArray, NumCpp.Shape(*s)), np.fft.fft2(data, s), rtol=0, atol=TOLERANCE)
 
 
 ####################################################################################
@@ -728,7 +691,7 @@ def test_ifft2():
         cShape = NumCpp.Shape(*shapeInput)
         cArray = NumCpp.NdArray(cShape)
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.ifft2(cArray), ROUNDING_DIGITS), np.round(np.fft.ifft2(data), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.ifft2(cArray), np.fft.ifft2(data), rtol=0, atol=TOLERANCE)
 
         shapeInput = np.random.randint(
             10,
@@ -742,7 +705,7 @@ def test_ifft2():
         cArray = NumCpp.NdArray(cShape)
         cArray.setArray(data)
         s = [np.random.randint(1, shapeInput[0]), np.random.randint(1, shapeInput[1])]
-        assert np.array_equal(np.round(NumCpp.ifft2(cArray, NumCpp.Shape(*s)), ROUNDING_DIGITS), np.round(np.fft.ifft2(data, s), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.ifft2(cArray, NumCpp.Shape(*s)), np.fft.ifft2(data, s), rtol=0, atol=TOLERANCE)
 
 
 ####################################################################################
@@ -760,9 +723,7 @@ def test_rfft():
         cArray = NumCpp.NdArray(shape)
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
-        assert np.array_equal(
-            np.round(NumCpp.rfft(cArray, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.rfft(data.flatten()), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.rfft(cArray, NumCpp.Axis.NONE).flatten(), np.fft.rfft(data.flatten()), rtol=0, atol=TOLERANCE)
 
         # real input, axis none, smaller n
         shapeInput = np.random.randint(
@@ -777,9 +738,7 @@ def test_rfft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(1, data.size)
-        assert np.array_equal(
-            np.round(NumCpp.rfft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.rfft(data.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.rfft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.rfft(data.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # real input, axis none, larger n
         shapeInput = np.random.randint(
@@ -794,9 +753,7 @@ def test_rfft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(data.size, data.size + 20)
-        assert np.array_equal(
-            np.round(NumCpp.rfft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.rfft(data.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.rfft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.rfft(data.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # real input, axis row, default n
         shapeInput = np.random.randint(
@@ -810,7 +767,7 @@ def test_rfft():
         cArray = NumCpp.NdArray(shape)
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.rfft(cArray, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.rfft(data, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.rfft(cArray, NumCpp.Axis.ROW), np.fft.rfft(data, axis=0), rtol=0, atol=TOLERANCE)
 
         # real input, axis row, smaller n
         shapeInput = np.random.randint(
@@ -825,9 +782,7 @@ def test_rfft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(1, shape.rows)
-        assert np.array_equal(
-            np.round(NumCpp.rfft(cArray, n, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.rfft(data, n, axis=0), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.rfft(cArray, n, NumCpp.Axis.ROW), np.fft.rfft(data, n, axis=0), rtol=0, atol=TOLERANCE)
 
         # real input, axis row, larger n
         shapeInput = np.random.randint(
@@ -842,7 +797,7 @@ def test_rfft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(shape.rows, shape.rows + 20)
-        assert np.array_equal(np.round(NumCpp.rfft(cArray, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.rfft(data, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.rfft(cArray, NumCpp.Axis.ROW), np.fft.rfft(data, axis=0), rtol=0, atol=TOLERANCE)
 
         # real input, axis col, default n
         shapeInput = np.random.randint(
@@ -856,7 +811,7 @@ def test_rfft():
         cArray = NumCpp.NdArray(shape)
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.rfft(cArray, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.rfft(data, axis=1), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.rfft(cArray, NumCpp.Axis.COL), np.fft.rfft(data, axis=1), rtol=0, atol=TOLERANCE)
 
         # real input, axis col, smaller n
         shapeInput = np.random.randint(
@@ -871,9 +826,7 @@ def test_rfft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(1, shape.cols)
-        assert np.array_equal(
-            np.round(NumCpp.rfft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.rfft(data, n, axis=1), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.rfft(cArray, n, NumCpp.Axis.COL), np.fft.rfft(data, n, axis=1), rtol=0, atol=TOLERANCE)
 
         # real input, axis col, larger n
         shapeInput = np.random.randint(
@@ -888,9 +841,7 @@ def test_rfft():
         data = np.random.randint(0, 100, [shape.rows, shape.cols])
         cArray.setArray(data)
         n = np.random.randint(shape.cols, shape.cols + 20)
-        assert np.array_equal(
-            np.round(NumCpp.rfft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.rfft(data, n, axis=1), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.rfft(cArray, n, NumCpp.Axis.COL), np.fft.rfft(data, n, axis=1), rtol=0, atol=TOLERANCE)
 
 
 ####################################################################################
@@ -903,9 +854,7 @@ def test_irfft():
         cShape = NumCpp.Shape(1, rfft.size)
         cArray = NumCpp.NdArrayComplexDouble(cShape)
         cArray.setArray(rfft)
-        assert np.array_equal(
-            np.round(NumCpp.irfft(cArray, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.irfft(rfft.flatten()), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.irfft(cArray, NumCpp.Axis.NONE).flatten(), np.fft.irfft(rfft.flatten()), rtol=0, atol=TOLERANCE)
 
         # axis none, smaller n
         length = np.random.randint(100, 300)
@@ -915,9 +864,7 @@ def test_irfft():
         cShape = NumCpp.Shape(1, rfft.size)
         cArray = NumCpp.NdArrayComplexDouble(cShape)
         cArray.setArray(rfft)
-        assert np.array_equal(
-            np.round(NumCpp.irfft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.irfft(rfft.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.irfft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.irfft(rfft.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # axis none, larger n
         length = np.random.randint(100, 300)
@@ -927,9 +874,7 @@ def test_irfft():
         cShape = NumCpp.Shape(1, rfft.size)
         cArray = NumCpp.NdArrayComplexDouble(cShape)
         cArray.setArray(rfft)
-        assert np.array_equal(
-            np.round(NumCpp.irfft(cArray, n, NumCpp.Axis.NONE), ROUNDING_DIGITS).flatten(), np.round(np.fft.irfft(rfft.flatten(), n), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.irfft(cArray, n, NumCpp.Axis.NONE).flatten(), np.fft.irfft(rfft.flatten(), n), rtol=0, atol=TOLERANCE)
 
         # axis Row, default n
         shapeInput = np.random.randint(
@@ -944,7 +889,7 @@ def test_irfft():
         cShape = NumCpp.Shape(rfft.shape[0], rfft.shape[1])
         cArray = NumCpp.NdArrayComplexDouble(cShape)
         cArray.setArray(rfft)
-        assert np.array_equal(np.round(NumCpp.irfft(cArray, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.irfft(rfft, axis=0), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.irfft(cArray, NumCpp.Axis.ROW), np.fft.irfft(rfft, axis=0), rtol=0, atol=TOLERANCE)
 
         # axis Row, smaller n
         shapeInput = np.random.randint(
@@ -960,14 +905,7 @@ def test_irfft():
         cShape = NumCpp.Shape(rfft.shape[0], rfft.shape[1])
         cArray = NumCpp.NdArrayComplexDouble(cShape)
         cArray.setArray(rfft)
-        # assert np.array_equal(
-        #     np.round(NumCpp.irfft(cArray, n, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.irfft(rfft, axis=0), ROUNDING_DIGITS)
-        # )
-        print(
-            np.array_equal(
-                np.round(NumCpp.irfft(cArray, n, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.irfft(rfft, n, axis=0), ROUNDING_DIGITS)
-            )
-        )
+        assert np.allclose(NumCpp.irfft(cArray, n, NumCpp.Axis.ROW), np.fft.irfft(rfft, n, axis=0), rtol=0, atol=TOLERANCE)
 
         # axis Row, larger n
         shapeInput = np.random.randint(
@@ -983,9 +921,7 @@ def test_irfft():
         cShape = NumCpp.Shape(rfft.shape[0], rfft.shape[1])
         cArray = NumCpp.NdArrayComplexDouble(cShape)
         cArray.setArray(rfft)
-        assert np.array_equal(
-            np.round(NumCpp.irfft(cArray, n, NumCpp.Axis.ROW), ROUNDING_DIGITS), np.round(np.fft.irfft(rfft, n, axis=0), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.irfft(cArray, n, NumCpp.Axis.ROW), np.fft.irfft(rfft, n, axis=0), rtol=0, atol=TOLERANCE)
 
         # axis Col, default n
         shapeInput = np.random.randint(
@@ -1000,7 +936,7 @@ def test_irfft():
         cShape = NumCpp.Shape(rfft.shape[0], rfft.shape[1])
         cArray = NumCpp.NdArrayComplexDouble(cShape)
         cArray.setArray(rfft)
-        assert np.array_equal(np.round(NumCpp.irfft(cArray, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.irfft(rfft, axis=1), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.irfft(cArray, NumCpp.Axis.COL), np.fft.irfft(rfft, axis=1), rtol=0, atol=TOLERANCE)
 
         # axis Col, smaller n
         shapeInput = np.random.randint(
@@ -1016,9 +952,7 @@ def test_irfft():
         cShape = NumCpp.Shape(rfft.shape[0], rfft.shape[1])
         cArray = NumCpp.NdArrayComplexDouble(cShape)
         cArray.setArray(rfft)
-        assert np.array_equal(
-            np.round(NumCpp.irfft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.irfft(rfft, n, axis=1), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.irfft(cArray, n, NumCpp.Axis.COL), np.fft.irfft(rfft, n, axis=1), rtol=0, atol=TOLERANCE)
 
         # axis Col, larger n
         shapeInput = np.random.randint(
@@ -1034,9 +968,7 @@ def test_irfft():
         cShape = NumCpp.Shape(rfft.shape[0], rfft.shape[1])
         cArray = NumCpp.NdArrayComplexDouble(cShape)
         cArray.setArray(rfft)
-        assert np.array_equal(
-            np.round(NumCpp.irfft(cArray, n, NumCpp.Axis.COL), ROUNDING_DIGITS), np.round(np.fft.irfft(rfft, n, axis=1), ROUNDING_DIGITS)
-        )
+        assert np.allclose(NumCpp.irfft(cArray, n, NumCpp.Axis.COL), np.fft.irfft(rfft, n, axis=1), rtol=0, atol=TOLERANCE)
 
 
 ####################################################################################
@@ -1061,7 +993,7 @@ def test_rfft2():
         cShape = NumCpp.Shape(*shapeInput)
         cArray = NumCpp.NdArray(cShape)
         cArray.setArray(data)
-        assert np.array_equal(np.round(NumCpp.rfft2(cArray), ROUNDING_DIGITS), np.round(np.fft.rfft2(data), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.rfft2(cArray), np.fft.rfft2(data), rtol=0, atol=TOLERANCE)
 
         shapeInput = np.random.randint(
             10,
@@ -1075,7 +1007,7 @@ def test_rfft2():
         cArray = NumCpp.NdArray(cShape)
         cArray.setArray(data)
         s = [np.random.randint(1, shapeInput[0]), np.random.randint(1, shapeInput[1])]
-        assert np.array_equal(np.round(NumCpp.rfft2(cArray, NumCpp.Shape(*s)), ROUNDING_DIGITS), np.round(np.fft.rfft2(data, s), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.rfft2(cArray, NumCpp.Shape(*s)), np.fft.rfft2(data, s), rtol=0, atol=TOLERANCE)
 
 
 ####################################################################################
@@ -1093,4 +1025,83 @@ def test_irfft2():
         cShape = NumCpp.Shape(*rfft2.shape)
         cArray = NumCpp.NdArrayComplexDouble(cShape)
         cArray.setArray(rfft2)
-        assert np.array_equal(np.round(NumCpp.irfft2(cArray), ROUNDING_DIGITS), np.round(np.fft.irfft2(rfft2), ROUNDING_DIGITS))
+        assert np.allclose(NumCpp.irfft2(cArray), np.fft.irfft2(rfft2), rtol=0, atol=TOLERANCE)
+
+
+####################################################################################
+def test_plan():
+    for _ in range(NUM_TRIALS):
+        n = np.random.randint(10, 100)
+        data = np.random.randint(0, 100, [1, n]) + 1j * np.random.randint(0, 100, [1, n])
+        cArray = NumCpp.NdArrayComplexDouble(1, n)
+        cArray.setArray(data)
+
+        plan = NumCpp.Plan(n, NumCpp.Transform.FFT)
+        assert plan.transform() == NumCpp.Transform.FFT
+        assert not plan.is2d()
+        assert np.allclose(plan.execute(cArray).flatten(), np.fft.fft(data.flatten()), rtol=0, atol=TOLERANCE)
+        assert np.allclose(plan.executeReuse(cArray).flatten(), np.fft.fft(data.flatten()), rtol=0, atol=TOLERANCE)
+
+        plan = NumCpp.Plan(n, NumCpp.Transform.IFFT)
+        assert np.allclose(plan.execute(cArray).flatten(), np.fft.ifft(data.flatten()), rtol=0, atol=TOLERANCE)
+
+        realData = np.random.randint(0, 100, [1, n]).astype(float)
+        cRealArray = NumCpp.NdArray(1, n)
+        cRealArray.setArray(realData)
+        plan = NumCpp.Plan(n, NumCpp.Transform.RFFT)
+        assert plan.outputShape().cols == n // 2 + 1
+        assert np.allclose(plan.execute(cRealArray).flatten(), np.fft.rfft(realData.flatten()), rtol=0, atol=TOLERANCE)
+
+        spectrum = np.fft.rfft(realData.flatten()).reshape([1, -1])
+        cArray = NumCpp.NdArrayComplexDouble(*spectrum.shape)
+        cArray.setArray(spectrum)
+        plan = NumCpp.Plan(n, NumCpp.Transform.IRFFT)
+        assert np.allclose(plan.execute(cArray).flatten(), realData.flatten(), rtol=0, atol=TOLERANCE)
+
+        with pytest.raises(ValueError):
+            NumCpp.Plan(n + 2, NumCpp.Transform.IRFFT).execute(cArray)
+
+        # in place on a column vector, the output comes back as a row vector in the same storage
+        column = np.random.randint(0, 100, [n, 1]) + 1j * np.random.randint(0, 100, [n, 1])
+        cColumn = NumCpp.NdArrayComplexDouble(n, 1)
+        cColumn.setArray(column)
+        NumCpp.Plan(n, NumCpp.Transform.FFT).executeInPlace(cColumn)
+        assert cColumn.shape().rows == 1 and cColumn.shape().cols == n
+        assert np.allclose(cColumn.getNumpyArray().flatten(), np.fft.fft(column.flatten()), rtol=0, atol=TOLERANCE)
+
+
+####################################################################################
+def test_plan2():
+    for _ in range(NUM_TRIALS):
+        shapeInput = np.random.randint(
+            10,
+            30,
+            [
+                2,
+            ],
+        )
+        cShape = NumCpp.Shape(*shapeInput)
+        data = np.random.randint(0, 100, shapeInput) + 1j * np.random.randint(0, 100, shapeInput)
+        cArray = NumCpp.NdArrayComplexDouble(cShape)
+        cArray.setArray(data)
+
+        plan = NumCpp.Plan(cShape, NumCpp.Transform.FFT)
+        assert plan.is2d()
+        assert np.allclose(plan.execute(cArray), np.fft.fft2(data), rtol=0, atol=TOLERANCE)
+        assert np.allclose(plan.executeReuse(cArray), np.fft.fft2(data), rtol=0, atol=TOLERANCE)
+
+        plan = NumCpp.Plan(cShape, NumCpp.Transform.IFFT)
+        assert np.allclose(plan.execute(cArray), np.fft.ifft2(data), rtol=0, atol=TOLERANCE)
+
+        realData = np.random.randint(0, 100, shapeInput).astype(float)
+        cRealArray = NumCpp.NdArray(cShape)
+        cRealArray.setArray(realData)
+        plan = NumCpp.Plan(cShape, NumCpp.Transform.RFFT)
+        assert np.allclose(plan.execute(cRealArray), np.fft.rfft2(realData), rtol=0, atol=TOLERANCE)
+
+        spectrum = np.fft.rfft2(realData)
+        cArray = NumCpp.NdArrayComplexDouble(*spectrum.shape)
+        cArray.setArray(spectrum)
+        plan = NumCpp.Plan(cShape, NumCpp.Transform.IRFFT)
+        assert plan.inputShape().cols == spectrum.shape[1]
+        assert np.allclose(plan.execute(cArray), np.fft.irfft2(spectrum, realData.shape), rtol=0, atol=TOLERANCE)
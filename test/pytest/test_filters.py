@@ -927,3 +927,244 @@ def test_uniform_filter():
         dataOutC = NumCpp.uniformFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()
         dataOutPy = ndimage.uniform_filter(data, size=kernalSize, mode=mode, cval=constantValue)
         assert np.array_equal(np.round(dataOutC, 8), np.round(dataOutPy, 8))
+
+
+####################################################################################
+def test_convolve1dMethods():
+    for mode in modes.keys():
+        size = np.random.randint(1000, 2000)
+        cShape = NumCpp.Shape(1, size)
+        cArray = NumCpp.NdArray(cShape)
+        data = np.random.randint(100, 1000, [size]).astype(float)
+        cArray.setArray(data)
+        kernalSize = 0
+        while kernalSize % 2 == 0:
+            kernalSize = np.random.randint(101, 301)
+        weights = np.random.randint(1, 5, [kernalSize])
+        cWeights = NumCpp.NdArray(1, kernalSize)
+        cWeights.setArray(weights)
+        constantValue = np.random.randint(0, 5)
+        dataOutPy = ndimage.convolve(data, weights, mode=mode, cval=constantValue)
+
+        dataOutC = NumCpp.convolve1d(cArray, cWeights, modes[mode], constantValue, NumCpp.ConvolutionMethod.DIRECT)
+        assert np.array_equal(dataOutC.getNumpyArray().flatten(), dataOutPy)
+
+        dataOutC = NumCpp.convolve1d(cArray, cWeights, modes[mode], constantValue, NumCpp.ConvolutionMethod.FFT)
+        assert np.allclose(dataOutC.getNumpyArray().flatten(), dataOutPy, rtol=1e-12, atol=1e-6)
+
+        dataOutC = NumCpp.convolve1d(cArray, cWeights, modes[mode], constantValue, NumCpp.ConvolutionMethod.AUTO)
+        assert np.allclose(dataOutC.getNumpyArray().flatten(), dataOutPy, rtol=1e-12, atol=1e-6)
+
+
+####################################################################################
+def test_convolveMethods():
+    for mode in modes.keys():
+        shape = np.random.randint(100, 200, [2]).tolist()
+        cShape = NumCpp.Shape(shape[0], shape[1])  # noqa
+        cArray = NumCpp.NdArray(cShape)
+        data = np.random.randint(10, 20, shape).astype(float)  # noqa
+        cArray.setArray(data)
+        kernalSize = 0
+        while kernalSize % 2 == 0:
+            kernalSize = np.random.randint(15, 41)
+        constantValue = np.random.randint(0, 5)
+        weights = np.random.randint(-2, 3, [kernalSize, kernalSize]).astype(float)
+        cWeights = NumCpp.NdArray(kernalSize)
+        cWeights.setArray(weights)
+        dataOutPy = ndimage.convolve(data, weights, mode=mode, cval=constantValue)
+
+        dataOutC = NumCpp.convolve(
+            cArray, kernalSize, cWeights, modes[mode], constantValue, NumCpp.ConvolutionMethod.DIRECT
+        ).getNumpyArray()
+        assert np.array_equal(dataOutC, dataOutPy)
+
+        dataOutC = NumCpp.convolve(
+            cArray, kernalSize, cWeights, modes[mode], constantValue, NumCpp.ConvolutionMethod.FFT
+        ).getNumpyArray()
+        assert np.allclose(dataOutC, dataOutPy, rtol=1e-12, atol=1e-8)
+
+
+####################################################################################
+def test_convolveMethodsIntegerOverflow():
+    for mode in modes.keys():
+        shape = np.random.randint(50, 100, [2]).tolist()
+        cShape = NumCpp.Shape(shape[0], shape[1])  # noqa
+        cArray = NumCpp.NdArrayUInt16(cShape)
+        data = np.random.randint(0, np.iinfo(np.uint16).max + 1, shape).astype(np.uint16)  # noqa
+        cArray.setArray(data)
+        kernalSize = 0
+        while kernalSize % 2 == 0:
+            kernalSize = np.random.randint(15, 31)
+        constantValue = np.random.randint(0, 5)
+        weights = np.random.randint(0, 5, [kernalSize, kernalSize]).astype(np.uint16)
+        cWeights = NumCpp.NdArrayUInt16(kernalSize, kernalSize)
+        cWeights.setArray(weights)
+        exact = ndimage.convolve(data.astype(np.int64), weights.astype(np.int64), mode=mode, cval=constantValue)
+
+        dataOutDirect = NumCpp.convolve(
+            cArray, kernalSize, cWeights, modes[mode], constantValue, NumCpp.ConvolutionMethod.DIRECT
+        ).getNumpyArray()
+        assert np.array_equal(dataOutDirect, exact.astype(np.uint16))
+
+        dataOutAuto = NumCpp.convolve(
+            cArray, kernalSize, cWeights, modes[mode], constantValue, NumCpp.ConvolutionMethod.AUTO
+        ).getNumpyArray()
+        assert np.array_equal(dataOutAuto, dataOutDirect)
+
+        dataOutFft = NumCpp.convolve(
+            cArray, kernalSize, cWeights, modes[mode], constantValue, NumCpp.ConvolutionMethod.FFT
+        ).getNumpyArray()
+        assert np.array_equal(dataOutFft, np.clip(exact, 0, np.iinfo(np.uint16).max))
+
+        cArray1d = NumCpp.NdArrayUInt16(1, data.size)
+        cArray1d.setArray(data.flatten())
+        weights1d = np.random.randint(0, 5, [kernalSize * 5]).astype(np.uint16)
+        cWeights1d = NumCpp.NdArrayUInt16(1, weights1d.size)
+        cWeights1d.setArray(weights1d)
+        exact1d = ndimage.convolve(
+            data.flatten().astype(np.int64), weights1d.astype(np.int64), mode=mode, cval=constantValue
+        )
+
+        dataOutDirect = NumCpp.convolve1d(
+            cArray1d, cWeights1d, modes[mode], constantValue, NumCpp.ConvolutionMethod.DIRECT
+        ).getNumpyArray()
+        assert np.array_equal(dataOutDirect.flatten(), exact1d.astype(np.uint16))
+
+        dataOutAuto = NumCpp.convolve1d(
+            cArray1d, cWeights1d, modes[mode], constantValue, NumCpp.ConvolutionMethod.AUTO
+        ).getNumpyArray()
+        assert np.array_equal(dataOutAuto, dataOutDirect)
+
+        dataOutFft = NumCpp.convolve1d(
+            cArray1d, cWeights1d, modes[mode], constantValue, NumCpp.ConvolutionMethod.FFT
+        ).getNumpyArray()
+        assert np.array_equal(dataOutFft.flatten(), np.clip(exact1d, 0, np.iinfo(np.uint16).max))
+
+
+####################################################################################
+def test_separableFiltersLargeKernels():
+    for mode in modes.keys():
+        shape = np.random.randint(100, 200, [2]).tolist()
+        cShape = NumCpp.Shape(shape[0], shape[1])  # noqa
+        cArray = NumCpp.NdArray(cShape)
+        data = np.random.randint(100, 1000, shape).astype(float)  # noqa
+        cArray.setArray(data)
+        constantValue = np.random.randint(0, 5)
+
+        sigma = np.random.rand(1).item() * 5 + 5
+        dataOutC = NumCpp.gaussianFilter(cArray, sigma, modes[mode], constantValue).getNumpyArray()
+        dataOutPy = ndimage.gaussian_filter(data, sigma, mode=mode, cval=constantValue)
+        assert np.allclose(dataOutC, dataOutPy, rtol=0, atol=1e-2)
+
+        kernalSize = 0
+        while kernalSize % 2 == 0:
+            kernalSize = np.random.randint(31, 61)
+        dataOutC = NumCpp.uniformFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()
+        dataOutPy = ndimage.uniform_filter(data, size=kernalSize, mode=mode, cval=constantValue)
+        assert np.allclose(dataOutC, dataOutPy, rtol=0, atol=1e-8)
+
+        dataOutC = NumCpp.meanFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()
+        assert np.allclose(dataOutC, dataOutPy, rtol=0, atol=1e-8)
+
+
+####################################################################################
+def test_rankFiltersUInt16():
+    for mode in modes.keys():
+        shape = np.random.randint(100, 200, [2]).tolist()
+        cShape = NumCpp.Shape(shape[0], shape[1])  # noqa
+        cArray = NumCpp.NdArrayUInt16(cShape)
+        data = np.random.randint(0, np.iinfo(np.uint16).max + 1, shape).astype(np.uint16)  # noqa
+        cArray.setArray(data)
+        kernalSize = 0
+        while kernalSize % 2 == 0:
+            kernalSize = np.random.randint(5, 21)
+        constantValue = np.random.randint(0, 5)
+
+        dataOutC = NumCpp.medianFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()
+        dataOutPy = ndimage.median_filter(data, size=kernalSize, mode=mode, cval=constantValue)
+        assert np.array_equal(dataOutC, dataOutPy)
+
+        rank = np.random.randint(0, kernalSize**2)
+        dataOutC = NumCpp.rankFilter(cArray, kernalSize, rank, modes[mode], constantValue).getNumpyArray()
+        dataOutPy = ndimage.rank_filter(data, rank, size=kernalSize, mode=mode, cval=constantValue)
+        assert np.array_equal(dataOutC, dataOutPy)
+
+        percentile = np.random.randint(0, 101)
+        dataOutC = NumCpp.percentileFilter(cArray, kernalSize, percentile, modes[mode], constantValue).getNumpyArray()
+        cArrayDouble = NumCpp.NdArray(cShape)
+        cArrayDouble.setArray(data.astype(float))
+        dataOutDouble = NumCpp.percentileFilter(cArrayDouble, kernalSize, percentile, modes[mode], constantValue)
+        assert np.array_equal(dataOutC, dataOutDouble.getNumpyArray())
+
+        cArray1d = NumCpp.NdArrayUInt16(1, data.size)
+        cArray1d.setArray(data.flatten())
+        dataOutC = NumCpp.medianFilter1d(cArray1d, kernalSize, modes[mode], constantValue).getNumpyArray().flatten()
+        dataOutPy = ndimage.median_filter(data.flatten(), size=kernalSize, mode=mode, cval=constantValue)
+        assert np.array_equal(dataOutC, dataOutPy)
+
+        rank = np.random.randint(0, kernalSize)
+        dataOutC = NumCpp.rankFilter1d(cArray1d, kernalSize, rank, modes[mode], constantValue).getNumpyArray().flatten()
+        dataOutPy = ndimage.rank_filter(data.flatten(), rank, size=kernalSize, mode=mode, cval=constantValue)
+        assert np.array_equal(dataOutC, dataOutPy)
+
+
+####################################################################################
+def test_rankFiltersUInt8():
+    for mode in modes.keys():
+        shape = np.random.randint(100, 200, [2]).tolist()
+        cShape = NumCpp.Shape(shape[0], shape[1])  # noqa
+        cArray = NumCpp.NdArrayUInt8(cShape)
+        data = np.random.randint(0, np.iinfo(np.uint8).max + 1, shape).astype(np.uint8)  # noqa
+        cArray.setArray(data)
+        kernalSize = 0
+        while kernalSize % 2 == 0:
+            kernalSize = np.random.randint(5, 41)
+        constantValue = np.random.randint(0, 5)
+
+        dataOutC = NumCpp.medianFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()
+        dataOutPy = ndimage.median_filter(data, size=kernalSize, mode=mode, cval=constantValue)
+        assert np.array_equal(dataOutC, dataOutPy)
+
+        rank = np.random.randint(0, kernalSize**2)
+        dataOutC = NumCpp.rankFilter(cArray, kernalSize, rank, modes[mode], constantValue).getNumpyArray()
+        dataOutPy = ndimage.rank_filter(data, rank, size=kernalSize, mode=mode, cval=constantValue)
+        assert np.array_equal(dataOutC, dataOutPy)
+
+        percentile = np.random.randint(0, 101)
+        dataOutC = NumCpp.percentileFilter(cArray, kernalSize, percentile, modes[mode], constantValue).getNumpyArray()
+        cArrayDouble = NumCpp.NdArray(cShape)
+        cArrayDouble.setArray(data.astype(float))
+        dataOutDouble = NumCpp.percentileFilter(cArrayDouble, kernalSize, percentile, modes[mode], constantValue)
+        assert np.array_equal(dataOutC, dataOutDouble.getNumpyArray())
+
+
+####################################################################################
+def test_minMaxFiltersLargeKernels():
+    for mode in modes.keys():
+        shape = np.random.randint(100, 200, [2]).tolist()
+        cShape = NumCpp.Shape(shape[0], shape[1])  # noqa
+        cArray = NumCpp.NdArray(cShape)
+        data = np.random.randint(100, 1000, shape).astype(float)  # noqa
+        cArray.setArray(data)
+        kernalSize = 0
+        while kernalSize % 2 == 0:
+            kernalSize = np.random.randint(31, 81)
+        constantValue = np.random.randint(0, 5)
+
+        dataOutC = NumCpp.maximumFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()
+        dataOutPy = ndimage.maximum_filter(data, size=kernalSize, mode=mode, cval=constantValue)
+        assert np.array_equal(dataOutC, dataOutPy)
+
+        dataOutC = NumCpp.minimumFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()
+        dataOutPy = ndimage.minimum_filter(data, size=kernalSize, mode=mode, cval=constantValue)
+        assert np.array_equal(dataOutC, dataOutPy)
+
+        cArray1d = NumCpp.NdArray(1, data.size)
+        cArray1d.setArray(data.flatten())
+        dataOutC = NumCpp.maximumFilter1d(cArray1d, kernalSize, modes[mode], constantValue).getNumpyArray().flatten()
+        dataOutPy = ndimage.maximum_filter1d(data.flatten(), kernalSize, mode=mode, cval=constantValue)
+        assert np.array_equal(dataOutC, dataOutPy)
+
+        dataOutC = NumCpp.minumumFilter1d(cArray1d, kernalSize, modes[mode], constantValue).getNumpyArray().flatten()
+        dataOutPy = ndimage.minimum_filter1d(data.flatten(), kernalSize, mode=mode, cval=constantValue)
+        assert np.array_equal(dataOutC, dataOutPy)
@@ -5993,9 +5993,6 @@ def test_fmod():
 
 
 ####################################################################################
-@pytest.mark.skip(
-    reason="This segfaults right now, but I'm pretty sure it is just the pytest test, nothing wrong with the actual code..."
-)
 def test_fromfile():
     shapeInput = np.random.randint(
         20,
@@ -6181,9 +6178,6 @@ def test_fromiter():
 
 
 ####################################################################################
-@pytest.mark.skip(
-    reason="This segfaults right now, but I'm pretty sure it is just the pytest test, nothing wrong with the actual code..."
-)
 def test_fromstring():
     seperator = " "
     shape = np.random.randint(
@@ -18230,9 +18224,6 @@ def test_tile():
 
 
 ####################################################################################
-@pytest.mark.skip(
-    reason="This segfaults right now, but I'm pretty sure it is just the pytest test, nothing wrong with the actual code..."
-)
 def test_tofile():
     shapeInput = np.random.randint(
         20,
@@ -19705,3 +19696,113 @@ def test_zeros():
         and cArray2.size() == shapeInput.prod()
         and np.all(cArray2.getNumpyArray() == complex(0, 0))
     )
+
+
+####################################################################################
+def test_dotLarge():
+    # crosses the cache blocking boundaries of the packed matrix multiply
+    for rows, inner, cols in [(97, 300, 1601), (260, 531, 37)]:
+        shape1 = NumCpp.Shape(rows, inner)
+        shape2 = NumCpp.Shape(inner, cols)
+        cArray1 = NumCpp.NdArray(shape1)
+        cArray2 = NumCpp.NdArray(shape2)
+        data1 = np.random.randint(-50, 50, [shape1.rows, shape1.cols])
+        data2 = np.random.randint(-50, 50, [shape2.rows, shape2.cols])
+        cArray1.setArray(data1)
+        cArray2.setArray(data2)
+        assert np.array_equal(NumCpp.dot(cArray1, cArray2), np.dot(data1, data2))
+
+    shape1 = NumCpp.Shape(67, 290)
+    shape2 = NumCpp.Shape(290, 45)
+    cArray1 = NumCpp.NdArrayComplexDouble(shape1)
+    cArray2 = NumCpp.NdArrayComplexDouble(shape2)
+    data1 = np.random.randint(-50, 50, [shape1.rows, shape1.cols]) + 1j * np.random.randint(
+        -50, 50, [shape1.rows, shape1.cols]
+    )
+    data2 = np.random.randint(-50, 50, [shape2.rows, shape2.cols]) + 1j * np.random.randint(
+        -50, 50, [shape2.rows, shape2.cols]
+    )
+    cArray1.setArray(data1)
+    cArray2.setArray(data2)
+    assert np.array_equal(NumCpp.dot(cArray1, cArray2), np.dot(data1, data2))
+
+
+####################################################################################
+def test_save():
+    shapeInput = np.random.randint(20, 100, [2])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randn(shape.rows, shape.cols)
+    cArray.setArray(data)
+    with tempfile.TemporaryDirectory() as tempDir:
+        tempFile = os.path.join(tempDir, "NdArraySave")
+        NumCpp.save(cArray, tempFile)
+        tempFile += ".npy"
+        assert os.path.isfile(tempFile)
+        assert np.array_equal(np.load(tempFile), data)
+        assert np.array_equal(NumCpp.load(tempFile).getNumpyArray(), data)
+
+        np.save(tempFile, data.astype(">f8"))
+        assert np.array_equal(NumCpp.load(tempFile).getNumpyArray(), data)
+
+        np.save(tempFile, np.asfortranarray(data))
+        assert np.array_equal(NumCpp.load(tempFile).getNumpyArray(), data)
+
+        np.save(tempFile, data[0, :])
+        assert np.array_equal(NumCpp.load(tempFile).getNumpyArray(), data[:1, :])
+
+        np.save(tempFile, data.astype(np.float32))
+        with pytest.raises(ValueError):
+            NumCpp.load(tempFile)
+
+
+####################################################################################
+def test_memmap():
+    shapeInput = np.random.randint(20, 100, [2])
+    data = np.random.randn(shapeInput[0].item(), shapeInput[1].item())
+    with tempfile.TemporaryDirectory() as tempDir:
+        tempFile = os.path.join(tempDir, "NdArrayMemMap.npy")
+        np.save(tempFile, data)
+
+        memmap = NumCpp.memmap(tempFile, NumCpp.MapMode.COPY_ON_WRITE)
+        assert memmap.shape().rows == data.shape[0] and memmap.shape().cols == data.shape[1]
+        assert memmap.mode() == NumCpp.MapMode.COPY_ON_WRITE
+        assert np.array_equal(memmap.array().getNumpyArray(), data)
+        memmap.array().put(0, 0, 666.0)
+        assert memmap.array().getNumpyArray()[0, 0] == 666.0
+        memmap.flush()
+        del memmap
+        assert np.array_equal(np.load(tempFile), data)
+
+        memmap = NumCpp.MemMap(tempFile, NumCpp.MapMode.READ_WRITE)
+        memmap.array().put(0, 0, 666.0)
+        memmap.flush()
+        del memmap
+        data[0, 0] = 666.0
+        assert np.array_equal(np.load(tempFile), data)
+
+        rawFile = os.path.join(tempDir, "NdArrayMemMap.bin")
+        data.tofile(rawFile)
+        memmap = NumCpp.memmap(rawFile, NumCpp.MapMode.COPY_ON_WRITE)
+        assert np.array_equal(memmap.array().getNumpyArray(), data.reshape(1, -1))
+        del memmap
+
+
+####################################################################################
+def test_fromstringShape():
+    shape = np.random.randint(2, 100, [2])
+    data = np.random.randn(*shape)
+    dataStr = "\n".join(",".join(repr(float(x)) for x in row) for row in data)
+    assert np.array_equal(NumCpp.fromstringDouble(dataStr, ","), data)
+    assert np.array_equal(NumCpp.fromstringDouble(dataStr + "\n1.0", ","), np.append(data.flatten(), 1.0).reshape(1, -1))
+
+    cArray = NumCpp.NdArray(1, data.size)
+    cArray.setArray(data.reshape(1, -1))
+    with tempfile.TemporaryDirectory() as tempDir:
+        tempFile = os.path.join(tempDir, "NdArrayDump.csv")
+        NumCpp.tofile(cArray, tempFile, ",")
+        assert np.array_equal(np.loadtxt(tempFile, delimiter=","), data.flatten())
+        assert np.array_equal(NumCpp.fromfile(tempFile, ","), data.reshape(1, -1))
+
+    with pytest.raises(ValueError):
+        NumCpp.fromstringDouble("1.0 2.0 abc", " ")
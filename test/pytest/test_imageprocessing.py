@@ -1,5 +1,6 @@
 import numpy as np
 import matplotlib.pyplot as plt
+import scipy.ndimage as ndimage
 
 import NumCppPy as NumCpp  # noqa E402
 
@@ -152,3 +153,197 @@ def test_imageProcessing():
         plt.show()
 
     plt.close("all")
+
+
+####################################################################################
+def test_clusterPixels():
+    shape = np.random.randint(50, 150, [2])
+    scene = np.random.randint(0, 1000, shape).astype(float)
+    xcds = np.random.rand(*shape) < np.random.rand(1).item() * 0.5
+    cScene = NumCpp.NdArray(*scene.shape)
+    cScene.setArray(scene)
+    cXcds = NumCpp.NdArrayBool(*xcds.shape)
+    cXcds.setArray(xcds)
+
+    clusters = NumCpp.clusterPixels(cScene, cXcds, 0)
+
+    # clusters are numbered in raster order of their first pixel, as are scipy's labels
+    labels, numLabels = ndimage.label(xcds, structure=np.ones([3, 3]))
+    assert len(clusters) == numLabels
+    for clusterIdx, cluster in enumerate(clusters):
+        rows, cols = np.nonzero(labels == clusterIdx + 1)
+        assert cluster.clusterId() == clusterIdx
+        assert cluster.size() == rows.size
+        assert sorted((cluster[idx].row, cluster[idx].col) for idx in range(cluster.size())) == list(zip(rows, cols))
+        assert cluster.intensity() == np.sum(scene[rows, cols])
+        assert cluster.rowMin() == rows.min() and cluster.rowMax() == rows.max()
+        assert cluster.colMin() == cols.min() and cluster.colMax() == cols.max()
+
+    borderWidth = np.random.randint(1, 4)
+    clusters = NumCpp.clusterPixels(cScene, cXcds, borderWidth)
+    for clusterIdx, cluster in enumerate(clusters):
+        members = labels == clusterIdx + 1
+        for _ in range(borderWidth):
+            members |= ndimage.binary_dilation(members, structure=np.ones([3, 3])) & ~xcds
+        assert cluster.size() == np.count_nonzero(members)
+        assert all(members[cluster[idx].row, cluster[idx].col] for idx in range(cluster.size()))
+
+
+####################################################################################
+def test_windowExceedances():
+    shape = np.random.randint(20, 100, [2])
+    xcds = np.random.rand(*shape) < 0.02
+    cXcds = NumCpp.NdArrayBool(*xcds.shape)
+    cXcds.setArray(xcds)
+
+    borderWidth = np.random.randint(1, 4)
+    windowed = NumCpp.windowExceedances(cXcds, borderWidth)
+    assert np.array_equal(windowed.getNumpyArray(), ndimage.binary_dilation(xcds, structure=np.ones([3, 3]), iterations=borderWidth))
+
+
+####################################################################################
+def ellipseProperties(m20, m02, m11):
+    piece1 = (m20 + m02) / 2
+    piece2 = np.sqrt(4 * m11**2 + (m20 - m02) ** 2) / 2
+    lambda1 = max(piece1 - piece2, 0.0)
+    lambda2 = piece1 + piece2
+    with np.errstate(invalid="ignore"):
+        eccentricity = np.sqrt(1 - lambda1 / lambda2)
+    orientation = -0.5 * np.arctan2(2 * m11, m20 - m02)
+    return 2 * np.sqrt(lambda2), 2 * np.sqrt(lambda1), eccentricity, orientation
+
+
+####################################################################################
+def assertCentroidsClose(centroids, expected):
+    assert len(centroids) == len(expected)
+    for centroid, expectedCentroid in zip(centroids, expected):
+        assert centroid.intensity() == expectedCentroid.intensity()
+        assert np.isclose(centroid.row(), expectedCentroid.row())
+        assert np.isclose(centroid.col(), expectedCentroid.col())
+        assert np.isclose(centroid.eod(), expectedCentroid.eod())
+        assert np.isclose(centroid.a(), expectedCentroid.a(), rtol=0, atol=1e-6)
+        assert np.isclose(centroid.b(), expectedCentroid.b(), rtol=0, atol=1e-6)
+        assert np.isclose(centroid.eccentricity(), expectedCentroid.eccentricity(), rtol=0, atol=1e-6, equal_nan=True)
+        if expectedCentroid.a() - expectedCentroid.b() > 1e-3:
+            # the orientation of an ellipse is only defined modulo pi
+            assert np.isclose(
+                np.exp(2j * centroid.orientation()), np.exp(2j * expectedCentroid.orientation()), rtol=0, atol=1e-6
+            )
+
+
+####################################################################################
+def expectedCentroids(cScene, threshold, windowType, borderWidth):
+    xcds = NumCpp.applyThreshold(cScene, threshold)
+    if windowType == "pre" and borderWidth > 0:
+        xcds = NumCpp.windowExceedances(xcds, borderWidth)
+    return NumCpp.centroidClusters(NumCpp.clusterPixels(cScene, xcds, borderWidth if windowType == "post" else 0))
+
+
+####################################################################################
+def test_centroid():
+    shape = np.random.randint(50, 150, [2])
+    scene = np.round(np.random.randn(*shape) * 10 + 100)
+    cScene = NumCpp.NdArray(*scene.shape)
+    cScene.setArray(scene)
+    threshold = NumCpp.generateThreshold(cScene, 0.05)
+    clusters = NumCpp.clusterPixels(cScene, NumCpp.applyThreshold(cScene, threshold), 1)
+
+    for cluster in clusters:
+        centroid = NumCpp.Centroid(cluster)
+        rows = np.asarray([cluster[idx].row for idx in range(cluster.size())], dtype=float)
+        cols = np.asarray([cluster[idx].col for idx in range(cluster.size())], dtype=float)
+        deltaRows = rows - centroid.row()
+        deltaCols = cols - centroid.col()
+        m20 = np.mean(deltaCols**2)
+        m02 = np.mean(deltaRows**2)
+        m11 = np.mean(deltaCols * deltaRows)
+
+        a, b, eccentricity, orientation = ellipseProperties(m20, m02, m11)
+        assert np.isclose(centroid.a(), a, rtol=0, atol=1e-9)
+        assert np.isclose(centroid.b(), b, rtol=0, atol=1e-9)
+        assert np.isclose(centroid.eccentricity(), eccentricity, rtol=0, atol=1e-9, equal_nan=True)
+        assert np.isclose(centroid.orientation(), orientation, rtol=0, atol=1e-9)
+
+        fromMoments = NumCpp.Centroid(
+            centroid.row(), centroid.col(), centroid.intensity(), centroid.eod(), m20, m02, m11
+        )
+        assertCentroidsClose([fromMoments], [centroid])
+
+
+####################################################################################
+def test_centroidDetector():
+    shape = np.random.randint(100, 200, [2])
+    scene = np.round(np.random.randn(*shape) * 10 + 100)
+    cScene = NumCpp.NdArray(*scene.shape)
+    cScene.setArray(scene)
+    threshold = NumCpp.generateThreshold(cScene, 0.02)
+
+    for windowType in ["pre", "post"]:
+        borderWidth = np.random.randint(0, 4)
+        expected = expectedCentroids(cScene, threshold, windowType, borderWidth)
+
+        detector = NumCpp.CentroidDetector(windowType, borderWidth)
+        detector.detect(cScene, threshold + 10)
+        centroids = detector.detect(cScene, threshold)
+        assert len(centroids) == len(detector.centroids())
+        assertCentroidsClose(centroids, expected)
+
+        generated = NumCpp.generateCentroids(cScene, 0.02, windowType, borderWidth)
+        assert [centroid.intensity() for centroid in generated] == [centroid.intensity() for centroid in expected]
+
+
+####################################################################################
+def test_centroidDetectorBands():
+    shape = np.random.randint(200, 400, [2])
+    scene = np.round(np.random.randn(*shape) * 10 + 100)
+
+    # bright streaks that cross every band seam so clusters have to be merged across bands
+    scene[10:-10, np.random.randint(10, shape[1] // 2)] += 100
+    for row in range(10, shape[0] - 10):
+        col = shape[1] // 2 + (row * (shape[1] // 2 - 10)) // shape[0]
+        scene[row, col : col + 3] += 100
+
+    cScene = NumCpp.NdArray(*scene.shape)
+    cScene.setArray(scene)
+    threshold = NumCpp.generateThreshold(cScene, 0.05)
+
+    for windowType in ["pre", "post"]:
+        borderWidth = np.random.randint(0, 3)
+        expected = expectedCentroids(cScene, threshold, windowType, borderWidth)
+        for numBands in [0, 1, 2, np.random.randint(3, 17)]:
+            centroids = NumCpp.CentroidDetector(windowType, borderWidth, numBands).detect(cScene, threshold)
+            assertCentroidsClose(centroids, expected)
+
+
+####################################################################################
+def test_generateThreshold():
+    shape = np.random.randint(50, 200, [2])
+    scene = np.random.randint(1000, 1200, shape).astype(np.uint16)
+    cScene = NumCpp.NdArray(*scene.shape)
+    cScene.setArray(scene.astype(float))
+    cSceneUint16 = NumCpp.NdArrayUInt16(*scene.shape)
+    cSceneUint16.setArray(scene)
+
+    for rate in [0.0, np.random.rand(1).item()]:
+        threshold = NumCpp.generateThresholdUint16(cSceneUint16, rate)
+        assert threshold == NumCpp.generateThreshold(cScene, rate)
+    assert NumCpp.generateThresholdUint16(cSceneUint16, 1.0) == 0
+    assert NumCpp.generateThreshold(cScene, 1.0) == scene.min() - 1
+
+    windowLength = np.random.randint(2, 5)
+    generator = NumCpp.ThresholdGeneratorUint16(windowLength)
+    frames = []
+    for frameIdx in range(8):
+        frames.append(np.random.randint(1000, 1000 + 20 * (frameIdx + 1), [30, 40]).astype(np.uint16))
+        cFrame = NumCpp.NdArrayUInt16(*frames[-1].shape)
+        cFrame.setArray(frames[-1])
+
+        rate = np.random.rand(1).item()
+        window = np.vstack(frames[-windowLength:])
+        cWindow = NumCpp.NdArrayUInt16(*window.shape)
+        cWindow.setArray(window)
+        assert generator.update(cFrame, rate) == NumCpp.generateThresholdUint16(cWindow, rate)
+        assert generator.numFrames() == min(frameIdx + 1, windowLength)
+
+    generator.clear()
+    assert generator.numFrames() == 0
@@ -1,4 +1,6 @@
 import numpy as np
+import pytest
+import scipy.optimize as optimize
 
 import NumCppPy as NumCpp  # noqa E402
 
@@ -26,6 +28,38 @@ def test_cholesky():
     assert np.array_equal(np.round(NumCpp.cholesky(cArray).getNumpyArray()), np.round(aL))
 
 
+####################################################################################
+def test_Cholesky():
+    for order in [1, 10, 64, 150]:
+        shape = NumCpp.Shape(order)
+        cArray = NumCpp.NdArray(shape)
+        m = np.random.rand(order, order) * 2 - 1
+        data = m.dot(m.transpose()) / order + np.eye(order)
+        cArray.setArray(data)
+        cholesky = NumCpp.Cholesky(cArray)
+        assert np.allclose(cholesky.l().getNumpyArray(), np.linalg.cholesky(data))
+        assert np.isclose(cholesky.det(), np.linalg.det(data), rtol=1e-9)
+        assert np.allclose(cholesky.inverse().getNumpyArray(), np.linalg.inv(data))
+
+        b = np.random.rand(order, 5)
+        bArray = NumCpp.NdArray(*b.shape)
+        bArray.setArray(b)
+        assert np.allclose(cholesky.solve(bArray).getNumpyArray(), np.linalg.solve(data, b))
+
+        x = np.random.rand(1, order) * 2 - 1
+        xArray = NumCpp.NdArray(*x.shape)
+        xArray.setArray(x)
+        cholesky.update(xArray)
+        assert np.allclose(cholesky.l().getNumpyArray(), np.linalg.cholesky(data + x.transpose().dot(x)))
+        cholesky.downdate(xArray)
+        assert np.allclose(cholesky.l().getNumpyArray(), np.linalg.cholesky(data))
+
+        xArray.setArray(x * 100 * order)
+        with pytest.raises(RuntimeError):
+            cholesky.downdate(xArray)
+        assert np.allclose(cholesky.l().getNumpyArray(), np.linalg.cholesky(data))
+
+
 ####################################################################################
 def test_det():
     for order in range(1, 5):
@@ -42,6 +76,41 @@ def test_det():
         cArray.setArray(data)
         assert NumCpp.det(cArray) == round(np.linalg.det(data))
 
+    for order in [20, 64, 65, 150]:
+        shape = NumCpp.Shape(order)
+        cArray = NumCpp.NdArray(shape)
+        data = np.random.rand(order, order) - 0.5
+        cArray.setArray(data)
+        assert np.isclose(NumCpp.det(cArray), np.linalg.det(data), rtol=1e-9, atol=0)
+
+    # integer determinants are exact where the floating point ones are not
+    for order in [12, 14]:
+        shape = NumCpp.Shape(order)
+        cArray = NumCpp.NdArrayInt64(shape)
+        data = np.random.randint(-5, 6, [order, order])
+        cArray.setArray(data)
+        assert NumCpp.det(cArray) == exactDet(data.tolist())
+
+
+def exactDet(rows):
+    """Exact integer determinant by fraction free elimination"""
+    rows = [list(row) for row in rows]
+    order = len(rows)
+    sign = 1
+    previousPivot = 1
+    for k in range(order - 1):
+        if rows[k][k] == 0:
+            swap = next((row for row in range(k + 1, order) if rows[row][k] != 0), None)
+            if swap is None:
+                return 0
+            rows[k], rows[swap] = rows[swap], rows[k]
+            sign = -sign
+        for row in range(k + 1, order):
+            for col in range(k + 1, order):
+                rows[row][col] = (rows[row][col] * rows[k][k] - rows[row][k] * rows[k][col]) // previousPivot
+        previousPivot = rows[k][k]
+    return sign * rows[-1][-1]
+
 
 ####################################################################################
 def test_eig():
@@ -53,13 +122,44 @@ def test_eig():
         cArray.setArray(data)
         cEigenValues, cEigenVectors = NumCpp.eig(cArray)
         eigenValues, eigenVectors = np.linalg.eig(data)
-        assert np.array_equal(np.round(np.abs(cEigenValues.flatten()), 5), np.flip(np.sort(np.round(np.abs(eigenValues), 5))).real)
+        assert np.allclose(np.abs(cEigenValues.flatten()), np.flip(np.sort(np.abs(eigenValues))).real, rtol=0, atol=1e-5)
 
         for idx, eigenValue in enumerate(cEigenValues.flatten()):
             eigenVector = cEigenVectors[:, idx]
             assert np.round(np.linalg.norm(eigenVector), 8) == 1.0
-            aTimesV = np.round(np.linalg.norm(np.dot(data, eigenVector)), 5)
-            assert aTimesV == np.round(eigenValue, 5)
+            aTimesV = np.linalg.norm(np.dot(data, eigenVector))
+            assert np.isclose(aTimesV, np.abs(eigenValue), rtol=0, atol=1e-5)
+
+    # both the Jacobi and the tridiagonal paths, all or only the largest eigen pairs
+    for order in [1, 2, 5, 8, 9, 20, 100]:
+        data = np.random.randn(order, order)
+        data = data + data.T
+        cArray = NumCpp.NdArray(order, order)
+        cArray.setArray(data)
+        eigenValues = np.flip(np.linalg.eigvalsh(data))
+        for numLargest in [0, 1, 3]:
+            if numLargest == 0:
+                cEigenValues, cEigenVectors = NumCpp.eig(cArray)
+                numLargest = order
+            else:
+                cEigenValues, cEigenVectors = NumCpp.eig(cArray, numLargest)
+                numLargest = min(numLargest, order)
+
+            assert cEigenValues.shape == (1, numLargest)
+            assert cEigenVectors.shape == (order, numLargest)
+            assert np.allclose(cEigenValues.flatten(), eigenValues[:numLargest], rtol=0, atol=1e-10)
+            assert np.allclose(data @ cEigenVectors, cEigenVectors * cEigenValues, rtol=0, atol=1e-10)
+            assert np.allclose(cEigenVectors.T @ cEigenVectors, np.eye(numLargest), rtol=0, atol=1e-10)
+
+    # repeated eigen values
+    data = np.eye(40)
+    data[0, 0] = 3
+    cArray = NumCpp.NdArray(*data.shape)
+    cArray.setArray(data)
+    cEigenValues, cEigenVectors = NumCpp.eig(cArray, 3)
+    assert np.allclose(cEigenValues.flatten(), [3, 1, 1])
+    assert np.allclose(cEigenVectors.T @ cEigenVectors, np.eye(3))
+    assert np.allclose(data @ cEigenVectors, cEigenVectors * cEigenValues)
 
 
 ####################################################################################
@@ -72,7 +172,54 @@ def test_eigvals():
         cArray.setArray(data)
         cEigenValues = NumCpp.eigvals(cArray)
         eigenValues = np.linalg.eigvals(data)
-        assert np.array_equal(np.round(np.abs(cEigenValues.flatten()), 5), np.flip(np.sort(np.round(np.abs(eigenValues), 5))).real)
+        assert np.allclose(np.abs(cEigenValues.flatten()), np.flip(np.sort(np.abs(eigenValues))).real, rtol=0, atol=1e-5)
+
+    for order in [5, 8, 9, 60]:
+        data = np.random.randn(order, order)
+        data = data + data.T
+        cArray = NumCpp.NdArray(order, order)
+        cArray.setArray(data)
+        eigenValues = np.flip(np.linalg.eigvalsh(data))
+        assert np.allclose(NumCpp.eigvals(cArray).flatten(), eigenValues, rtol=0, atol=1e-10)
+        assert np.allclose(NumCpp.eigvals(cArray, 4).flatten(), eigenValues[:4], rtol=0, atol=1e-10)
+
+
+####################################################################################
+def test_gaussNewtonNlls():
+    # y = a * exp(b * x) + noise
+    x = np.linspace(0, 2, 50)
+    y = 2 * np.exp(1.5 * x) + np.random.randn(x.size) * 0.1
+    cCoordinates = NumCpp.NdArray(x.size, 1)
+    cCoordinates.setArray(x.reshape(-1, 1))
+    cMeasurements = NumCpp.NdArray(1, y.size)
+    cMeasurements.setArray(y.reshape(1, -1))
+
+    def residuals(params):
+        return params[0] * np.exp(params[1] * x) - y
+
+    expected = optimize.least_squares(residuals, [1.0, 1.0], xtol=1e-12, ftol=1e-12, gtol=1e-12).x
+    expectedRms = np.sqrt(np.mean(residuals(expected) ** 2))
+
+    for method in [NumCpp.NllsMethod.GAUSS_NEWTON, NumCpp.NllsMethod.LEVENBERG_MARQUARDT]:
+        for initialGuess in [(1.0, 1.0), (10.0, 4.0)]:
+            params, rms = NumCpp.gaussNewtonNlls(method, 50, cCoordinates, cMeasurements, *initialGuess)
+            assert np.allclose(params.flatten(), expected, rtol=1e-8)
+            assert np.isclose(rms, expectedRms, rtol=1e-8)
+
+    params, rms = NumCpp.gaussNewtonNlls(50, cCoordinates, cMeasurements, 1.0, 1.0)
+    assert np.allclose(params.flatten(), expected, rtol=1e-8)
+
+    # far from the solution the undamped steps overshoot, Levenberg-Marquardt still converges
+    for initialGuess in [(0.1, 6.0), (1.0, -2.0)]:
+        params, _ = NumCpp.gaussNewtonNlls(
+            NumCpp.NllsMethod.GAUSS_NEWTON, 50, cCoordinates, cMeasurements, *initialGuess
+        )
+        assert not np.allclose(params.flatten(), expected, rtol=1e-3)
+        params, rms = NumCpp.gaussNewtonNlls(
+            NumCpp.NllsMethod.LEVENBERG_MARQUARDT, 50, cCoordinates, cMeasurements, *initialGuess
+        )
+        assert np.allclose(params.flatten(), expected, rtol=1e-8)
+        assert np.isclose(rms, expectedRms, rtol=1e-8)
 
 
 ####################################################################################
@@ -166,6 +313,50 @@ def test_lstsq():
     x = NumCpp.lstsq(aArray, bArray).getNumpyArray()
     assert np.array_equal(np.round(x, 7), np.round(np.linalg.lstsq(aData, bData, rcond=None)[0], 7)), f"{shapeInput}"
 
+    # rank deficient
+    aData = np.random.randn(30, 6).dot(np.random.randn(6, 20))
+    bData = np.random.randn(30, 4)
+    aArray = NumCpp.NdArray(*aData.shape)
+    aArray.setArray(aData)
+    bArray = NumCpp.NdArray(*bData.shape)
+    bArray.setArray(bData)
+    x = NumCpp.lstsq(aArray, bArray).getNumpyArray()
+    assert np.allclose(x, np.linalg.lstsq(aData, bData, rcond=None)[0])
+
+
+####################################################################################
+def test_LU():
+    for order in [1, 10, 64, 150]:
+        shape = NumCpp.Shape(order)
+        cArray = NumCpp.NdArray(shape)
+        data = np.random.rand(order, order) * 2 - 1
+        cArray.setArray(data)
+        lu = NumCpp.LU(cArray)
+        assert not lu.issingular()
+        l = lu.l().getNumpyArray()
+        u = lu.u().getNumpyArray()
+        p = lu.p().getNumpyArray()
+        assert np.allclose(p.dot(data), l.dot(u))
+        assert np.array_equal(np.tril(l), l) and np.array_equal(np.triu(u), u)
+        assert np.isclose(lu.det(), np.linalg.det(data), rtol=1e-9)
+        assert np.allclose(lu.inverse().getNumpyArray(), np.linalg.inv(data))
+
+        b = np.random.rand(order, 5)
+        bArray = NumCpp.NdArray(*b.shape)
+        bArray.setArray(b)
+        assert np.allclose(lu.solve(bArray).getNumpyArray(), np.linalg.solve(data, b))
+
+    shape = NumCpp.Shape(10)
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.rand(10, 10)
+    data[3, :] = data[7, :]
+    cArray.setArray(data)
+    lu = NumCpp.LU(cArray)
+    assert lu.issingular() and lu.det() == 0
+    bArray = NumCpp.NdArray(10, 1)
+    with pytest.raises(RuntimeError):
+        lu.solve(bArray)
+
 
 ####################################################################################
 def test_lu_decomposition():
@@ -421,6 +612,144 @@ def test_pivotLU_decomposition():
     assert np.array_equal(np.round(lhs, 10), np.round(rhs, 10))
 
 
+####################################################################################
+def test_QR():
+    for numRows, numCols in [(1, 1), (10, 10), (150, 150), (100, 40), (40, 100)]:
+        cArray = NumCpp.NdArray(numRows, numCols)
+        data = np.random.rand(numRows, numCols) * 2 - 1
+        cArray.setArray(data)
+        qr = NumCpp.QR(cArray)
+        q = qr.q().getNumpyArray()
+        r = qr.r().getNumpyArray()
+        k = min(numRows, numCols)
+        assert q.shape == (numRows, k) and r.shape == (k, numCols)
+        assert np.allclose(q.dot(r), data)
+        assert np.allclose(q.transpose().dot(q), np.eye(k))
+        assert np.array_equal(np.triu(r), r)
+
+        b = np.random.rand(numRows, 3)
+        bArray = NumCpp.NdArray(*b.shape)
+        bArray.setArray(b)
+        qr.applyQTranspose(bArray)
+        qTb = bArray.getNumpyArray()
+        assert np.allclose(qTb[:k], q.transpose().dot(b))
+        qr.applyQ(bArray)
+        assert np.allclose(bArray.getNumpyArray(), b)
+
+        if numRows == numCols:
+            assert np.isclose(qr.det(), np.linalg.det(data), rtol=1e-9)
+            assert np.allclose(qr.inverse().getNumpyArray(), np.linalg.inv(data))
+
+        if numRows >= numCols:
+            bArray.setArray(b)
+            assert np.allclose(qr.solve(bArray).getNumpyArray(), np.linalg.lstsq(data, b, rcond=None)[0])
+        else:
+            with pytest.raises(ValueError):
+                qr.solve(bArray)
+
+    # column pivoting reveals the rank, lstsq returns the minimum norm solution
+    for numRows, numCols, rank in [(1, 1, 1), (10, 10, 10), (10, 10, 4), (100, 40, 40), (100, 40, 15), (40, 100, 25)]:
+        data = np.random.randn(numRows, rank).dot(np.random.randn(rank, numCols))
+        cArray = NumCpp.NdArray(numRows, numCols)
+        cArray.setArray(data)
+        qr = NumCpp.QR(cArray, True)
+        q = qr.q().getNumpyArray()
+        r = qr.r().getNumpyArray()
+        p = qr.p().getNumpyArray()
+        assert qr.rank() == rank
+        assert np.allclose(q.dot(r), data.dot(p))
+        assert np.allclose(data[:, qr.permutation()], data.dot(p))
+        assert np.all(np.diff(np.abs(np.diag(r))[:rank]) <= 1e-12)
+
+        b = np.random.randn(numRows, 3)
+        bArray = NumCpp.NdArray(*b.shape)
+        bArray.setArray(b)
+        assert np.allclose(qr.lstsq(bArray).getNumpyArray(), np.linalg.lstsq(data, b, rcond=None)[0])
+
+        if numRows == numCols:
+            assert np.isclose(qr.det(), np.linalg.det(data), rtol=1e-9, atol=1e-9)
+
+        data = np.random.randn(numRows, numCols)
+        cArray.setArray(data)
+        qr.refactor(cArray)
+        assert np.allclose(qr.q().getNumpyArray().dot(qr.r().getNumpyArray()), data.dot(qr.p().getNumpyArray()))
+
+        # an empty factorization is filled by refactor, solutions can be written into an existing array
+        qr = NumCpp.QR(True)
+        qr.refactor(cArray)
+        xArray = NumCpp.NdArray(numCols, 3)
+        for _ in range(2):
+            qr.lstsq(bArray, xArray)
+            assert np.allclose(xArray.getNumpyArray(), np.linalg.lstsq(data, b, rcond=None)[0])
+        if numRows >= numCols:
+            qr.solve(bArray, xArray)
+            assert np.allclose(xArray.getNumpyArray(), np.linalg.lstsq(data, b, rcond=None)[0])
+
+
+####################################################################################
+def test_slogdet():
+    for order in [1, 3, 10, 100, 300]:
+        shape = NumCpp.Shape(order)
+        cArray = NumCpp.NdArray(shape)
+        data = np.random.rand(order, order) * 10 - 5
+        cArray.setArray(data)
+        sign, logDet = NumCpp.slogdet(cArray)
+        npSign, npLogDet = np.linalg.slogdet(data)
+        assert sign == npSign
+        assert np.isclose(logDet, npLogDet, rtol=1e-10)
+
+    shape = NumCpp.Shape(10)
+    cArray = NumCpp.NdArrayInt64(shape)
+    data = np.random.randint(0, 10, [shape.rows, shape.cols])
+    data[3, :] = data[7, :]
+    cArray.setArray(data)
+    sign, logDet = NumCpp.slogdet(cArray)
+    assert sign == 0 and logDet == -np.inf
+
+    data = np.random.randint(-9, 10, [shape.rows, shape.cols])
+    cArray.setArray(data)
+    sign, logDet = NumCpp.slogdet(cArray)
+    determinant = NumCpp.det(cArray)
+    assert sign == np.sign(determinant)
+    if determinant != 0:
+        assert np.isclose(logDet, np.log(np.abs(determinant)), rtol=1e-12)
+
+    # large entries push the minors past int64, and a dependent row must still read as singular
+    shape = NumCpp.Shape(8)
+    cArray = NumCpp.NdArrayInt64(shape)
+    for _ in range(20):
+        data = np.random.randint(-1000000, 1000001, [shape.rows, shape.cols])
+        data[7, :] = 3 * data[0, :] - 7 * data[1, :] + data[2, :]
+        cArray.setArray(data)
+        sign, logDet = NumCpp.slogdet(cArray)
+        assert sign == 0 and logDet == -np.inf
+
+        data[7, 0] += 1
+        cArray.setArray(data)
+        sign, logDet = NumCpp.slogdet(cArray)
+        npSign, npLogDet = np.linalg.slogdet(data.astype(float))
+        assert sign == npSign
+        assert np.isclose(logDet, npLogDet, rtol=1e-8)
+
+    # a Hadamard bound of a few hundred bits is still proven singular by the modular eliminations
+    shape = NumCpp.Shape(16)
+    cArray = NumCpp.NdArrayInt64(shape)
+    data = np.random.randint(-1000000, 1000001, [shape.rows, shape.cols])
+    data[15, :] = data[0, :] - data[1, :]
+    cArray.setArray(data)
+    sign, logDet = NumCpp.slogdet(cArray)
+    assert sign == 0 and logDet == -np.inf
+
+    # past the prime cap the LU decides, without an elimination per 31 bits of the bound
+    shape = NumCpp.Shape(200)
+    cArray = NumCpp.NdArrayInt64(shape)
+    data = np.random.randint(-1000000, 1000001, [shape.rows, shape.cols])
+    data[199, :] = data[0, :] - data[1, :]
+    cArray.setArray(data)
+    sign, logDet = NumCpp.slogdet(cArray)
+    assert sign in [-1, 0, 1]
+
+
 ####################################################################################
 def test_solve():
     sizeInput = np.random.randint(5, 50)
@@ -461,6 +790,50 @@ def test_svd():
 
     assert np.array_equal(np.round(np.linalg.multi_dot([u, ss, vt]), 8), data)
 
+    NumCpp.svd(cArray, uArray, sArray, vtArray, NumCpp.SVDMode.THIN)
+    k = min(shape)
+    u = uArray.getNumpyArray()
+    s = sArray.getNumpyArray().flatten()
+    vt = vtArray.getNumpyArray()
+    assert u.shape == (shape[0], k) and vt.shape == (k, shape[1])
+    assert np.array_equal(np.round((u * s).dot(vt), 8), data)
+
+
+####################################################################################
+def test_SVD():
+    for numRows, numCols in [(1, 1), (1, 7), (10, 10), (64, 64), (120, 30), (30, 120), (2000, 20)]:
+        cArray = NumCpp.NdArray(numRows, numCols)
+        data = np.random.rand(numRows, numCols) * 2 - 1
+        cArray.setArray(data)
+        k = min(numRows, numCols)
+        npS = np.linalg.svd(data, compute_uv=False)
+
+        for mode in [NumCpp.SVDMode.FULL, NumCpp.SVDMode.THIN]:
+            svd = NumCpp.SVD(cArray, mode)
+            u = svd.u().getNumpyArray()
+            v = svd.v().getNumpyArray()
+            s = svd.s().getNumpyArray().flatten()[:k]
+            if mode == NumCpp.SVDMode.FULL:
+                assert u.shape == (numRows, numRows) and v.shape == (numCols, numCols)
+            else:
+                assert u.shape == (numRows, k) and v.shape == (numCols, k)
+            assert np.allclose(s, npS)
+            assert np.allclose((u[:, :k] * s).dot(v[:, :k].transpose()), data)
+            assert np.allclose(u.transpose().dot(u), np.eye(u.shape[1]))
+            assert np.allclose(v.transpose().dot(v), np.eye(v.shape[1]))
+            assert np.allclose(svd.pinv().getNumpyArray(), np.linalg.pinv(data))
+
+            b = np.random.rand(numRows, 3)
+            bArray = NumCpp.NdArray(*b.shape)
+            bArray.setArray(b)
+            assert np.allclose(svd.lstsq(bArray).getNumpyArray(), np.linalg.lstsq(data, b, rcond=None)[0])
+
+        values = NumCpp.SVD(cArray, NumCpp.SVDMode.VALUES)
+        assert np.allclose(values.s().getNumpyArray().flatten()[:k], npS)
+        assert values.u().isempty() and values.v().isempty()
+        with pytest.raises(RuntimeError):
+            values.pinv()
+
 
 ####################################################################################
 def test_svdvals():
@@ -477,3 +850,13 @@ def test_svdvals():
     cArray.setArray(data)
 
     assert np.array_equal(np.round(NumCpp.svdvals(cArray).flatten(), 8), np.round(np.linalg.svdvals(data), 8))
+
+    # singular values far below sqrt(eps) * the largest are resolved to working precision
+    order = 40
+    q1 = np.linalg.qr(np.random.rand(order, order))[0]
+    q2 = np.linalg.qr(np.random.rand(order, order))[0]
+    s = np.logspace(0, -12, order)
+    data = q1.dot(np.diag(s)).dot(q2.transpose())
+    cArray = NumCpp.NdArray(order, order)
+    cArray.setArray(data)
+    assert np.allclose(NumCpp.svdvals(cArray).flatten(), s, rtol=0, atol=1e-14)
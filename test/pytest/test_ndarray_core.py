@@ -11195,9 +11195,6 @@ def test_swapCols():
 
 
 ####################################################################################
-@pytest.mark.skip(
-    reason="This segfaults right now, but I'm pretty sure it is just the pytest test, nothing wrong with the actual code..."
-)
 def test_tofile():
     shapeInput = np.random.randint(
         2,
@@ -11622,3 +11619,53 @@ def test_zeros():
 ####################################################################################
 def test_structured_ndarray():
     assert NumCpp.testStructuredArray()
+
+
+####################################################################################
+def test_view():
+    shapeInput = np.random.randint(
+        10,
+        50,
+        [
+            2,
+        ],
+    )
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randint(0, 100, [shape.rows, shape.cols]).astype(float)
+    cArray.setArray(data)
+
+    start = np.random.randint(0, shape.size() // 2)
+    stop = np.random.randint(start + 1, shape.size())
+    step = np.random.randint(1, 5)
+    assert np.array_equal(cArray.view(NumCpp.Slice(start, stop, step)).flatten(), data.flatten()[start:stop:step])
+
+    rowStart = np.random.randint(0, shape.rows // 2)
+    rowStop = np.random.randint(rowStart + 1, shape.rows)
+    rowStep = np.random.randint(1, 4)
+    colStart = np.random.randint(0, shape.cols // 2)
+    colStop = np.random.randint(colStart + 1, shape.cols)
+    colStep = np.random.randint(1, 4)
+    rowSlice = NumCpp.Slice(rowStart, rowStop, rowStep)
+    colSlice = NumCpp.Slice(colStart, colStop, colStep)
+    expected = data[rowStart:rowStop:rowStep, colStart:colStop:colStep]
+    assert np.array_equal(cArray.view(rowSlice, colSlice), expected)
+    assert np.array_equal(cArray.viewTranspose(rowSlice, colSlice), expected.T)
+    assert np.array_equal(cArray.view(rowStart, colSlice).flatten(), data[rowStart, colStart:colStop:colStep])
+    assert np.array_equal(cArray.view(rowSlice, colStart).flatten(), data[rowStart:rowStop:rowStep, colStart])
+
+    assert cArray.viewSum(rowSlice, colSlice, NumCpp.Axis.NONE).item() == np.sum(expected)
+    assert np.array_equal(cArray.viewSum(rowSlice, colSlice, NumCpp.Axis.ROW).flatten(), np.sum(expected, axis=0))
+    assert np.array_equal(cArray.viewSum(rowSlice, colSlice, NumCpp.Axis.COL).flatten(), np.sum(expected, axis=1))
+
+    value = np.random.randint(1, 100)
+    cArray.viewPlusEqualScalar(rowSlice, colSlice, value)
+    data[rowStart:rowStop:rowStep, colStart:colStop:colStep] += value
+    assert np.array_equal(cArray.getNumpyArray(), data)
+
+    values = np.random.randint(0, 100, expected.shape).astype(float)
+    cValues = NumCpp.NdArray(*values.shape)
+    cValues.setArray(values)
+    cArray.viewAssign(rowSlice, colSlice, cValues)
+    data[rowStart:rowStop:rowStep, colStart:colStop:colStep] = values
+    assert np.array_equal(cArray.getNumpyArray(), data)